@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "util/BadgeRegistry.hpp"
+
+#include "common/Literals.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "providers/bttv/BttvBadges.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace chatterino;
+using namespace literals;
+
+/// Assigns badges to `state.range(0)` users, like the 7TV entitlements that
+/// are received when joining a big channel
+static void BM_BadgeRegistryBurst(benchmark::State &state)
+{
+    mock::BaseApplication app;
+    auto users = static_cast<int>(state.range(0));
+
+    std::vector<UserId> userIDs;
+    for (int i = 0; i < users; i++)
+    {
+        userIDs.push_back({QString::number(i)});
+    }
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        BttvBadges badges;
+        std::vector<QString> badgeIDs;
+        for (int i = 0; i < 10; i++)
+        {
+            badgeIDs.push_back(badges.registerBadge(
+                {{"url", u"https://cdn.betterttv.net/%1.svg"_s.arg(i)}}));
+        }
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < userIDs.size(); i++)
+        {
+            badges.assignBadgeToUser(badgeIDs[i % badgeIDs.size()],
+                                     userIDs[i]);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * users);
+}
+
+BENCHMARK(BM_BadgeRegistryBurst)->Arg(1000)->Arg(10000)->Arg(100000);
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "common/ChatterSet.hpp"
+#include "common/Literals.hpp"
+#include "controllers/completion/sources/EmoteSource.hpp"
+#include "controllers/completion/strategies/SmartEmoteStrategy.hpp"
+#include "lib/MockApplication.hpp"
+#include "providers/twitch/TwitchChannel.hpp"
+
+#include <benchmark/benchmark.h>
+#include <QCoreApplication>
+#include <QString>
+
+#include <memory>
+
+using namespace chatterino;
+using namespace literals;
+
+namespace {
+
+/// Queries as they're typed character by character
+const QString QUERIES[] = {
+    u":k"_s, u":ke"_s, u":kek"_s, u":kekw"_s, u":p"_s, u":po"_s, u":pog"_s,
+};
+
+void BM_EmoteCompletionCreate(benchmark::State &state)
+{
+    bench::MockApplication app;
+    TwitchChannel chan(u"nymn"_s);
+    bench::loadChannelEmotes(chan, u"nymn"_s);
+
+    for (auto _ : state)
+    {
+        completion::EmoteSource source(
+            &chan, std::make_unique<completion::SmartEmoteStrategy>());
+        benchmark::DoNotOptimize(&source);
+    }
+
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+void BM_EmoteCompletionUpdate(benchmark::State &state)
+{
+    bench::MockApplication app;
+    TwitchChannel chan(u"nymn"_s);
+    bench::loadChannelEmotes(chan, u"nymn"_s);
+
+    completion::EmoteSource source(
+        &chan, std::make_unique<completion::SmartEmoteStrategy>());
+
+    for (auto _ : state)
+    {
+        for (const auto &query : QUERIES)
+        {
+            source.update(query);
+            benchmark::DoNotOptimize(source.output().data());
+        }
+    }
+
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+void BM_ChatterPrefix(benchmark::State &state)
+{
+    ChatterSet chatters;
+    for (size_t i = 0; i < ChatterSet::CHATTER_LIMIT; i++)
+    {
+        chatters.addRecentChatter(u"chatter"_s + QString::number(i));
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(chatters.filterByPrefix(u"chatter12"_s));
+        benchmark::DoNotOptimize(chatters.filterByPrefix(u"x"_s));
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_EmoteCompletionCreate);
+BENCHMARK(BM_EmoteCompletionUpdate);
+BENCHMARK(BM_ChatterPrefix);
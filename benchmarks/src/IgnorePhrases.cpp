@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "common/Literals.hpp"
+#include "controllers/ignores/IgnorePhrase.hpp"
+#include "controllers/ignores/IgnoreRewriter.hpp"
+#include "lib/MockApplication.hpp"
+#include "providers/twitch/TwitchIrc.hpp"
+
+#include <benchmark/benchmark.h>
+#include <IrcMessage>
+#include <QJsonArray>
+#include <QString>
+
+#include <memory>
+#include <vector>
+
+using namespace chatterino;
+using namespace literals;
+
+namespace {
+
+/// A large rule set like a moderation team would use: mostly literal terms
+/// that rarely match, some common words and a few regexes.
+std::vector<IgnorePhrase> makePhrases()
+{
+    std::vector<IgnorePhrase> phrases;
+    for (int i = 0; i < 160; i++)
+    {
+        phrases.emplace_back(u"blockedterm"_s + QString::number(i), false,
+                             false, u"***"_s, false);
+    }
+    for (const auto *word : {"lol", "xd", "pog", "kekw", "omegalul", "the",
+                             "nice", "gg", "monkas", "lul"})
+    {
+        phrases.emplace_back(QString::fromUtf8(word), false, false, u"***"_s,
+                             false);
+    }
+    for (int i = 0; i < 20; i++)
+    {
+        phrases.emplace_back(
+            uR"(\bspam)"_s + QString::number(i) + uR"(\w*)"_s, true, false,
+            u"***"_s, false);
+    }
+    for (int i = 0; i < 10; i++)
+    {
+        phrases.emplace_back(u"blockedphrase"_s + QString::number(i), false,
+                             true, QString{}, false);
+    }
+    return phrases;
+}
+
+std::vector<QString> loadMessages()
+{
+    const auto doc =
+        bench::readJsonFile(u":/bench/recentmessages-nymn.json"_s);
+
+    std::vector<QString> messages;
+    for (const auto &value : doc.object()["messages"_L1].toArray())
+    {
+        std::unique_ptr<Communi::IrcMessage> message(
+            Communi::IrcMessage::fromData(value.toString().toUtf8(), nullptr));
+        if (message->type() == Communi::IrcMessage::Private)
+        {
+            messages.push_back(message->parameter(1));
+        }
+    }
+    return messages;
+}
+
+void BM_IgnorePhrasesCompile(benchmark::State &state)
+{
+    bench::MockApplication app;
+    const auto phrases = makePhrases();
+
+    for (auto _ : state)
+    {
+        IgnoreRewriter rewriter(phrases);
+        benchmark::DoNotOptimize(&rewriter);
+    }
+}
+
+void BM_IgnorePhrasesBlock(benchmark::State &state)
+{
+    bench::MockApplication app;
+    const auto phrases = makePhrases();
+    const auto messages = loadMessages();
+    IgnoreRewriter rewriter(phrases);
+
+    for (auto _ : state)
+    {
+        for (const auto &message : messages)
+        {
+            benchmark::DoNotOptimize(rewriter.findBlockingPhrase(message));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(messages.size()));
+}
+
+void BM_IgnorePhrasesReplace(benchmark::State &state)
+{
+    bench::MockApplication app;
+    const auto phrases = makePhrases();
+    const auto messages = loadMessages();
+    IgnoreRewriter rewriter(phrases);
+
+    for (auto _ : state)
+    {
+        for (const auto &message : messages)
+        {
+            QString content = message;
+            std::vector<TwitchEmoteOccurrence> emotes;
+            rewriter.rewrite(content, emotes);
+            benchmark::DoNotOptimize(content);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(messages.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_IgnorePhrasesCompile);
+BENCHMARK(BM_IgnorePhrasesBlock);
+BENCHMARK(BM_IgnorePhrasesReplace);
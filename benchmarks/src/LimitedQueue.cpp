@@ -7,6 +7,7 @@
 #include <benchmark/benchmark.h>
 
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <vector>
 
@@ -111,6 +112,116 @@ void BM_LimitedQueue_Find(benchmark::State &state)
     }
 }
 
+void BM_LimitedQueue_Visit_ExpensiveCopy(benchmark::State &state)
+{
+    LimitedQueue<std::shared_ptr<int>> queue(1000);
+    for (int i = 0; i < 1000; ++i)
+    {
+        queue.pushBack(std::make_shared<int>(i));
+    }
+
+    for (auto _ : state)
+    {
+        auto sum = queue.visit([](const auto &items) {
+            int sum = 0;
+            for (const auto &item : items)
+            {
+                sum += *item;
+            }
+            return sum;
+        });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+// The following benchmarks run with multiple threads on the same queue.
+// Thread 0 keeps appending items while all other threads read the whole queue.
+
+LimitedQueue<std::shared_ptr<int>> &sharedQueue()
+{
+    static LimitedQueue<std::shared_ptr<int>> queue(1000);
+    static std::once_flag filled;
+    std::call_once(filled, [] {
+        for (int i = 0; i < 1000; ++i)
+        {
+            queue.pushBack(std::make_shared<int>(i));
+        }
+    });
+    return queue;
+}
+
+void BM_LimitedQueue_Concurrent_Snapshot(benchmark::State &state)
+{
+    auto &queue = sharedQueue();
+    auto item = std::make_shared<int>(state.thread_index());
+
+    for (auto _ : state)
+    {
+        if (state.thread_index() == 0)
+        {
+            queue.pushBack(item);
+            continue;
+        }
+
+        int sum = 0;
+        for (const auto &it : queue.getSnapshot())
+        {
+            sum += *it;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+void BM_LimitedQueue_Concurrent_Visit(benchmark::State &state)
+{
+    auto &queue = sharedQueue();
+    auto item = std::make_shared<int>(state.thread_index());
+
+    for (auto _ : state)
+    {
+        if (state.thread_index() == 0)
+        {
+            queue.pushBack(item);
+            continue;
+        }
+
+        auto sum = queue.visit([](const auto &items) {
+            int sum = 0;
+            for (const auto &it : items)
+            {
+                sum += *it;
+            }
+            return sum;
+        });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+void BM_LimitedQueue_Concurrent_VisitLastN(benchmark::State &state)
+{
+    auto &queue = sharedQueue();
+    auto item = std::make_shared<int>(state.thread_index());
+
+    for (auto _ : state)
+    {
+        if (state.thread_index() == 0)
+        {
+            queue.pushBack(item);
+            continue;
+        }
+
+        auto sum = queue.visitLastN(20, [](const auto &items) {
+            int sum = 0;
+            for (const auto &it : items)
+            {
+                sum += *it;
+            }
+            return sum;
+        });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
 BENCHMARK(BM_LimitedQueue_PushBack);
 BENCHMARK(BM_LimitedQueue_PushFront_One);
 BENCHMARK(BM_LimitedQueue_PushFront_Many);
@@ -118,3 +229,7 @@ BENCHMARK(BM_LimitedQueue_Replace);
 BENCHMARK(BM_LimitedQueue_Snapshot);
 BENCHMARK(BM_LimitedQueue_Snapshot_ExpensiveCopy);
 BENCHMARK(BM_LimitedQueue_Find);
+BENCHMARK(BM_LimitedQueue_Visit_ExpensiveCopy);
+BENCHMARK(BM_LimitedQueue_Concurrent_Snapshot)->ThreadRange(2, 8);
+BENCHMARK(BM_LimitedQueue_Concurrent_Visit)->ThreadRange(2, 8);
+BENCHMARK(BM_LimitedQueue_Concurrent_VisitLastN)->ThreadRange(2, 8);
@@ -41,3 +41,31 @@ static void BM_LinkParsing(benchmark::State &state)
 }
 
 BENCHMARK(BM_LinkParsing);
+
+// Most words in chat aren't links
+const QString CHAT_INPUT = QStringLiteral(
+    "LUL what was that KEKW OMEGALUL no way he actually did it PogChamp "
+    "@forsen did you see the clip? pepeLaugh catJAM catJAM catJAM "
+    "that's crazy, I can't believe it... 5Head Clap Clap 1:0 for chat "
+    "check out chatterino.com for the best client EZ Clap monkaS ");
+
+static void BM_LinkParsingChat(benchmark::State &state)
+{
+    QStringList words = CHAT_INPUT.split(' ');
+
+    // Make sure the TLDs are loaded
+    {
+        benchmark::DoNotOptimize(linkparser::parse(u"xd.com"));
+    }
+
+    for (auto _ : state)
+    {
+        for (const auto &word : words)
+        {
+            auto parsed = linkparser::parse(word);
+            benchmark::DoNotOptimize(parsed);
+        }
+    }
+}
+
+BENCHMARK(BM_LinkParsingChat);
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "common/Literals.hpp"
+#include "messages/layouts/MessageLayoutContainer.hpp"
+#include "messages/layouts/MessageLayoutContext.hpp"
+#include "messages/Message.hpp"
+#include "messages/MessageBuilder.hpp"
+#include "messages/MessageElement.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "singletons/Fonts.hpp"
+#include "singletons/Theme.hpp"
+#include "util/DebugCount.hpp"
+
+#include <benchmark/benchmark.h>
+#include <QString>
+#include <QStringList>
+
+using namespace chatterino;
+using namespace literals;
+
+namespace {
+
+class MockApplication : mock::BaseApplication
+{
+public:
+    MockApplication()
+        : theme(this->paths_)
+        , fonts(this->settings)
+    {
+    }
+
+    Theme *getThemes() override
+    {
+        return &this->theme;
+    }
+
+    Fonts *getFonts() override
+    {
+        return &this->fonts;
+    }
+
+    Theme theme;
+    Fonts fonts;
+};
+
+// 20 words, a typical chat message
+const QStringList WORDS =
+    u"this is a pretty average chat message with some words in it that "
+    "should wrap around at least once or twice"_s.split(' ');
+
+MessagePtr buildMessage()
+{
+    MessageBuilder builder;
+    builder.emplace<TextElement>(u"username:"_s, MessageElementFlag::Username,
+                                 MessageColor::Text, FontStyle::ChatMediumBold);
+    for (const auto &word : WORDS)
+    {
+        builder.emplace<TextElement>(word, MessageElementFlag::Text,
+                                     MessageColor::Text);
+    }
+    return builder.release();
+}
+
+void BM_MessageBuild(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(buildMessage());
+    }
+
+    auto blocksBefore = DebugCount::get(DebugObject::MessageArenaBlock);
+    auto message = buildMessage();
+    state.counters["elements"] =
+        static_cast<double>(message->elements.size());
+    state.counters["arenaBlocks"] = static_cast<double>(
+        DebugCount::get(DebugObject::MessageArenaBlock) - blocksBefore);
+}
+
+void BM_MessageLayout(benchmark::State &state)
+{
+    MockApplication mockApplication;
+    auto message = buildMessage();
+
+    MessageLayoutContext ctx{
+        .messageColors = {},
+        .flags =
+            {
+                MessageElementFlag::Text,
+                MessageElementFlag::Username,
+            },
+        .width = static_cast<int>(state.range(0)),
+        .scale = 1.0F,
+        .imageScale = 1.0F,
+    };
+
+    auto layout = [&](MessageLayoutContainer &container) {
+        container.beginLayout(ctx.width, ctx.scale, ctx.imageScale, {});
+        for (const auto &element : message->elements)
+        {
+            element->addToContainer(container, ctx);
+        }
+        container.endLayout();
+    };
+
+    auto elementsBefore = DebugCount::get(DebugObject::MessageLayoutElement);
+    auto blocksBefore = DebugCount::get(DebugObject::MessageArenaBlock);
+
+    MessageLayoutContainer container;
+    for (auto _ : state)
+    {
+        layout(container);
+    }
+
+    state.counters["layoutElements"] = static_cast<double>(
+        DebugCount::get(DebugObject::MessageLayoutElement) - elementsBefore);
+    state.counters["arenaBlocks"] = static_cast<double>(
+        DebugCount::get(DebugObject::MessageArenaBlock) - blocksBefore);
+}
+
+}  // namespace
+
+BENCHMARK(BM_MessageBuild);
+// Relayouts of the same message at a narrow and a wide width
+BENCHMARK(BM_MessageLayout)->Arg(200)->Arg(2000);
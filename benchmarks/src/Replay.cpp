@@ -0,0 +1,393 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+// Replays a recorded IRC capture through the same path live chat takes:
+// IrcMessageHandler -> MessageBuilder (incl. highlights) -> filters ->
+// Channel::addMessage.
+//
+// Configuration is done through environment variables:
+//  - CHATTERINO_REPLAY_CAPTURE: Path to the capture. Files ending in `.json`
+//    are read in the recent-messages format, anything else is read as one raw
+//    IRC line per line. Defaults to the bundled nymn recent messages.
+//  - CHATTERINO_REPLAY_SPEED: If set, an additional run replays the capture
+//    paced by its `tmi-sent-ts` tags at this speed (1 = real time).
+//  - CHATTERINO_REPLAY_FILTER: Filter applied to every message, like a split
+//    filter would be.
+
+#include "common/Literals.hpp"
+#include "controllers/filters/FilterRecord.hpp"
+#include "controllers/filters/lang/Filter.hpp"
+#include "lib/MockApplication.hpp"
+#include "messages/Message.hpp"
+#include "messages/MessageSink.hpp"
+#include "providers/twitch/IrcMessageHandler.hpp"
+#include "providers/twitch/TwitchChannel.hpp"
+#include "util/QStringHash.hpp"
+
+#include <benchmark/benchmark.h>
+#include <IrcMessage>
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonArray>
+#include <QString>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef Q_OS_WIN
+#    include <Windows.h>
+// Windows.h has to be included before Psapi.h
+#    include <Psapi.h>
+#else
+#    include <sys/resource.h>
+#endif
+
+using namespace chatterino;
+using namespace literals;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct CaptureLine {
+    QByteArray data;
+    QString channel;
+    /// Value of the `tmi-sent-ts` tag (or 0)
+    int64_t sentAt = 0;
+};
+
+QString capturePath()
+{
+    return qEnvironmentVariable("CHATTERINO_REPLAY_CAPTURE",
+                                u":/bench/recentmessages-nymn.json"_s);
+}
+
+/// Returns std::nullopt if the capture can't be read
+std::optional<std::vector<CaptureLine>> loadCapture(const QString &path)
+{
+    QList<QByteArray> rawLines;
+    if (path.endsWith(u".json"_s))
+    {
+        const auto doc = bench::tryReadJsonFile(path);
+        if (!doc)
+        {
+            return std::nullopt;
+        }
+        for (const auto &value : doc->object()["messages"_L1].toArray())
+        {
+            rawLines.append(value.toString().toUtf8());
+        }
+    }
+    else
+    {
+        QFile file(path);
+        if (!file.open(QFile::ReadOnly))
+        {
+            return std::nullopt;
+        }
+        rawLines = file.readAll().split('\n');
+    }
+
+    std::vector<CaptureLine> lines;
+    lines.reserve(rawLines.size());
+    for (auto &raw : rawLines)
+    {
+        raw = raw.trimmed();
+        if (raw.isEmpty())
+        {
+            continue;
+        }
+
+        std::unique_ptr<Communi::IrcMessage> message(
+            Communi::IrcMessage::fromData(raw, nullptr));
+        auto channel = message->parameter(0);
+        if (!channel.startsWith('#'))
+        {
+            continue;
+        }
+
+        lines.push_back({
+            .data = raw,
+            .channel = channel.mid(1),
+            .sentAt = message->tag(u"tmi-sent-ts"_s).toLongLong(),
+        });
+    }
+    return lines;
+}
+
+/// Latencies of each stage in microseconds
+struct StageLatencies {
+    std::vector<double> parse;
+    std::vector<double> build;
+    std::vector<double> filter;
+    std::vector<double> add;
+};
+
+double elapsedUs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - start)
+        .count();
+}
+
+constexpr std::pair<const char *, double> PERCENTILES[] = {
+    {"p50", 0.5},
+    {"p90", 0.9},
+    {"p99", 0.99},
+};
+
+double percentile(std::vector<double> &values, double p)
+{
+    if (values.empty())
+    {
+        return 0;
+    }
+    auto index = p * static_cast<double>(values.size() - 1);
+    auto nth = values.begin() + static_cast<ptrdiff_t>(index);
+    std::nth_element(values.begin(), nth, values.end());
+    return *nth;
+}
+
+size_t peakRssBytes()
+{
+#ifdef Q_OS_WIN
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#    ifdef Q_OS_MACOS
+    // macOS reports bytes
+    return static_cast<size_t>(usage.ru_maxrss);
+#    else
+    // Linux reports kilobytes
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#    endif
+#endif
+}
+
+/// Forwards everything to a channel while timing the filter and add stages
+class TimingSink : public MessageSink
+{
+public:
+    TimingSink(TwitchChannel &channel, StageLatencies &latencies,
+               const FilterRecord &filter)
+        : channel_(channel)
+        , latencies_(latencies)
+        , filter_(filter)
+    {
+    }
+
+    void addMessage(MessagePtr message, MessageContext ctx,
+                    std::optional<MessageFlags> overridingFlags) override
+    {
+        auto start = Clock::now();
+        auto context = filters::buildContextMap(message, &this->channel_);
+        benchmark::DoNotOptimize(this->filter_.filter(context));
+        auto filterTime = elapsedUs(start);
+        this->latencies_.filter.push_back(filterTime);
+
+        start = Clock::now();
+        this->channel_.addMessage(std::move(message), ctx, overridingFlags);
+        auto addTime = elapsedUs(start);
+        this->latencies_.add.push_back(addTime);
+
+        this->sinkTime += filterTime + addTime;
+    }
+
+    void addOrReplaceTimeout(MessagePtr clearchatMessage,
+                             const QDateTime &now) override
+    {
+        auto start = Clock::now();
+        this->channel_.addOrReplaceTimeout(std::move(clearchatMessage), now);
+        this->recordAdd(start);
+    }
+
+    void addOrReplaceClearChat(MessagePtr clearchatMessage,
+                               const QDateTime &now) override
+    {
+        auto start = Clock::now();
+        this->channel_.addOrReplaceClearChat(std::move(clearchatMessage), now);
+        this->recordAdd(start);
+    }
+
+    void disableAllMessages() override
+    {
+        auto start = Clock::now();
+        this->channel_.disableAllMessages();
+        this->recordAdd(start);
+    }
+
+    void applySimilarityFilters(const MessagePtr &message) const override
+    {
+        this->channel_.applySimilarityFilters(message);
+    }
+
+    MessagePtr findMessageByID(QStringView id) override
+    {
+        return this->channel_.findMessageByID(id);
+    }
+
+    MessageSinkTraits sinkTraits() const override
+    {
+        return this->channel_.sinkTraits();
+    }
+
+    /// Time spent in this sink since it was last reset, in microseconds
+    double sinkTime = 0;
+
+private:
+    void recordAdd(Clock::time_point start)
+    {
+        auto addTime = elapsedUs(start);
+        this->latencies_.add.push_back(addTime);
+        this->sinkTime += addTime;
+    }
+
+    TwitchChannel &channel_;
+    StageLatencies &latencies_;
+    const FilterRecord &filter_;
+};
+
+struct ReplayChannel {
+    ReplayChannel(const QString &name, StageLatencies &latencies,
+                  const FilterRecord &filter)
+        : channel(name)
+        , sink(this->channel, latencies, filter)
+    {
+        bench::loadChannelEmotes(this->channel, name);
+    }
+
+    TwitchChannel channel;
+    TimingSink sink;
+};
+
+/// @param speed Playback speed relative to the capture's timestamps, or 0 to
+///              replay as fast as possible
+void BM_Replay(benchmark::State &state, double speed)
+{
+    bench::MockApplication app;
+    const auto path = capturePath();
+    const auto loaded = loadCapture(path);
+    if (!loaded)
+    {
+        state.SkipWithError(
+            ("capture not found: " + path.toStdString()).c_str());
+        return;
+    }
+    const auto &capture = *loaded;
+    if (capture.empty())
+    {
+        state.SkipWithError("Capture is empty");
+        return;
+    }
+
+    FilterRecord filter(
+        u"replay"_s,
+        qEnvironmentVariable("CHATTERINO_REPLAY_FILTER",
+                             uR"(!(author.name contains "bot"))"_s));
+
+    StageLatencies latencies;
+    std::unordered_map<QString, std::unique_ptr<ReplayChannel>> channels;
+    for (const auto &line : capture)
+    {
+        auto &channel = channels[line.channel];
+        if (!channel)
+        {
+            channel = std::make_unique<ReplayChannel>(line.channel, latencies,
+                                                      filter);
+        }
+    }
+
+    const auto firstSentAt = capture.front().sentAt;
+    for (auto _ : state)
+    {
+        const auto replayStart = Clock::now();
+        size_t n = 0;
+        for (const auto &line : capture)
+        {
+            if (speed > 0 && line.sentAt > firstSentAt)
+            {
+                std::this_thread::sleep_until(
+                    replayStart +
+                    std::chrono::duration_cast<Clock::duration>(
+                        std::chrono::duration<double, std::milli>(
+                            static_cast<double>(line.sentAt - firstSentAt) /
+                            speed)));
+            }
+
+            auto start = Clock::now();
+            std::unique_ptr<Communi::IrcMessage> message(
+                Communi::IrcMessage::fromData(line.data, nullptr));
+            latencies.parse.push_back(elapsedUs(start));
+
+            auto &replay = *channels[line.channel];
+            replay.sink.sinkTime = 0;
+            start = Clock::now();
+            IrcMessageHandler::parseMessageInto(message.get(), replay.sink,
+                                                &replay.channel);
+            latencies.build.push_back(elapsedUs(start) - replay.sink.sinkTime);
+
+            // Give queued work (e.g. from signals) a chance to run, like the
+            // event loop would
+            if (++n % 100 == 0)
+            {
+                QCoreApplication::sendPostedEvents();
+            }
+        }
+        QCoreApplication::sendPostedEvents();
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(capture.size()));
+
+    auto addPercentiles = [&](const std::string &stage,
+                              std::vector<double> &values) {
+        for (const auto &[name, p] : PERCENTILES)
+        {
+            state.counters[stage + '_' + name + "_us"] = percentile(values, p);
+        }
+    };
+    addPercentiles("parse", latencies.parse);
+    addPercentiles("build", latencies.build);
+    addPercentiles("filter", latencies.filter);
+    addPercentiles("add", latencies.add);
+    state.counters["peakRSS"] =
+        benchmark::Counter(static_cast<double>(peakRssBytes()),
+                           benchmark::Counter::kDefaults,
+                           benchmark::Counter::kIs1024);
+
+    channels.clear();
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+// Registers the paced run if a speed was requested
+[[maybe_unused]] const bool PACED_REGISTERED = [] {
+    bool ok = false;
+    auto speed = qEnvironmentVariable("CHATTERINO_REPLAY_SPEED").toDouble(&ok);
+    if (!ok || speed <= 0)
+    {
+        return false;
+    }
+
+    benchmark::RegisterBenchmark("BM_Replay/paced", BM_Replay, speed)
+        ->Iterations(1)
+        ->UseRealTime()
+        ->Unit(benchmark::kMillisecond);
+    return true;
+}();
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_Replay, max_speed, 0.0)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,248 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "common/websockets/WebSocketPool.hpp"
+#include "mocks/BaseApplication.hpp"
+
+#include <benchmark/benchmark.h>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/websocket/stream.hpp>
+#include <QJsonDocument>
+#include <QString>
+#include <QUrl>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace chatterino;
+
+namespace {
+
+namespace asio = boost::asio;
+namespace beast = boost::beast;
+using tcp = asio::ip::tcp;
+
+constexpr size_t N_CONNECTIONS = 8;
+constexpr size_t FRAMES_PER_ROUND = 500;
+
+/// Roughly the size and shape of a 7TV emote-set dispatch
+std::string makePayload()
+{
+    std::string emotes;
+    for (int i = 0; i < 4; i++)
+    {
+        if (i > 0)
+        {
+            emotes += ',';
+        }
+        emotes += R"({"key":"emotes","index":)" + std::to_string(i) +
+                  R"(,"value":{"id":"01GB2S4A1000062QWW6NSZ5VN8","name":"x",)"
+                  R"("flags":0,"data":{"id":"01GB2S4A1000062QWW6NSZ5VN8",)"
+                  R"("name":"x","flags":0,"listed":true,"animated":false,)"
+                  R"("owner":{"display_name":"nerixyz"},"host":{"url":)"
+                  R"("//cdn.7tv.app/emote/01GB2S4A1000062QWW6NSZ5VN8",)"
+                  R"("files":[{"name":"1x.webp","width":28,"height":28}]}}})";
+    }
+    return R"({"op":0,"t":1700000000000,"d":{"type":"emote_set.update",)"
+           R"("body":{"id":"60b39e943e203cc169dfc106","actor":)"
+           R"({"display_name":"nerixyz"},"pushed":[)" +
+           emotes + "]}}}";
+}
+
+/// A websocket server on localhost that sends FRAMES_PER_ROUND frames to a
+/// client whenever it receives a message from it
+class LoopbackServer
+{
+public:
+    LoopbackServer()
+        : acceptor_(this->ioc_, {asio::ip::make_address("127.0.0.1"), 0})
+        , payload_(makePayload())
+    {
+        this->acceptThread_ = std::thread([this] {
+            for (size_t i = 0; i < N_CONNECTIONS; i++)
+            {
+                tcp::socket socket(this->ioc_);
+                boost::system::error_code ec;
+                this->acceptor_.accept(socket, ec);
+                if (ec)
+                {
+                    return;
+                }
+                this->sessions_.emplace_back(
+                    [this, socket{std::move(socket)}]() mutable {
+                        this->runSession(std::move(socket));
+                    });
+            }
+        });
+    }
+
+    ~LoopbackServer()
+    {
+        this->acceptThread_.join();
+        for (auto &session : this->sessions_)
+        {
+            session.join();
+        }
+    }
+
+    LoopbackServer(const LoopbackServer &) = delete;
+    LoopbackServer(LoopbackServer &&) = delete;
+    LoopbackServer &operator=(const LoopbackServer &) = delete;
+    LoopbackServer &operator=(LoopbackServer &&) = delete;
+
+    QUrl url() const
+    {
+        return QUrl("ws://127.0.0.1:" +
+                    QString::number(this->acceptor_.local_endpoint().port()) +
+                    "/");
+    }
+
+    size_t payloadSize() const
+    {
+        return this->payload_.size();
+    }
+
+private:
+    void runSession(tcp::socket socket)
+    {
+        beast::websocket::stream<tcp::socket> ws(std::move(socket));
+        boost::system::error_code ec;
+        ws.accept(ec);
+        beast::flat_buffer buffer;
+        while (!ec)
+        {
+            ws.read(buffer, ec);
+            buffer.consume(buffer.size());
+            ws.text(true);
+            for (size_t i = 0; i < FRAMES_PER_ROUND && !ec; i++)
+            {
+                ws.write(asio::buffer(this->payload_), ec);
+            }
+        }
+    }
+
+    asio::io_context ioc_;
+    tcp::acceptor acceptor_;
+    std::string payload_;
+    std::thread acceptThread_;
+    std::vector<std::thread> sessions_;
+};
+
+class Counter
+{
+public:
+    void increment()
+    {
+        {
+            std::lock_guard lock(this->mutex_);
+            this->count_++;
+        }
+        this->cv_.notify_all();
+    }
+
+    void waitFor(size_t count)
+    {
+        std::unique_lock lock(this->mutex_);
+        this->cv_.wait(lock, [&] {
+            return this->count_ >= count;
+        });
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    size_t count_ = 0;
+};
+
+/// Parses every message like the live-update clients do
+struct Listener : public WebSocketListener {
+    Listener(Counter &opened, Counter &received)
+        : opened(opened)
+        , received(received)
+    {
+    }
+
+    void onOpen() override
+    {
+        this->opened.increment();
+    }
+
+    void onTextMessage(QByteArray data) override
+    {
+        auto doc = QJsonDocument::fromJson(data);
+        benchmark::DoNotOptimize(doc);
+        this->received.increment();
+    }
+
+    void onBinaryMessage(QByteArray /* data */) override
+    {
+    }
+
+    void onClose(std::unique_ptr<WebSocketListener> /* self */) override
+    {
+    }
+
+    Counter &opened;
+    Counter &received;
+};
+
+void BM_WebSocketPoolThroughput(benchmark::State &state)
+{
+    mock::BaseApplication app;
+    LoopbackServer server;
+    Counter opened;
+    Counter received;
+
+    WebSocketPool pool({}, static_cast<size_t>(state.range(0)));
+    std::vector<WebSocketHandle> handles;
+    for (size_t i = 0; i < N_CONNECTIONS; i++)
+    {
+        handles.emplace_back(pool.createSocket(
+            {
+                .url = server.url(),
+                .headers = {},
+            },
+            std::make_unique<Listener>(opened, received)));
+    }
+    opened.waitFor(N_CONNECTIONS);
+
+    size_t expected = 0;
+    for (auto _ : state)
+    {
+        expected += N_CONNECTIONS * FRAMES_PER_ROUND;
+        for (auto &handle : handles)
+        {
+            handle.sendText("go");
+        }
+        received.waitFor(expected);
+    }
+
+    auto frames = static_cast<int64_t>(state.iterations()) *
+                  static_cast<int64_t>(N_CONNECTIONS * FRAMES_PER_ROUND);
+    state.SetItemsProcessed(frames);
+    state.SetBytesProcessed(frames *
+                            static_cast<int64_t>(server.payloadSize()));
+
+    std::chrono::nanoseconds callbackTime{0};
+    for (const auto &shard : pool.stats())
+    {
+        callbackTime += shard.callbackTime;
+    }
+    state.counters["callback_ns"] =
+        static_cast<double>(callbackTime.count()) /
+        static_cast<double>(frames);
+
+    handles.clear();
+}
+
+}  // namespace
+
+BENCHMARK(BM_WebSocketPoolThroughput)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
@@ -0,0 +1,211 @@
+// SPDX-FileCopyrightText: 2024 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "common/Literals.hpp"
+#include "controllers/accounts/AccountController.hpp"
+#include "controllers/highlights/HighlightController.hpp"
+#include "messages/Emote.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "mocks/DisabledStreamerMode.hpp"
+#include "mocks/EmoteController.hpp"
+#include "mocks/LinkResolver.hpp"
+#include "mocks/Logging.hpp"
+#include "mocks/TwitchIrcServer.hpp"
+#include "mocks/UserData.hpp"
+#include "providers/bttv/BttvBadges.hpp"
+#include "providers/bttv/BttvEmotes.hpp"
+#include "providers/chatterino/ChatterinoBadges.hpp"
+#include "providers/ffz/FfzBadges.hpp"
+#include "providers/ffz/FfzEmotes.hpp"
+#include "providers/seventv/SeventvBadges.hpp"
+#include "providers/seventv/SeventvEmotes.hpp"
+#include "providers/twitch/TwitchBadges.hpp"
+#include "providers/twitch/TwitchChannel.hpp"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QString>
+
+#include <optional>
+
+namespace chatterino::bench {
+
+/// Application with everything needed to build Twitch messages like the real
+/// application does
+class MockApplication : public mock::BaseApplication
+{
+public:
+    MockApplication()
+        : highlights(this->settings, &this->accounts)
+    {
+    }
+
+    EmoteController *getEmotes() override
+    {
+        return &this->emotes;
+    }
+
+    IUserDataController *getUserData() override
+    {
+        return &this->userData;
+    }
+
+    AccountController *getAccounts() override
+    {
+        return &this->accounts;
+    }
+
+    ITwitchIrcServer *getTwitch() override
+    {
+        return &this->twitch;
+    }
+
+    ChatterinoBadges *getChatterinoBadges() override
+    {
+        return &this->chatterinoBadges;
+    }
+
+    FfzBadges *getFfzBadges() override
+    {
+        return &this->ffzBadges;
+    }
+
+    BttvBadges *getBttvBadges() override
+    {
+        return &this->bttvBadges;
+    }
+
+    SeventvBadges *getSeventvBadges() override
+    {
+        return &this->seventvBadges;
+    }
+
+    HighlightController *getHighlights() override
+    {
+        return &this->highlights;
+    }
+
+    TwitchBadges *getTwitchBadges() override
+    {
+        return &this->twitchBadges;
+    }
+
+    BttvEmotes *getBttvEmotes() override
+    {
+        return &this->bttvEmotes;
+    }
+
+    FfzEmotes *getFfzEmotes() override
+    {
+        return &this->ffzEmotes;
+    }
+
+    SeventvEmotes *getSeventvEmotes() override
+    {
+        return &this->seventvEmotes;
+    }
+
+    IStreamerMode *getStreamerMode() override
+    {
+        return &this->streamerMode;
+    }
+
+    ILinkResolver *getLinkResolver() override
+    {
+        return &this->linkResolver;
+    }
+
+    ILogging *getChatLogger() override
+    {
+        return &this->logging;
+    }
+
+    mock::EmptyLogging logging;
+    AccountController accounts;
+    mock::EmoteController emotes;
+    mock::UserDataController userData;
+    mock::MockTwitchIrcServer twitch;
+    mock::EmptyLinkResolver linkResolver;
+    ChatterinoBadges chatterinoBadges;
+    FfzBadges ffzBadges;
+    BttvBadges bttvBadges;
+    SeventvBadges seventvBadges;
+    HighlightController highlights;
+    TwitchBadges twitchBadges;
+    BttvEmotes bttvEmotes;
+    FfzEmotes ffzEmotes;
+    SeventvEmotes seventvEmotes;
+    DisabledStreamerMode streamerMode;
+};
+
+inline std::optional<QJsonDocument> tryReadJsonFile(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QFile::ReadOnly))
+    {
+        return std::nullopt;
+    }
+
+    QJsonParseError e;
+    auto doc = QJsonDocument::fromJson(file.readAll(), &e);
+    if (e.error != QJsonParseError::NoError)
+    {
+        return std::nullopt;
+    }
+
+    return doc;
+}
+
+inline QJsonDocument readJsonFile(const QString &path)
+{
+    auto opt = tryReadJsonFile(path);
+    if (!opt)
+    {
+        _exit(1);
+    }
+    return *opt;
+}
+
+
+/// Loads the bundled 7TV, BTTV and FFZ emotes for `name` into `channel`
+///
+/// Missing resources are skipped.
+inline void loadChannelEmotes(TwitchChannel &channel, const QString &name)
+{
+    using namespace literals;
+
+    const auto seventvEmotes =
+        tryReadJsonFile(u":/bench/seventvemotes-%1.json"_s.arg(name));
+    const auto bttvEmotes =
+        tryReadJsonFile(u":/bench/bttvemotes-%1.json"_s.arg(name));
+    const auto ffzEmotes =
+        tryReadJsonFile(u":/bench/ffzemotes-%1.json"_s.arg(name));
+
+    if (seventvEmotes)
+    {
+        channel.setSeventvEmotes(
+            std::make_shared<const EmoteMap>(seventv::detail::parseEmotes(
+                seventvEmotes->object()["emote_set"_L1]
+                    .toObject()["emotes"_L1]
+                    .toArray(),
+                false)));
+    }
+
+    if (bttvEmotes)
+    {
+        channel.setBttvEmotes(std::make_shared<const EmoteMap>(
+            bttv::detail::parseChannelEmotes(bttvEmotes->object(), name)));
+    }
+
+    if (ffzEmotes)
+    {
+        channel.setFfzEmotes(std::make_shared<const EmoteMap>(
+            ffz::detail::parseChannelEmotes(ffzEmotes->object())));
+    }
+}
+
+}  // namespace chatterino::bench
@@ -61,6 +61,7 @@ declare namespace c2 {
         get_display_name(): string;
 
         on_display_name_changed(cb: () => void): ConnectionHandle;
+        on_messages(cb: (messages: Message[]) => void): ConnectionHandle;
 
         send_message(message: string, execute_commands: boolean): void;
         send_message(message: string): void;
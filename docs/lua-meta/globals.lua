@@ -250,6 +250,15 @@ function c2.Channel:__tostring() end
 ---@return c2.ConnectionHandle hdl
 function c2.Channel:on_display_name_changed(cb) end
 
+--- Callback when messages are added to the channel.
+--- Messages are delivered in batches of up to 100 messages, at most once
+--- per frame. Each call may run a limited number of instructions. Handlers
+--- exceeding this budget are throttled and miss messages.
+---
+---@param cb fun(messages: c2.Message[])
+---@return c2.ConnectionHandle hdl
+function c2.Channel:on_messages(cb) end
+
 --- Finds a channel by name.
 --- Misc channels are marked as Twitch:
 --- - /whispers
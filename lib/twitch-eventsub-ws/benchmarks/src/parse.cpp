@@ -2,10 +2,13 @@
 #include "twitch-eventsub-ws/session.hpp"
 
 #include <benchmark/benchmark.h>
+#include <boost/beast/core/buffers_to_string.hpp>
 #include <boost/beast/core/flat_buffer.hpp>
+#include <boost/json.hpp>
 #include <QFile>
 
 #include <memory>
+#include <vector>
 
 namespace {
 
@@ -187,6 +190,54 @@ void BM_ParseAndHandleMessages(benchmark::State &state)
     }
 }
 
+/// How frames used to be parsed: copied into a string and parsed into a DOM
+/// allocated from the heap
+void BM_ParseFramesCopy(benchmark::State &state)
+{
+    auto messages = readMessages();
+
+    for (auto _ : state)
+    {
+        for (const auto &msg : messages)
+        {
+            boost::system::error_code ec;
+            auto jv = boost::json::parse(
+                boost::beast::buffers_to_string(msg.data()), ec);
+            assert(!ec);
+            benchmark::DoNotOptimize(&jv);
+        }
+    }
+}
+
+/// How Session parses frames: straight from the buffer into a reused arena
+void BM_ParseFramesArena(benchmark::State &state)
+{
+    auto messages = readMessages();
+
+    boost::json::stream_parser parser;
+    std::vector<unsigned char> arena(64 * 1024);
+
+    for (auto _ : state)
+    {
+        for (const auto &msg : messages)
+        {
+            const auto data = msg.data();
+            boost::json::monotonic_resource resource(arena.data(),
+                                                     arena.size());
+            boost::system::error_code ec;
+            parser.reset(&resource);
+            parser.write(static_cast<const char *>(data.data()), data.size(),
+                         ec);
+            parser.finish(ec);
+            assert(!ec);
+            auto jv = parser.release();
+            benchmark::DoNotOptimize(&jv);
+        }
+    }
+}
+
 }  // namespace
 
 BENCHMARK(BM_ParseAndHandleMessages);
+BENCHMARK(BM_ParseFramesCopy);
+BENCHMARK(BM_ParseFramesArena);
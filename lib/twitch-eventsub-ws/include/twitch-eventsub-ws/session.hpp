@@ -9,6 +9,8 @@
 #include <boost/beast/websocket/ssl.hpp>
 #include <boost/json.hpp>
 
+#include <vector>
+
 namespace chatterino::eventsub::lib::messages {
 
 struct Metadata;
@@ -78,6 +80,13 @@ private:
     std::string userAgent;
     std::unique_ptr<Listener> listener;
 
+    /// Parses frames straight from the read buffer. Its internal buffers are
+    /// kept between frames.
+    boost::json::stream_parser parser;
+    /// Backing memory for the JSON of the frame that's currently handled.
+    /// It's reused for every frame.
+    std::vector<unsigned char> frameArena;
+
     std::chrono::seconds keepaliveTimeout{0};
     bool receivedMessage = false;
     std::unique_ptr<boost::asio::system_timer> keepaliveTimer;
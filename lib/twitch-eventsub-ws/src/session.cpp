@@ -14,6 +14,7 @@
 #include <boost/container_hash/hash.hpp>
 #include <boost/json.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <unordered_map>
@@ -53,6 +54,12 @@ using NotificationHandlers = std::unordered_map<
 
 namespace {
 
+/// The DOM of a frame takes up a few times the size of its text
+constexpr size_t FRAME_ARENA_FACTOR = 4;
+constexpr size_t MIN_FRAME_ARENA_SIZE = 4096;
+/// Larger frames fall back to allocating from the heap
+constexpr size_t MAX_FRAME_ARENA_SIZE = 1024 * 1024;
+
 template <class T>
 boost::system::result<T> parsePayload(const boost::json::value &jv)
 {
@@ -472,14 +479,34 @@ void Session::fail(beast::error_code ec, std::string_view op)
 boost::system::error_code Session::handleMessage(
     const beast::flat_buffer &buffer)
 {
+    // The DOM only lives until the frame is handled (payloads copy what they
+    // need), so it's allocated from an arena that's reused for every frame.
+    const auto data = buffer.data();
+    auto arenaSize = std::clamp(data.size() * FRAME_ARENA_FACTOR,
+                                MIN_FRAME_ARENA_SIZE, MAX_FRAME_ARENA_SIZE);
+    if (this->frameArena.size() < arenaSize)
+    {
+        this->frameArena.resize(arenaSize);
+    }
+    boost::json::monotonic_resource resource(this->frameArena.data(),
+                                             this->frameArena.size());
+
     boost::system::error_code parseError;
-    auto jv =
-        boost::json::parse(beast::buffers_to_string(buffer.data()), parseError);
+    this->parser.reset(&resource);
+    this->parser.write(static_cast<const char *>(data.data()), data.size(),
+                       parseError);
+    if (!parseError)
+    {
+        this->parser.finish(parseError);
+    }
     if (parseError)
     {
+        // free the partial result while the arena is still alive
+        this->parser.reset();
         // TODO: wrap error?
         return parseError;
     }
+    auto jv = this->parser.release();
 
     const auto *jvObject = jv.if_object();
     if (jvObject == nullptr)
@@ -166,3 +166,34 @@ TEST_P(TestHandleMessageP, Run)
 
 INSTANTIATE_TEST_SUITE_P(HandleMessage, TestHandleMessageP,
                          testing::ValuesIn(discover()));
+
+TEST(HandleMessage, ReuseSession)
+{
+    auto log = std::make_shared<NullLogger>();
+    std::unique_ptr<Listener> listener = std::make_unique<NoOpListener>();
+    boost::asio::io_context ioc;
+    boost::asio::ssl::context ssl(
+        boost::asio::ssl::context::method::tls_client);
+    auto sess = std::make_shared<Session>(ioc, ssl, std::move(listener), log);
+
+    std::string_view truncated = R"({"metadata": {"message_id": )";
+    boost::beast::flat_buffer invalid;
+    auto inner = invalid.prepare(truncated.size());
+    std::memcpy(inner.data(), truncated.data(), inner.size());
+    invalid.commit(inner.size());
+
+    // The frame arena is reused, make sure nothing leaks into the next frame
+    for (int i = 0; i < 2; i++)
+    {
+        for (const auto &name : discover())
+        {
+            auto buf = readToFlatBuffer(filePath(name + ".json"));
+            auto ec = sess->handleMessage(buf);
+            ASSERT_FALSE(ec.failed())
+                << name << ": " << ec.what() << ec.message()
+                << ec.location().to_string();
+        }
+
+        ASSERT_TRUE(sess->handleMessage(invalid).failed());
+    }
+}
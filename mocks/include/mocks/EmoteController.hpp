@@ -16,6 +16,10 @@ public:
     void initialize() override
     {
     }
+
+    void finishInitialize() override
+    {
+    }
 };
 
 }  // namespace chatterino::mock
@@ -23,6 +23,16 @@ public:
         return std::nullopt;
     }
 
+    std::optional<QColor> getUserColor(const QString &userID) const override
+    {
+        auto it = this->userMap.find(userID);
+        if (it != this->userMap.end())
+        {
+            return it->second.color;
+        }
+        return std::nullopt;
+    }
+
     // Update or insert extra data for the user's color override
     void setUserColor(const QString &userID,
                       const QString &colorString) override
@@ -31,11 +31,13 @@
 #    include "controllers/plugins/PluginController.hpp"
 #endif
 #include "controllers/emotes/EmoteController.hpp"
+#include "controllers/emotes/EmoteSnapshot.hpp"
 #include "controllers/sound/MiniaudioBackend.hpp"
 #include "controllers/sound/NullBackend.hpp"
 #include "controllers/twitch/LiveController.hpp"
 #include "controllers/userdata/UserDataController.hpp"
 #include "debug/AssertInGuiThread.hpp"
+#include "debug/StartupProfiler.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "providers/bttv/BttvLiveUpdates.hpp"
@@ -69,6 +71,7 @@
 #include <miniaudio.h>
 #include <QApplication>
 #include <QDesktopServices>
+#include <QTimer>
 
 namespace {
 
@@ -218,10 +221,12 @@ Application::~Application()
     INSTANCE = nullptr;
 }
 
-void Application::initialize(Settings &settings, const Paths &paths)
+void Application::initialize(Settings &settings)
 {
     assert(!this->initialized);
 
+    StartupProfiler::Phase initializePhase("Application::initialize");
+
     // Show changelog
     if (!this->args_.isFramelessEmbed &&
         getSettings()->currentVersion.getValue() != "" &&
@@ -242,30 +247,50 @@ void Application::initialize(Settings &settings, const Paths &paths)
     {
         getSettings()->currentVersion.setValue(CHATTERINO_VERSION);
     }
-    this->emotes->initialize();
 
-    this->accounts->load();
-
-    this->windows->initialize();
+    // Read the cached global emotes while the windows are created. They're
+    // picked up in initializeDeferred().
+    if (settings.enableBTTVGlobalEmotes)
+    {
+        prefetchEmoteSnapshot("global", "betterttv");
+    }
+    if (settings.enableFFZGlobalEmotes)
+    {
+        prefetchEmoteSnapshot("global", "frankerfacez");
+    }
+    if (settings.enableSevenTVGlobalEmotes)
+    {
+        prefetchEmoteSnapshot("global", "seventv");
+    }
 
-    this->ffzBadges->load();
+    // The emoji data is parsed in the background until finishInitialize()
+    this->emotes->initialize();
 
-    // Load global emotes
-    this->bttvEmotes->loadEmotes();
-    this->ffzEmotes->loadEmotes();
-    this->seventvEmotes->loadGlobalEmotes();
+    {
+        StartupProfiler::Phase phase("accounts");
+        this->accounts->load();
+    }
 
-    this->twitch->initialize();
+    {
+        StartupProfiler::Phase phase("windows");
+        this->windows->initialize();
+    }
 
-    // Load live status
-    this->notifications->initialize();
+    {
+        StartupProfiler::Phase phase("emojis");
+        this->emotes->finishInitialize();
+    }
 
-    // XXX: Loading Twitch badges after Helix has been initialized, which only happens after
-    // the AccountController initialize has been called
-    this->twitchBadges->loadTwitchBadges();
+    {
+        StartupProfiler::Phase phase("twitch");
+        this->twitch->initialize();
+    }
 
 #ifdef CHATTERINO_HAVE_PLUGINS
-    this->plugins->initialize(settings);
+    {
+        StartupProfiler::Phase phase("plugins");
+        this->plugins->initialize(settings);
+    }
 #endif
 
     // Show crash message.
@@ -293,11 +318,6 @@ void Application::initialize(Settings &settings, const Paths &paths)
     }
 #endif
 
-    if (!this->args_.isFramelessEmbed)
-    {
-        this->initNm(paths);
-    }
-
     this->twitch->initEventAPIs(this->bttvLiveUpdates.get(),
                                 this->seventvEventAPI.get());
 
@@ -306,6 +326,30 @@ void Application::initialize(Settings &settings, const Paths &paths)
     this->initialized = true;
 }
 
+void Application::initializeDeferred()
+{
+    StartupProfiler::Phase phase("Application::initializeDeferred");
+
+    this->ffzBadges->load();
+
+    // Load global emotes
+    this->bttvEmotes->loadEmotes();
+    this->ffzEmotes->loadEmotes();
+    this->seventvEmotes->loadGlobalEmotes();
+
+    // Load live status
+    this->notifications->initialize();
+
+    // XXX: Loading Twitch badges after Helix has been initialized, which only happens after
+    // the AccountController initialize has been called
+    this->twitchBadges->loadTwitchBadges();
+
+    if (!this->args_.isFramelessEmbed)
+    {
+        this->initNm(this->paths_);
+    }
+}
+
 int Application::run()
 {
     assert(this->initialized);
@@ -316,6 +360,15 @@ int Application::run()
     {
         this->windows->getMainWindow().show();
     }
+    StartupProfiler::instance().mark("main window shown");
+
+    // Nothing in here is needed to show the windows, so it runs once the
+    // event loop started. The first network responses can't arrive before
+    // that, so they still see the global emotes and badges.
+    QTimer::singleShot(0, [this] {
+        this->initializeDeferred();
+        StartupProfiler::instance().report();
+    });
 
     getSettings()->enableBTTVChannelEmotes.connect(
         [this] {
@@ -632,6 +685,7 @@ void Application::aboutToQuit()
 
     this->hotkeys->save();
     this->windows->save();
+    this->userData->save();
 
     this->windows->closeAll();
 }
@@ -143,7 +143,7 @@ public:
         return false;
     }
 
-    void initialize(Settings &settings, const Paths &paths);
+    void initialize(Settings &settings);
     void load();
     void aboutToQuit();
     void stop();
@@ -244,6 +244,8 @@ public:
     SpellChecker *getSpellChecker() override;
 
 private:
+    /// Loads everything that isn't needed to show the windows
+    void initializeDeferred();
     void initNm(const Paths &paths);
 
     std::unique_ptr<NativeMessagingServer> nmServer;
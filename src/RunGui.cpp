@@ -9,6 +9,7 @@
 #include "common/Modes.hpp"
 #include "common/network/NetworkManager.hpp"
 #include "common/QLogging.hpp"
+#include "debug/StartupProfiler.hpp"
 #include "singletons/CrashHandler.hpp"
 #include "singletons/Paths.hpp"
 #include "singletons/Resources.hpp"
@@ -287,7 +288,8 @@ void runGui(QApplication &a, const Paths &paths, Settings &settings,
     });
 
     Application app(settings, paths, args, updates);
-    app.initialize(settings, paths);
+    StartupProfiler::instance().mark("application created");
+    app.initialize(settings);
     app.run();
 
     chatterino::NetworkManager::deinit();
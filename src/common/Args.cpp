@@ -121,6 +121,11 @@ Args::Args(const QApplication &app, const Paths &paths)
         "safe-mode", "Starts Chatterino without loading Plugins and always "
                      "show the settings button.");
 
+    QCommandLineOption startupProfileOption(
+        "startup-profile",
+        "Logs how long each phase of the startup took once Chatterino "
+        "finished starting.");
+
     QCommandLineOption loginOption(
         "login",
         "Starts Chatterino logged in as the account matching the supplied "
@@ -159,6 +164,7 @@ Args::Args(const QApplication &app, const Paths &paths)
         parentWindowIdOption,
         verboseOption,
         safeModeOption,
+        startupProfileOption,
         loginOption,
         channelLayout,
         activateOption,
@@ -218,6 +224,8 @@ Args::Args(const QApplication &app, const Paths &paths)
         this->safeMode = true;
     }
 
+    this->startupProfile = parser.isSet(startupProfileOption);
+
     if (parser.isSet(loginOption))
     {
         this->initialLogin = parser.value(loginOption);
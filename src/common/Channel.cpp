@@ -5,6 +5,7 @@
 #include "common/Channel.hpp"
 
 #include "Application.hpp"
+#include "messages/ColdMessageStore.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "messages/MessageSimilarity.hpp"
@@ -28,6 +29,17 @@ Channel::Channel(const QString &name, Type type)
     {
         this->platform_ = "twitch";
     }
+
+    // Channels without a type are only used to show messages of other
+    // channels (e.g. search results), so they don't need to keep any history
+    auto coldLimit = getSettings()->scrollbackColdLimit.getValue();
+    if (coldLimit > 0 && type != Type::None)
+    {
+        this->coldMessages_ = std::make_unique<ColdMessageStore>(
+            static_cast<size_t>(coldLimit), [this](const QByteArray &ircData) {
+                return this->rebuildMessage(ircData);
+            });
+    }
 }
 
 Channel::~Channel()
@@ -79,6 +91,22 @@ size_t Channel::countMessages() const
     return this->messages_.size();
 }
 
+bool Channel::hasOlderMessages() const
+{
+    return this->coldMessages_ && this->coldMessages_->size() > 0;
+}
+
+std::vector<MessagePtr> Channel::findOlderMessages(
+    const std::function<bool(const MessagePtr &)> &predicate,
+    const QDateTime &before, size_t limit) const
+{
+    if (!this->coldMessages_)
+    {
+        return {};
+    }
+    return this->coldMessages_->find(predicate, before, limit);
+}
+
 std::vector<MessagePtr> Channel::getMessageSnapshot() const
 {
     return this->messages_.getSnapshot();
@@ -132,6 +160,10 @@ void Channel::addMessage(MessagePtr message, MessageContext context,
 
     if (this->messages_.pushBack(message, deleted))
     {
+        if (this->coldMessages_)
+        {
+            this->coldMessages_->push(*deleted);
+        }
         this->messageRemovedFromStart(deleted);
     }
 
@@ -146,21 +178,44 @@ void Channel::addSystemMessage(const QString &contents)
 
 void Channel::addOrReplaceTimeout(MessagePtr message, const QDateTime &now)
 {
+    // Only the last 20 messages are checked for stacking, so we don't need to
+    // copy the whole buffer. The new message is added after the messages of
+    // the timed out user are disabled.
+    MessagePtr toAdd;
     addOrReplaceChannelTimeout(
-        this->getMessageSnapshot(), std::move(message), now,
+        this->getMessageSnapshot(TIMEOUT_STACK_WINDOW), message, now,
         [this](auto /*idx*/, auto msg, auto replacement) {
             this->replaceMessage(msg, replacement);
         },
-        [this](auto msg) {
-            this->addMessage(msg, MessageContext::Original);
+        [&toAdd](auto msg) {
+            toAdd = std::move(msg);
         },
-        true);
+        false);
+
+    bool disabledAny = false;
+    this->messages_.visit([&](const auto &messages) {
+        for (const auto &s : messages)
+        {
+            bool wasDisabled = s->flags.has(MessageFlag::Disabled);
+            disableTimedOutMessage(s, message->timeoutUser);
+            disabledAny |= !wasDisabled && s->flags.has(MessageFlag::Disabled);
+        }
+    });
+    if (disabledAny)
+    {
+        this->messagesDisabled.invoke();
+    }
+
+    if (toAdd)
+    {
+        this->addMessage(toAdd, MessageContext::Original);
+    }
 }
 
 void Channel::addOrReplaceClearChat(MessagePtr message, const QDateTime &now)
 {
     addOrReplaceChannelClear(
-        this->getMessageSnapshot(20), std::move(message), now,
+        this->getMessageSnapshot(TIMEOUT_STACK_WINDOW), std::move(message), now,
         [this](auto /*idx*/, auto msg, auto replacement) {
             this->replaceMessage(msg, replacement);
         },
@@ -171,16 +226,20 @@ void Channel::addOrReplaceClearChat(MessagePtr message, const QDateTime &now)
 
 void Channel::disableAllMessages()
 {
-    for (const auto &message : this->getMessageSnapshot())
-    {
-        if (message->flags.hasAny({MessageFlag::System, MessageFlag::Timeout,
-                                   MessageFlag::Whisper}))
+    this->messages_.visit([](const auto &messages) {
+        for (const auto &message : messages)
         {
-            continue;
-        }
+            if (message->flags.hasAny({MessageFlag::System,
+                                       MessageFlag::Timeout,
+                                       MessageFlag::Whisper}))
+            {
+                continue;
+            }
 
-        message->flags.set(MessageFlag::Disabled);
-    }
+            message->flags.set(MessageFlag::Disabled);
+        }
+    });
+    this->messagesDisabled.invoke();
 }
 
 void Channel::addMessagesAtStart(const std::vector<MessagePtr> &_messages)
@@ -210,8 +269,12 @@ void Channel::fillInMissingMessages(const std::vector<MessagePtr> &messages)
         msg->freeze();
     }
 
-    auto snapshot = this->getMessageSnapshot();
-    if (snapshot.size() == 0)
+    // Keep track of the last message in the channel. We need this value
+    // to allow concurrent appends to the end of the channel while still
+    // being able to insert just-loaded historical messages at the end
+    // in the correct place.
+    auto lastMsg = this->messages_.last();
+    if (!lastMsg)
     {
         // There are no messages in this channel yet so we can just insert them
         // at the front in order
@@ -220,27 +283,25 @@ void Channel::fillInMissingMessages(const std::vector<MessagePtr> &messages)
         return;
     }
 
-    std::unordered_set<QString> existingMessageIds;
-    existingMessageIds.reserve(snapshot.size());
-
     // First, collect the ids of every message already present in the channel
-    for (const auto &msg : snapshot)
-    {
-        if (msg->flags.has(MessageFlag::System) || msg->id.isEmpty())
-        {
-            continue;
-        }
+    auto existingMessageIds =
+        this->messages_.visit([](const auto &existing) {
+            std::unordered_set<QString> ids;
+            ids.reserve(existing.size());
+            for (const auto &msg : existing)
+            {
+                if (msg->flags.has(MessageFlag::System) || msg->id.isEmpty())
+                {
+                    continue;
+                }
 
-        existingMessageIds.insert(msg->id);
-    }
+                ids.insert(msg->id);
+            }
+            return ids;
+        });
 
     bool anyInserted = false;
 
-    // Keep track of the last message in the channel. We need this value
-    // to allow concurrent appends to the end of the channel while still
-    // being able to insert just-loaded historical messages at the end
-    // in the correct place.
-    auto lastMsg = snapshot[snapshot.size() - 1];
     for (const auto &msg : messages)
     {
         // check if message already exists
@@ -252,32 +313,23 @@ void Channel::fillInMissingMessages(const std::vector<MessagePtr> &messages)
         // If we get to this point, we know we'll be inserting a message
         anyInserted = true;
 
-        bool insertedFlag = false;
-        for (const auto &snapshotMsg : snapshot)
-        {
-            if (snapshotMsg->flags.has(MessageFlag::System))
-            {
-                continue;
-            }
-
-            if (msg->serverReceivedTime < snapshotMsg->serverReceivedTime)
-            {
-                // We found the first message that comes after the current message.
-                // Therefore, we can put the current message directly before. We
-                // assume that the messages we are filling in are in ascending
-                // order by serverReceivedTime.
-                this->messages_.insertBefore(snapshotMsg, msg);
-                insertedFlag = true;
-                break;
-            }
-        }
+        // Find the first message that comes after the current message.
+        // We can put the current message directly before it. We assume that
+        // the messages we are filling in are in ascending order by
+        // serverReceivedTime, so previously filled in messages never match.
+        bool insertedFlag = this->messages_.insertBeforeIf(
+            [&](const MessagePtr &existing) {
+                return !existing->flags.has(MessageFlag::System) &&
+                       msg->serverReceivedTime < existing->serverReceivedTime;
+            },
+            msg);
 
         if (!insertedFlag)
         {
             // We never found a message already in the channel that came after
             // the current message. Put it at the end and make sure to update
             // which message is considered "the end".
-            this->messages_.insertAfter(lastMsg, msg);
+            this->messages_.insertAfter(*lastMsg, msg);
             lastMsg = msg;
         }
     }
@@ -331,12 +383,17 @@ void Channel::disableMessage(const QString &messageID)
     if (msg != nullptr)
     {
         msg->flags.set(MessageFlag::Disabled);
+        this->messagesDisabled.invoke();
     }
 }
 
 void Channel::clearMessages()
 {
     this->messages_.clear();
+    if (this->coldMessages_)
+    {
+        this->coldMessages_->clear();
+    }
     this->messagesCleared.invoke();
 }
 
@@ -357,7 +414,9 @@ MessagePtr Channel::findMessageByID(QStringView messageID)
 
 void Channel::applySimilarityFilters(const MessagePtr &message) const
 {
-    setSimilarityFlags(message, this->messages_.getSnapshot());
+    this->messages_.visit([&](const auto &messages) {
+        setSimilarityFlags(message, messages);
+    });
 }
 
 MessageSinkTraits Channel::sinkTraits() const
@@ -450,6 +509,11 @@ void Channel::messageRemovedFromStart(const MessagePtr &msg)
 {
 }
 
+MessagePtr Channel::rebuildMessage(const QByteArray & /*ircData*/)
+{
+    return nullptr;
+}
+
 //
 // Indirect channel
 //
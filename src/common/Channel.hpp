@@ -12,15 +12,20 @@
 
 #include <magic_enum/magic_enum.hpp>
 #include <pajlada/signals/signal.hpp>
+#include <QByteArray>
 #include <QDate>
+#include <QDateTime>
 #include <QString>
 #include <QTimer>
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 
 namespace chatterino {
 
+class ColdMessageStore;
 struct Message;
 using MessagePtr = std::shared_ptr<const Message>;
 using MessagePtrMut = std::shared_ptr<Message>;
@@ -71,6 +76,9 @@ public:
     pajlada::Signals::Signal<const std::vector<MessagePtr> &> filledInMessages;
     pajlada::Signals::NoArgSignal displayNameChanged;
     pajlada::Signals::NoArgSignal messagesCleared;
+    /// Invoked when messages that were already added got disabled (e.g. by a
+    /// timeout or a deletion)
+    pajlada::Signals::NoArgSignal messagesDisabled;
 
     Type getType() const;
     const QString &getName() const;
@@ -92,6 +100,16 @@ public:
     /// messages, this will return an empty shared pointer.
     MessagePtr getLastMessage() const;
 
+    /// Calls `cb` with a view of all messages (see LimitedQueue::visit)
+    /// without copying them.
+    ///
+    /// The messages are locked while `cb` runs, so `cb` must not modify
+    /// this channel.
+    decltype(auto) visitMessages(auto &&cb) const
+    {
+        return this->messages_.visit(std::forward<decltype(cb)>(cb));
+    }
+
     // MESSAGES
     // overridingFlags can be filled in with flags that should be used instead
     // of the message's flags. This is useful in case a flag is specific to a
@@ -125,6 +143,21 @@ public:
 
     size_t countMessages() const;
 
+    /// Returns true if messages that were removed from the start of the
+    /// buffer are kept (see #findOlderMessages())
+    bool hasOlderMessages() const;
+
+    /// @brief Finds messages that were removed from the start of the buffer
+    ///
+    /// If the "scrollbackColdLimit" setting is set, messages are kept in a
+    /// compact form after they were removed (see ColdMessageStore). This
+    /// rebuilds the newest `limit` ones received before `before` that
+    /// `predicate` returns true for, oldest first. Messages in the buffer
+    /// aren't included.
+    std::vector<MessagePtr> findOlderMessages(
+        const std::function<bool(const MessagePtr &)> &predicate,
+        const QDateTime &before = {}, size_t limit = SIZE_MAX) const;
+
     void applySimilarityFilters(const MessagePtr &message) const final;
 
     MessageSinkTraits sinkTraits() const final;
@@ -152,11 +185,16 @@ public:
 protected:
     virtual void onConnected();
     virtual void messageRemovedFromStart(const MessagePtr &msg);
+    /// Builds a message from the IRC message it was built from before (see
+    /// Message::ircData). Returns nullptr if it can't be built.
+    virtual MessagePtr rebuildMessage(const QByteArray &ircData);
     QString platform_;
 
 private:
     const QString name_;
     LimitedQueue<MessagePtr> messages_;
+    /// Messages removed from the start of `messages_` (nullptr if disabled)
+    std::unique_ptr<ColdMessageStore> coldMessages_;
     Type type_;
     bool anythingLogged_ = false;
     QTimer clearCompletionModelTimer_;
@@ -6,6 +6,9 @@
 
 #include "debug/Benchmark.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 namespace chatterino {
 
 ChatterSet::ChatterSet()
@@ -15,7 +18,17 @@ ChatterSet::ChatterSet()
 
 void ChatterSet::addRecentChatter(const QString &userName)
 {
-    this->items.put(userName.toLower(), userName);
+    auto lowerName = userName.toLower();
+    if (!this->items.exists(lowerName) &&
+        this->items.size() >= ChatterSet::CHATTER_LIMIT)
+    {
+        // The least recently used chatter is about to be evicted
+        this->sortedItems.erase(std::prev(this->items.end())->first);
+    }
+
+    this->items.put(lowerName, userName);
+    this->sortedItems.insert_or_assign(
+        std::move(lowerName), IndexEntry{userName, this->nextUse++});
 }
 
 void ChatterSet::updateOnlineChatters(
@@ -41,6 +54,15 @@ void ChatterSet::updateOnlineChatters(
     }
 
     this->items = std::move(tmp);
+
+    // Keep the order of the new cache (most recent first)
+    this->sortedItems.clear();
+    auto lastUsed = this->nextUse + this->items.size();
+    for (const auto &[lowerName, userName] : this->items)
+    {
+        this->sortedItems.emplace(lowerName, IndexEntry{userName, --lastUsed});
+    }
+    this->nextUse += this->items.size();
 }
 
 bool ChatterSet::contains(const QString &userName) const
@@ -50,15 +72,37 @@ bool ChatterSet::contains(const QString &userName) const
 
 std::vector<QString> ChatterSet::filterByPrefix(const QString &prefix) const
 {
-    QString lowerPrefix = prefix.toLower();
     std::vector<QString> result;
+    for (auto &&item : this->allWithPrefix(prefix))
+    {
+        result.push_back(std::move(item.second));
+    }
+
+    return result;
+}
+
+std::vector<std::pair<QString, QString>> ChatterSet::allWithPrefix(
+    const QString &prefix) const
+{
+    QString lowerPrefix = prefix.toLower();
 
-    for (auto &&item : this->items)
+    std::vector<std::pair<const QString *, const IndexEntry *>> matches;
+    for (auto it = this->sortedItems.lower_bound(lowerPrefix);
+         it != this->sortedItems.end() && it->first.startsWith(lowerPrefix);
+         ++it)
     {
-        if (item.first.startsWith(lowerPrefix))
-        {
-            result.push_back(item.second);
-        }
+        matches.emplace_back(&it->first, &it->second);
+    }
+
+    std::ranges::sort(matches, [](const auto &a, const auto &b) {
+        return a.second->lastUsed > b.second->lastUsed;
+    });
+
+    std::vector<std::pair<QString, QString>> result;
+    result.reserve(matches.size());
+    for (const auto &[lowerName, entry] : matches)
+    {
+        result.emplace_back(*lowerName, entry->userName);
     }
 
     return result;
@@ -9,7 +9,10 @@
 #include <lrucache/lrucache.hpp>
 #include <QString>
 
+#include <cstdint>
+#include <map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace chatterino {
@@ -40,13 +43,27 @@ public:
     /// are in mixed case if available.
     std::vector<QString> filterByPrefix(const QString &prefix) const;
 
+    /// Get recent chatters whose name starts with `prefix` (case-insensitive),
+    /// most recent first. Pairs are in the same format as in `all()`.
+    std::vector<std::pair<QString, QString>> allWithPrefix(
+        const QString &prefix) const;
+
     /// Get all recent chatters. The first pair element contains the username
     /// in lowercase, while the second pair element is the original case.
     std::vector<std::pair<QString, QString>> all() const;
 
 private:
+    struct IndexEntry {
+        QString userName;
+        /// Higher values were used more recently
+        uint64_t lastUsed;
+    };
+
     // user name in lower case -> user name in normal case
     cache::lru_cache<QString, QString> items;
+    // The same users sorted by their lower case name for prefix lookups
+    std::map<QString, IndexEntry> sortedItems;
+    uint64_t nextUse = 0;
 };
 
 using ChatterSet = ChatterSet;
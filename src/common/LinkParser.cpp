@@ -6,24 +6,64 @@
 #include "common/LinkParser.hpp"
 
 #include "common/QLogging.hpp"
-#include "util/QCompareTransparent.hpp"
 
 #include <QFile>
 #include <QString>
 #include <QStringView>
 #include <QTextStream>
 
-#include <set>
+#include <unordered_set>
 
 namespace {
 
 using namespace chatterino;
 
-using TldSet = std::set<QString, QCompareCaseInsensitive>;
+/// Case-folds ASCII characters without going through QChar's tables
+Q_ALWAYS_INLINE char16_t foldCase(char16_t c)
+{
+    if (c < 0x80)
+    {
+        return (u'A' <= c && c <= u'Z') ? char16_t(c + (u'a' - u'A')) : c;
+    }
+    return static_cast<char16_t>(QChar::toCaseFolded(char32_t{c}));
+}
+
+/// Case insensitive hash, consistent with comparing using Qt::CaseInsensitive
+struct TldHash {
+    using is_transparent = void;
+
+    size_t operator()(QStringView tld) const noexcept
+    {
+        // FNV-1a
+        size_t hash = 14695981039346656037ULL;
+        for (auto c : tld)
+        {
+            hash ^= foldCase(c.unicode());
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+};
+
+struct TldEqual {
+    using is_transparent = void;
+
+    bool operator()(QStringView a, QStringView b) const noexcept
+    {
+        return a.size() == b.size() && a.compare(b, Qt::CaseInsensitive) == 0;
+    }
+};
 
-TldSet &tlds()
+struct TldSet {
+    std::unordered_set<QString, TldHash, TldEqual> tlds;
+    /// Length of the longest TLD, longer candidates can be rejected without
+    /// hashing them
+    qsizetype maxLength = 0;
+};
+
+const TldSet &tlds()
 {
-    static TldSet tlds = [] {
+    static const TldSet tlds = [] {
         QFile file(QStringLiteral(":/tlds.txt"));
         bool ok = file.open(QFile::ReadOnly);
         if (!ok)
@@ -40,10 +80,15 @@ TldSet &tlds()
 #endif
 
         TldSet set;
+        // There are about 1600 TLDs, keep the load factor low so lookups
+        // rarely have to compare more than one entry
+        set.tlds.reserve(4096);
 
         while (!stream.atEnd())
         {
-            set.emplace(stream.readLine());
+            auto tld = stream.readLine();
+            set.maxLength = std::max(set.maxLength, tld.size());
+            set.tlds.emplace(std::move(tld));
         }
 
         return set;
@@ -53,7 +98,31 @@ TldSet &tlds()
 
 bool isValidTld(QStringView tld)
 {
-    return tlds().contains(tld);
+    const auto &set = tlds();
+    if (tld.size() > set.maxLength)
+    {
+        return false;
+    }
+    return set.tlds.contains(tld);
+}
+
+/// @brief Checks if @a source could contain a link at all
+///
+/// Every link has a host with a dot that's neither its first nor its last
+/// character, so words without a dot in [1, length - 2] can be rejected
+/// before stripping and validating them. Almost all words in chat are
+/// rejected here.
+///
+/// QStringView::indexOf is vectorized by Qt (SSE2/AVX2 or NEON with a scalar
+/// fallback), so this is a single fast pass over the word.
+Q_ALWAYS_INLINE bool mayContainLink(QStringView source)
+{
+    if (source.size() < 3)
+    {
+        return false;
+    }
+    auto dot = source.indexOf(u'.', 1);
+    return dot != -1 && dot < source.size() - 1;
 }
 
 bool isValidIpv4(QStringView host)
@@ -181,6 +250,11 @@ std::optional<Parsed> parse(QStringView source) noexcept
     std::optional<Parsed> result;
     // This is not implemented with a regex to increase performance.
 
+    if (!mayContainLink(source))
+    {
+        return result;
+    }
+
     QStringView link{source};
     strip(link);
 
@@ -6,6 +6,7 @@
 
 #include <QString>
 
+#include <cstdint>
 #include <functional>
 #include <vector>
 
@@ -30,6 +31,16 @@ enum class NetworkRequestType {
     Patch,
 };
 
+/// Order in which queued requests to the same host are sent
+enum class NetworkRequestPriority : uint8_t {
+    /// Images that are about to be shown
+    VisibleImage,
+    /// Message history (e.g. recent messages)
+    History,
+    /// Everything else (emote sets, badges, user info, ...)
+    Metadata,
+};
+
 // parseHeaderList takes a list of headers in string form,
 // where each header pair is separated by semicolons (;) and the header name and value is divided by a colon (:)
 //
@@ -7,6 +7,7 @@
 #include "Application.hpp"
 #include "common/network/NetworkManager.hpp"
 #include "common/network/NetworkResult.hpp"
+#include "common/network/NetworkScheduler.hpp"
 #include "common/network/NetworkTask.hpp"
 #include "common/QLogging.hpp"
 #include "singletons/Paths.hpp"
@@ -50,15 +51,13 @@ void loadUncached(std::shared_ptr<NetworkData> &&data)
 {
     DebugCount::increase(DebugObject::HTTPRequestStarted);
 
-    NetworkRequester requester;
     auto *worker = new NetworkTask(std::move(data));
 
     worker->moveToThread(NetworkManager::workerThread);
 
-    QObject::connect(&requester, &NetworkRequester::requestUrl, worker,
-                     &NetworkTask::run);
-
-    requester.requestUrl();
+    QMetaObject::invokeMethod(worker, [worker] {
+        NetworkScheduler::instance().submit(worker);
+    });
 }
 
 void loadCached(std::shared_ptr<NetworkData> &&data)
@@ -22,14 +22,6 @@ namespace chatterino {
 
 class NetworkResult;
 
-class NetworkRequester : public QObject
-{
-    Q_OBJECT
-
-Q_SIGNALS:
-    void requestUrl();
-};
-
 class NetworkData
 {
 public:
@@ -51,6 +43,7 @@ public:
     NetworkFinallyCallback finally;
 
     NetworkRequestType requestType = NetworkRequestType::Get;
+    NetworkRequestPriority priority = NetworkRequestPriority::Metadata;
 
     QByteArray payload;
     std::unique_ptr<QHttpMultiPart, DeleteLater> multiPartPayload;
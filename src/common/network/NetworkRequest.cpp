@@ -44,6 +44,12 @@ NetworkRequest NetworkRequest::type(NetworkRequestType newRequestType) &&
     return std::move(*this);
 }
 
+NetworkRequest NetworkRequest::priority(NetworkRequestPriority priority) &&
+{
+    this->data->priority = priority;
+    return std::move(*this);
+}
+
 NetworkRequest NetworkRequest::caller(const QObject *caller) &&
 {
     if (caller)
@@ -46,6 +46,9 @@ public:
     ~NetworkRequest();
 
     NetworkRequest type(NetworkRequestType newRequestType) &&;
+    /// Sets the priority of this request relative to other queued requests
+    /// to the same host. Defaults to NetworkRequestPriority::Metadata.
+    NetworkRequest priority(NetworkRequestPriority priority) &&;
 
     NetworkRequest onError(NetworkErrorCallback cb) &&;
     NetworkRequest onSuccess(NetworkSuccessCallback cb) &&;
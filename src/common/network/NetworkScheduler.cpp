@@ -0,0 +1,267 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "common/network/NetworkScheduler.hpp"
+
+#include "common/network/NetworkPrivate.hpp"
+#include "common/network/NetworkTask.hpp"
+#include "common/QLogging.hpp"
+#include "util/DebugCount.hpp"
+
+#include <QStringBuilder>
+#include <QTimer>
+#include <QUrl>
+
+#include <algorithm>
+
+namespace {
+
+using namespace chatterino;
+using namespace chatterino::network::detail;
+using namespace std::chrono_literals;
+
+/// APIs with rate limits
+///
+/// At most `budget` requests are started within one `cooldown`, so the
+/// sustained rate is budget / cooldown and a burst can be up to `budget`.
+///
+/// - Helix allows 800 points per minute and most requests cost one point.
+///   12 requests per second are 720 per minute, which leaves some points for
+///   other clients that use the same token.
+/// - 7TV, BTTV and FFZ don't document a limit. 20 requests per second only
+///   smooth out bursts (e.g. when joining many channels at once).
+const std::unordered_map<QString, HostLimits> HOST_LIMITS{
+    {"api.twitch.tv", {.maxConcurrent = 6, .budget = 12, .cooldown = 1s}},
+    {"7tv.io", {.maxConcurrent = 6, .budget = 20, .cooldown = 1s}},
+    {"api.betterttv.net", {.maxConcurrent = 6, .budget = 20, .cooldown = 1s}},
+    {"api.frankerfacez.com",
+     {.maxConcurrent = 6, .budget = 20, .cooldown = 1s}},
+};
+
+/// Returns the key under which identical requests are coalesced, or an empty
+/// array if the request must be sent on its own
+QByteArray coalescingKey(const NetworkData &data)
+{
+    // Other methods aren't idempotent
+    if (data.requestType != NetworkRequestType::Get || data.multiPartPayload)
+    {
+        return {};
+    }
+
+    QByteArray key = data.typeString().toUtf8() % ' ' %
+                     data.request.url().toEncoded() % '\n';
+    for (const auto &header : data.request.rawHeaderList())
+    {
+        key += header % ": " % data.request.rawHeader(header) % '\n';
+    }
+    key += data.payload;
+    return key;
+}
+
+size_t queueIndex(NetworkRequestPriority priority)
+{
+    return static_cast<size_t>(priority);
+}
+
+}  // namespace
+
+namespace chatterino::network::detail {
+
+std::mutex NetworkScheduler::debugMutex;
+QString NetworkScheduler::debugText_;
+
+HostLimits hostLimitsFor(const QString &host)
+{
+    auto it = HOST_LIMITS.find(host);
+    if (it != HOST_LIMITS.end())
+    {
+        return it->second;
+    }
+    return {};
+}
+
+NetworkScheduler &NetworkScheduler::instance()
+{
+    // Created on (and owned by) the worker thread. It's never destroyed, as
+    // the thread is gone by the time static objects are destroyed.
+    static auto *scheduler = new NetworkScheduler;
+    return *scheduler;
+}
+
+void NetworkScheduler::submit(NetworkTask *task)
+{
+    const auto &data = task->data();
+
+    auto key = coalescingKey(*data);
+    if (!key.isEmpty())
+    {
+        auto it = this->pending_.find(key);
+        if (it != this->pending_.end())
+        {
+            auto *leader = it->second;
+            qCDebug(chatterinoHTTP).noquote()
+                << data->typeString() << "[coalesced]"
+                << data->request.url().toString();
+            DebugCount::increase(DebugObject::HTTPRequestCoalesced);
+
+            // A queued request might have to move up
+            if (data->priority < leader->data()->priority &&
+                !leader->isRunning())
+            {
+                auto &host = this->host(leader->host());
+                auto &oldQueue =
+                    host.queues[queueIndex(leader->data()->priority)];
+                std::erase(oldQueue, leader);
+                host.queues[queueIndex(data->priority)].push_back(leader);
+                leader->data()->priority = data->priority;
+            }
+
+            leader->addFollower(data);
+            task->deleteLater();
+            return;
+        }
+
+        task->setCoalescingKey(key);
+        this->pending_.emplace(std::move(key), task);
+    }
+
+    auto &host = this->host(task->host());
+    host.queues[queueIndex(data->priority)].push_back(task);
+    DebugCount::increase(DebugObject::HTTPRequestQueued);
+
+    this->pump(task->host());
+
+    if (!task->isRunning())
+    {
+        task->startQueueTimeout();
+    }
+}
+
+void NetworkScheduler::cancel(NetworkTask *task)
+{
+    if (!task->coalescingKey().isEmpty())
+    {
+        this->pending_.erase(task->coalescingKey());
+    }
+
+    auto &host = this->host(task->host());
+    for (auto &queue : host.queues)
+    {
+        if (std::erase(queue, task) > 0)
+        {
+            DebugCount::decrease(DebugObject::HTTPRequestQueued);
+        }
+    }
+
+    this->updateDebugText();
+}
+
+void NetworkScheduler::finished(NetworkTask *task)
+{
+    if (!task->coalescingKey().isEmpty())
+    {
+        this->pending_.erase(task->coalescingKey());
+    }
+
+    auto &host = this->host(task->host());
+    host.inFlight--;
+    DebugCount::decrease(DebugObject::HTTPRequestInFlight);
+
+    this->pump(task->host());
+}
+
+QString NetworkScheduler::debugText()
+{
+    std::lock_guard lock(debugMutex);
+    return debugText_;
+}
+
+NetworkScheduler::Host &NetworkScheduler::host(const QString &name)
+{
+    auto it = this->hosts_.find(name);
+    if (it == this->hosts_.end())
+    {
+        auto limits = hostLimitsFor(name);
+        it = this->hosts_
+                 .emplace(name, Host{
+                                    .limits = limits,
+                                    .tokens = limits.budget,
+                                })
+                 .first;
+    }
+    return it->second;
+}
+
+void NetworkScheduler::pump(const QString &name)
+{
+    auto &host = this->host(name);
+
+    while (host.limits.maxConcurrent == 0 ||
+           host.inFlight < host.limits.maxConcurrent)
+    {
+        if (host.limits.budget > 0 && host.tokens <= 0)
+        {
+            // The cooldown timer will pump again
+            break;
+        }
+
+        auto queue = std::ranges::find_if(host.queues, [](const auto &q) {
+            return !q.empty();
+        });
+        if (queue == host.queues.end())
+        {
+            break;
+        }
+
+        auto *task = queue->front();
+        queue->pop_front();
+        DebugCount::decrease(DebugObject::HTTPRequestQueued);
+
+        if (host.limits.budget > 0)
+        {
+            host.tokens--;
+            QTimer::singleShot(host.limits.cooldown, this, [this, name] {
+                this->host(name).tokens++;
+                this->pump(name);
+            });
+        }
+
+        host.inFlight++;
+        DebugCount::increase(DebugObject::HTTPRequestInFlight);
+        task->run();
+    }
+
+    this->updateDebugText();
+}
+
+void NetworkScheduler::updateDebugText()
+{
+    QString text;
+    for (const auto &[name, host] : this->hosts_)
+    {
+        size_t queued = 0;
+        for (const auto &queue : host.queues)
+        {
+            queued += queue.size();
+        }
+        if (queued == 0 && host.inFlight == 0)
+        {
+            continue;
+        }
+
+        text += name % ": " % QString::number(host.inFlight) % " in flight, " %
+                QString::number(queued) % " queued";
+        if (host.limits.budget > 0)
+        {
+            text += ", " % QString::number(host.tokens) % '/' %
+                    QString::number(host.limits.budget) % " tokens";
+        }
+        text += '\n';
+    }
+
+    std::lock_guard lock(debugMutex);
+    debugText_ = std::move(text);
+}
+
+}  // namespace chatterino::network::detail
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "common/network/NetworkCommon.hpp"
+
+#include <QByteArray>
+#include <QObject>
+#include <QString>
+
+#include <array>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace chatterino::network::detail {
+
+class NetworkTask;
+
+struct HostLimits {
+    /// Maximum number of requests to this host that run at the same time. 0
+    /// means there's no limit.
+    int maxConcurrent = 0;
+    /// Number of requests that can be started in a burst. 0 means there's no
+    /// rate limit.
+    int budget = 0;
+    /// Time it takes for a used up request to be put back into the budget
+    std::chrono::milliseconds cooldown{0};
+};
+
+/// Returns the limits for requests to `host`
+///
+/// Only the APIs we're rate limited by have limits. Requests to other hosts
+/// (e.g. image CDNs, which mostly use HTTP/2) are started right away.
+HostLimits hostLimitsFor(const QString &host);
+
+/// Decides when requests are sent
+///
+/// - Identical GET requests that are queued or running at the same time are
+///   only sent once.
+/// - Requests are queued per host and started according to the host's
+///   HostLimits, in order of their NetworkRequestPriority.
+/// - Requests with a timeout fail if they're still queued once it expired.
+///
+/// Apart from debugText(), the scheduler must only be used from the network
+/// worker thread.
+class NetworkScheduler : public QObject
+{
+public:
+    static NetworkScheduler &instance();
+
+    /// Queues `task` or attaches it to an identical request
+    ///
+    /// If the task was attached, it's deleted.
+    void submit(NetworkTask *task);
+
+    /// Must be called by a task that was started once it's done
+    void finished(NetworkTask *task);
+
+    /// Removes `task` from its queue before it was started
+    void cancel(NetworkTask *task);
+
+    /// Returns the queue state of all hosts with pending requests
+    static QString debugText();
+
+private:
+    NetworkScheduler() = default;
+
+    struct Host {
+        HostLimits limits;
+        std::array<std::deque<NetworkTask *>, 3> queues;
+        int inFlight = 0;
+        /// Only used if limits.budget isn't 0
+        int tokens = 0;
+    };
+
+    Host &host(const QString &name);
+    /// Starts as many queued tasks of `name` as its limits allow
+    void pump(const QString &name);
+    void updateDebugText();
+
+    std::unordered_map<QString, Host> hosts_;
+    /// Coalescing key -> task that sends the request
+    std::unordered_map<QByteArray, NetworkTask *> pending_;
+
+    static std::mutex debugMutex;
+    static QString debugText_;
+};
+
+}  // namespace chatterino::network::detail
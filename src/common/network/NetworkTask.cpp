@@ -8,6 +8,7 @@
 #include "common/network/NetworkManager.hpp"
 #include "common/network/NetworkPrivate.hpp"
 #include "common/network/NetworkResult.hpp"
+#include "common/network/NetworkScheduler.hpp"
 #include "common/QLogging.hpp"
 #include "singletons/Paths.hpp"
 #include "util/AbandonObject.hpp"
@@ -34,9 +35,18 @@ NetworkTask::~NetworkTask()
 
 void NetworkTask::run()
 {
+    if (this->timer_)
+    {
+        // Replaced by the timeout of the request
+        delete this->timer_;
+        this->timer_ = nullptr;
+    }
+
+    this->running_ = true;
     this->reply_ = this->createReply();
     if (!this->reply_)
     {
+        NetworkScheduler::instance().finished(this);
         this->deleteLater();
         return;
     }
@@ -77,6 +87,59 @@ void NetworkTask::run()
 #endif
 }
 
+void NetworkTask::startQueueTimeout()
+{
+    const auto &timeout = this->data_->timeout;
+    if (!timeout.has_value())
+    {
+        return;
+    }
+
+    this->timer_ = new QTimer(this);
+    this->timer_->setSingleShot(true);
+    this->timer_->start(timeout.value());
+    QObject::connect(this->timer_, &QTimer::timeout, this, [this] {
+        AbandonObject guard(this);
+        NetworkScheduler::instance().cancel(this);
+
+        qCDebug(chatterinoHTTP).noquote()
+            << this->data_->typeString() << "[timed out in queue]"
+            << this->data_->request.url().toString();
+
+        this->emitError({NetworkResult::NetworkError::TimeoutError, {}, {}});
+    });
+}
+
+const std::shared_ptr<NetworkData> &NetworkTask::data() const
+{
+    return this->data_;
+}
+
+QString NetworkTask::host() const
+{
+    return this->data_->request.url().host();
+}
+
+bool NetworkTask::isRunning() const
+{
+    return this->running_;
+}
+
+void NetworkTask::addFollower(std::shared_ptr<NetworkData> data)
+{
+    this->followers_.emplace_back(std::move(data));
+}
+
+const QByteArray &NetworkTask::coalescingKey() const
+{
+    return this->coalescingKey_;
+}
+
+void NetworkTask::setCoalescingKey(QByteArray key)
+{
+    this->coalescingKey_ = std::move(key);
+}
+
 QNetworkReply *NetworkTask::createReply()
 {
     const auto &data = this->data_;
@@ -189,9 +252,32 @@ void NetworkTask::writeToCache(const QByteArray &bytes) const
     });
 }
 
+void NetworkTask::emitSuccess(NetworkResult &&result)
+{
+    for (const auto &follower : this->followers_)
+    {
+        follower->emitSuccess(NetworkResult(result));
+        follower->emitFinally();
+    }
+    this->data_->emitSuccess(std::move(result));
+    this->data_->emitFinally();
+}
+
+void NetworkTask::emitError(NetworkResult &&result)
+{
+    for (const auto &follower : this->followers_)
+    {
+        follower->emitError(NetworkResult(result));
+        follower->emitFinally();
+    }
+    this->data_->emitError(std::move(result));
+    this->data_->emitFinally();
+}
+
 void NetworkTask::timeout()
 {
     AbandonObject guard(this);
+    NetworkScheduler::instance().finished(this);
 
     // prevent abort() from calling finished()
     QObject::disconnect(this->reply_, &QNetworkReply::finished, this,
@@ -202,13 +288,13 @@ void NetworkTask::timeout()
         << this->data_->typeString() << "[timed out]"
         << this->data_->request.url().toString();
 
-    this->data_->emitError({NetworkResult::NetworkError::TimeoutError, {}, {}});
-    this->data_->emitFinally();
+    this->emitError({NetworkResult::NetworkError::TimeoutError, {}, {}});
 }
 
 void NetworkTask::finished()
 {
     AbandonObject guard(this);
+    NetworkScheduler::instance().finished(this);
 
     if (this->timer_)
     {
@@ -230,8 +316,7 @@ void NetworkTask::finished()
     if (reply->error() != QNetworkReply::NoError)
     {
         this->logReply();
-        this->data_->emitError({reply->error(), status, reply->readAll()});
-        this->data_->emitFinally();
+        this->emitError({reply->error(), status, reply->readAll()});
 
         return;
     }
@@ -245,8 +330,7 @@ void NetworkTask::finished()
 
     DebugCount::increase(DebugObject::HTTPRequestSuccess);
     this->logReply();
-    this->data_->emitSuccess({reply->error(), status, bytes});
-    this->data_->emitFinally();
+    this->emitSuccess({reply->error(), status, bytes});
 }
 
 }  // namespace chatterino::network::detail
@@ -4,16 +4,20 @@
 
 #pragma once
 
+#include <QByteArray>
 #include <QObject>
+#include <QString>
 #include <QTimer>
 
 #include <memory>
+#include <vector>
 
 class QNetworkReply;
 
 namespace chatterino {
 
 class NetworkData;
+class NetworkResult;
 
 }  // namespace chatterino
 
@@ -32,17 +36,39 @@ public:
     NetworkTask &operator=(const NetworkTask &) = delete;
     NetworkTask &operator=(NetworkTask &&) = delete;
 
-    // NOLINTNEXTLINE(readability-redundant-access-specifiers)
-public Q_SLOTS:
+    /// Sends the request. Tasks are started by the NetworkScheduler.
     void run();
 
+    /// Fails the request if it wasn't started within its timeout
+    ///
+    /// Called by the NetworkScheduler when the task has to wait in a queue.
+    /// Once the request is sent, the timeout starts again.
+    void startQueueTimeout();
+
+    const std::shared_ptr<NetworkData> &data() const;
+    QString host() const;
+    bool isRunning() const;
+
+    /// Makes `data` receive the result of this task's request
+    void addFollower(std::shared_ptr<NetworkData> data);
+
+    const QByteArray &coalescingKey() const;
+    void setCoalescingKey(QByteArray key);
+
 private:
     QNetworkReply *createReply();
 
     void logReply();
     void writeToCache(const QByteArray &bytes) const;
 
+    void emitSuccess(NetworkResult &&result);
+    void emitError(NetworkResult &&result);
+
     std::shared_ptr<NetworkData> data_;
+    /// Identical requests that were submitted while this one was pending
+    std::vector<std::shared_ptr<NetworkData>> followers_;
+    QByteArray coalescingKey_;
+    bool running_ = false;
     QNetworkReply *reply_{};  // parent: default (accessManager)
     QTimer *timer_{};         // parent: this
 
@@ -10,8 +10,9 @@
 
 namespace chatterino {
 
-WebSocketPool::WebSocketPool(QString shortName)
-    : shortName(std::move(shortName)) {};
+WebSocketPool::WebSocketPool(QString shortName, size_t nThreads)
+    : shortName(std::move(shortName))
+    , nThreads(nThreads) {};
 
 WebSocketPool::~WebSocketPool()
 {
@@ -41,7 +42,7 @@ WebSocketHandle WebSocketPool::createSocket(
         try
         {
             this->impl = std::make_unique<ws::detail::WebSocketPoolImpl>(
-                this->shortName);
+                this->shortName, this->nThreads);
         }
         catch (const boost::system::system_error &err)
         {
@@ -57,38 +58,46 @@ WebSocketHandle WebSocketPool::createSocket(
         return {{}};
     }
 
-    std::shared_ptr<ws::detail::WebSocketConnection> conn;
+    bool isTls = options.url.scheme() == "wss";
+    if (!isTls && options.url.scheme() != "ws")
+    {
+        qCWarning(chatterinoWebsocket) << "Invalid scheme:" << options.url;
+        return {{}};
+    }
 
-    if (options.url.scheme() == "wss")
+    auto &shard = this->impl->acquireShard();
+    std::shared_ptr<ws::detail::WebSocketConnection> conn;
+    if (isTls)
     {
         conn = std::make_shared<ws::detail::TlsWebSocketConnection>(
             std::move(options), this->impl->nextID++, std::move(listener),
-            this->impl.get(), this->impl->ioc, this->impl->ssl);
+            this->impl.get(), shard, this->impl->ssl);
     }
-    else if (options.url.scheme() == "ws")
+    else
     {
         conn = std::make_shared<ws::detail::TcpWebSocketConnection>(
             std::move(options), this->impl->nextID++, std::move(listener),
-            this->impl.get(), this->impl->ioc);
-    }
-    else
-    {
-        qCWarning(chatterinoWebsocket) << "Invalid scheme:" << options.url;
-        return {{}};
+            this->impl.get(), shard);
     }
 
-    {
-        std::unique_lock guard(this->impl->connectionMutex);
-        this->impl->connections.push_back(conn);
-    }
+    this->impl->addConnection(conn);
 
-    boost::asio::post(this->impl->ioc, [conn] {
+    boost::asio::post(shard.ioc, [conn] {
         conn->run();
     });
 
     return {conn};
 }
 
+std::vector<WebSocketShardStats> WebSocketPool::stats() const
+{
+    if (!this->impl)
+    {
+        return {};
+    }
+    return this->impl->stats();
+}
+
 // MARK: WebSocketHandle
 
 WebSocketHandle::WebSocketHandle(
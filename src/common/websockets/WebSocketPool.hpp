@@ -8,7 +8,10 @@
 #include <QString>
 #include <QUrl>
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace chatterino::ws::detail {
 class WebSocketPoolImpl;
@@ -76,18 +79,39 @@ struct WebSocketOptions {
     std::vector<std::pair<std::string, std::string>> headers;
 };
 
+/// Counters of a single IO-thread of a pool since it was started
+///
+/// Divide by `uptime` to get rates.
+struct WebSocketShardStats {
+    size_t connections = 0;
+    uint64_t bytesReceived = 0;
+    uint64_t framesReceived = 0;
+    /// Total time spent in the listeners' message callbacks. Divide by
+    /// `framesReceived` to get the average callback latency.
+    std::chrono::nanoseconds callbackTime{0};
+    std::chrono::milliseconds uptime{0};
+};
+
 class WebSocketPool
 {
 public:
-    WebSocketPool(QString shortName = {});
+    /// @param nThreads The number of IO-threads. New connections are put on
+    ///                 the thread with the fewest connections. Listeners of
+    ///                 different connections may be called concurrently if
+    ///                 this is greater than one.
+    WebSocketPool(QString shortName = {}, size_t nThreads = 1);
     ~WebSocketPool();
 
     [[nodiscard]] WebSocketHandle createSocket(
         WebSocketOptions options, std::unique_ptr<WebSocketListener> listener);
 
+    /// Statistics for every IO-thread (empty if no socket was created yet)
+    std::vector<WebSocketShardStats> stats() const;
+
 private:
     std::unique_ptr<ws::detail::WebSocketPoolImpl> impl;
     QString shortName;
+    size_t nThreads;
 };
 
 }  // namespace chatterino
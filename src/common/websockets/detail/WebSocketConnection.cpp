@@ -14,11 +14,12 @@ namespace chatterino::ws::detail {
 WebSocketConnection::WebSocketConnection(
     WebSocketOptions options, int id,
     std::unique_ptr<WebSocketListener> listener, WebSocketPoolImpl *pool,
-    boost::asio::io_context &ioc)
+    WebSocketShard &shard)
     : options(std::move(options))
     , listener(std::move(listener))
     , pool(pool)
-    , resolver(boost::asio::make_strand(ioc))
+    , shard_(&shard)
+    , resolver(boost::asio::make_strand(shard.ioc))
     , id(id)
 {
     qCDebug(chatterinoWebsocket) << *this << "Created";
@@ -30,6 +31,11 @@ WebSocketConnection::~WebSocketConnection()
     qCDebug(chatterinoWebsocket) << *this << "Destroyed";
 }
 
+WebSocketShard &WebSocketConnection::shard() const
+{
+    return *this->shard_;
+}
+
 QDebug operator<<(QDebug dbg, const WebSocketConnection &conn)
 {
     QDebugStateSaver state(dbg);
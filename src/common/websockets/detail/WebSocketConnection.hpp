@@ -19,6 +19,7 @@
 namespace chatterino::ws::detail {
 
 class WebSocketPoolImpl;
+struct WebSocketShard;
 
 /// A base class for a WebSocket connection.
 ///
@@ -28,7 +29,7 @@ class WebSocketConnection
 public:
     WebSocketConnection(WebSocketOptions options, int id,
                         std::unique_ptr<WebSocketListener> listener,
-                        WebSocketPoolImpl *pool, boost::asio::io_context &ioc);
+                        WebSocketPoolImpl *pool, WebSocketShard &shard);
     virtual ~WebSocketConnection();
 
     WebSocketConnection(const WebSocketConnection &) = delete;
@@ -56,6 +57,9 @@ public:
     /// Can be called from any thread.
     virtual void sendBinary(const QByteArray &data) = 0;
 
+    /// The shard this connection runs on
+    WebSocketShard &shard() const;
+
 protected:
     /// Reset and notify the parent and listener (if possible).
     ///
@@ -69,6 +73,8 @@ protected:
     std::unique_ptr<WebSocketListener> listener;
     // nullable, used for signalling a disconnect
     WebSocketPoolImpl *pool;
+    // non-null, outlives this connection
+    WebSocketShard *shard_;
 
     boost::asio::ip::tcp::resolver resolver;
 
@@ -6,6 +6,7 @@
 
 #include "common/QLogging.hpp"
 #include "common/Version.hpp"
+#include "common/websockets/detail/WebSocketPoolImpl.hpp"
 
 #include <boost/asio/strand.hpp>
 #include <boost/beast/core/bind_handler.hpp>
@@ -24,9 +25,9 @@ template <typename Derived, typename Inner>
 WebSocketConnectionHelper<Derived, Inner>::WebSocketConnectionHelper(
     WebSocketOptions options, int id,
     std::unique_ptr<WebSocketListener> listener, WebSocketPoolImpl *pool,
-    asio::io_context &ioc, Stream stream)
+    WebSocketShard &shard, Stream stream)
     : WebSocketConnection(std::move(options), id, std::move(listener), pool,
-                          ioc)
+                          shard)
     , stream(std::move(stream))
 {
 }
@@ -265,6 +266,7 @@ void WebSocketConnectionHelper<Derived, Inner>::onReadDone(
     };
     this->readBuffer.consume(bytesRead);
 
+    auto start = std::chrono::steady_clock::now();
     if (this->stream.got_text())
     {
         this->listener->onTextMessage(std::move(data));
@@ -273,6 +275,16 @@ void WebSocketConnectionHelper<Derived, Inner>::onReadDone(
     {
         this->listener->onBinaryMessage(std::move(data));
     }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    this->shard_->bytesReceived.fetch_add(bytesRead,
+                                          std::memory_order::relaxed);
+    this->shard_->framesReceived.fetch_add(1, std::memory_order::relaxed);
+    this->shard_->callbackNanos.fetch_add(
+        static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                .count()),
+        std::memory_order::relaxed);
 
     this->stream.async_read(
         this->readBuffer,
@@ -378,9 +390,10 @@ void WebSocketConnectionHelper<Derived, Inner>::fail(std::string_view ec,
 TlsWebSocketConnection::TlsWebSocketConnection(
     WebSocketOptions options, int id,
     std::unique_ptr<WebSocketListener> listener, WebSocketPoolImpl *pool,
-    asio::io_context &ioc, asio::ssl::context &ssl)
+    WebSocketShard &shard, asio::ssl::context &ssl)
     : WebSocketConnectionHelper(std::move(options), id, std::move(listener),
-                                pool, ioc, Stream{asio::make_strand(ioc), ssl})
+                                pool, shard,
+                                Stream{asio::make_strand(shard.ioc), ssl})
 {
 }
 
@@ -424,9 +437,10 @@ void TlsWebSocketConnection::afterTcpHandshake()
 TcpWebSocketConnection::TcpWebSocketConnection(
     WebSocketOptions options, int id,
     std::unique_ptr<WebSocketListener> listener, WebSocketPoolImpl *pool,
-    asio::io_context &ioc)
+    WebSocketShard &shard)
     : WebSocketConnectionHelper(std::move(options), id, std::move(listener),
-                                pool, ioc, Stream{asio::make_strand(ioc)})
+                                pool, shard,
+                                Stream{asio::make_strand(shard.ioc)})
 {
 }
 
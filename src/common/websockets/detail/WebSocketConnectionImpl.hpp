@@ -57,8 +57,8 @@ private:
     // This is private to ensure only `Derived` can construct this class.
     WebSocketConnectionHelper(WebSocketOptions options, int id,
                               std::unique_ptr<WebSocketListener> listener,
-                              WebSocketPoolImpl *pool,
-                              boost::asio::io_context &ioc, Stream stream);
+                              WebSocketPoolImpl *pool, WebSocketShard &shard,
+                              Stream stream);
 
     void onResolve(boost::system::error_code ec,
                    const boost::asio::ip::tcp::resolver::results_type &results);
@@ -100,8 +100,7 @@ public:
 
     TlsWebSocketConnection(WebSocketOptions options, int id,
                            std::unique_ptr<WebSocketListener> listener,
-                           WebSocketPoolImpl *pool,
-                           boost::asio::io_context &ioc,
+                           WebSocketPoolImpl *pool, WebSocketShard &shard,
                            boost::asio::ssl::context &ssl);
 
 protected:
@@ -123,8 +122,7 @@ public:
 
     TcpWebSocketConnection(WebSocketOptions options, int id,
                            std::unique_ptr<WebSocketListener> listener,
-                           WebSocketPoolImpl *pool,
-                           boost::asio::io_context &ioc);
+                           WebSocketPoolImpl *pool, WebSocketShard &shard);
 
 protected:
     void afterTcpHandshake();
@@ -7,17 +7,26 @@
 #include "Application.hpp"
 #include "common/QLogging.hpp"
 #include "common/websockets/detail/WebSocketConnection.hpp"
+#include "common/websockets/WebSocketPool.hpp"
 #include "util/RenameThread.hpp"
 
 #include <boost/certify/https_verification.hpp>
 #include <QStringBuilder>
 
+#include <algorithm>
+
 namespace chatterino::ws::detail {
 
-WebSocketPoolImpl::WebSocketPoolImpl(const QString &shortName)
+WebSocketShard::WebSocketShard()
     : ioc(1)
-    , ssl(boost::asio::ssl::context::tls_client)
     , work(this->ioc.get_executor())
+{
+}
+
+WebSocketPoolImpl::WebSocketPoolImpl(const QString &shortName,
+                                     size_t nThreads)
+    : ssl(boost::asio::ssl::context::tls_client)
+    , startedAt_(std::chrono::steady_clock::now())
 {
     boost::system::error_code ec;
     auto _ = this->ssl.set_options(
@@ -44,19 +53,34 @@ WebSocketPoolImpl::WebSocketPoolImpl(const QString &shortName)
         boost::certify::enable_native_https_server_verification(this->ssl);
     }
 
-    this->ioThread = std::make_unique<std::thread>([this] {
-        this->ioc.run();
-        this->shutdownFlag.set();
-    });
-
-    auto threadName = [&]() -> QString {
+    auto baseName = [&]() -> QString {
         if (shortName.isEmpty())
         {
             return "WebSocketPool";
         }
         return "WS-" % shortName;
     }();
-    renameThread(*this->ioThread, threadName);
+
+    nThreads = std::max<size_t>(nThreads, 1);
+    for (size_t i = 0; i < nThreads; i++)
+    {
+        auto &shard =
+            this->shards.emplace_back(std::make_unique<WebSocketShard>());
+        shard->thread = std::make_unique<std::thread>([shard = shard.get()] {
+            shard->ioc.run();
+            shard->stoppedFlag.set();
+        });
+
+        if (nThreads == 1)
+        {
+            renameThread(*shard->thread, baseName);
+        }
+        else
+        {
+            renameThread(*shard->thread,
+                         baseName % '-' % QString::number(i));
+        }
+    }
 }
 
 WebSocketPoolImpl::~WebSocketPoolImpl()
@@ -67,15 +91,52 @@ WebSocketPoolImpl::~WebSocketPoolImpl()
     this->tryShutdown(std::chrono::seconds{10});
 }
 
+WebSocketShard &WebSocketPoolImpl::acquireShard()
+{
+    std::lock_guard g(this->connectionMutex);
+
+    auto n = this->shards.size();
+    auto best = this->nextShard_ % n;
+    for (size_t i = 1; i < n; i++)
+    {
+        auto idx = (this->nextShard_ + i) % n;
+        if (this->shards[idx]->connections < this->shards[best]->connections)
+        {
+            best = idx;
+        }
+    }
+    this->nextShard_ = best + 1;
+
+    auto &shard = *this->shards[best];
+    shard.connections++;
+    return shard;
+}
+
+void WebSocketPoolImpl::addConnection(
+    std::shared_ptr<WebSocketConnection> conn)
+{
+    std::lock_guard g(this->connectionMutex);
+    this->connections.emplace_back(std::move(conn));
+}
+
 bool WebSocketPoolImpl::tryShutdown(std::chrono::milliseconds timeout)
 {
     this->closing = true;
-    if (!this->ioThread || !this->ioThread->joinable())
+
+    bool anyRunning = false;
+    for (const auto &shard : this->shards)
+    {
+        if (shard->thread && shard->thread->joinable())
+        {
+            anyRunning = true;
+            shard->work.reset();
+        }
+    }
+    if (!anyRunning)
     {
         return true;
     }
 
-    this->work.reset();
     {
         std::lock_guard g(this->connectionMutex);
         for (const auto &conn : this->connections)
@@ -84,16 +145,26 @@ bool WebSocketPoolImpl::tryShutdown(std::chrono::milliseconds timeout)
         }
     }
 
-    if (!this->shutdownFlag.waitFor(timeout))
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    for (const auto &shard : this->shards)
     {
-        qCWarning(chatterinoWebsocket)
-            << "Failed to gracefully close all connections in time";
-        return false;
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        if (!shard->stoppedFlag.waitFor(
+                std::max(remaining, std::chrono::milliseconds{0})))
+        {
+            qCWarning(chatterinoWebsocket)
+                << "Failed to gracefully close all connections in time";
+            return false;
+        }
     }
 
-    if (this->ioThread->joinable())
+    for (const auto &shard : this->shards)
     {
-        this->ioThread->join();
+        if (shard->thread->joinable())
+        {
+            shard->thread->join();
+        }
     }
     return true;
 }
@@ -101,9 +172,34 @@ bool WebSocketPoolImpl::tryShutdown(std::chrono::milliseconds timeout)
 void WebSocketPoolImpl::removeConnection(WebSocketConnection *conn)
 {
     std::lock_guard g(this->connectionMutex);
+    conn->shard().connections--;
     std::erase_if(this->connections, [conn](const auto &v) {
         return v.get() == conn;
     });
 }
 
+std::vector<WebSocketShardStats> WebSocketPoolImpl::stats() const
+{
+    auto uptime = std::chrono::steady_clock::now() - this->startedAt_;
+
+    std::lock_guard g(this->connectionMutex);
+    std::vector<WebSocketShardStats> stats;
+    stats.reserve(this->shards.size());
+    for (const auto &shard : this->shards)
+    {
+        stats.push_back({
+            .connections = shard->connections,
+            .bytesReceived =
+                shard->bytesReceived.load(std::memory_order::relaxed),
+            .framesReceived =
+                shard->framesReceived.load(std::memory_order::relaxed),
+            .callbackTime = std::chrono::nanoseconds{static_cast<int64_t>(
+                shard->callbackNanos.load(std::memory_order::relaxed))},
+            .uptime =
+                std::chrono::duration_cast<std::chrono::milliseconds>(uptime),
+        });
+    }
+    return stats;
+}
+
 }  // namespace chatterino::ws::detail
@@ -10,19 +10,50 @@
 #include <boost/asio/ssl/context.hpp>
 #include <QString>
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <vector>
+
+namespace chatterino {
+
+struct WebSocketShardStats;
+
+}  // namespace chatterino
 
 namespace chatterino::ws::detail {
 
 class WebSocketConnection;
 
+/// An IO-context with its own thread
+///
+/// Every connection of a pool runs on exactly one shard.
+struct WebSocketShard {
+    WebSocketShard();
+
+    boost::asio::io_context ioc;
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+        work;
+    std::unique_ptr<std::thread> thread;
+    OnceFlag stoppedFlag;
+
+    /// Number of connections on this shard (guarded by the pool's
+    /// `connectionMutex`)
+    size_t connections = 0;
+
+    std::atomic<uint64_t> bytesReceived = 0;
+    std::atomic<uint64_t> framesReceived = 0;
+    /// Total time spent in the listeners' message callbacks
+    std::atomic<uint64_t> callbackNanos = 0;
+};
+
 class WebSocketPoolImpl
 {
 public:
-    WebSocketPoolImpl(const QString &shortName);
+    WebSocketPoolImpl(const QString &shortName, size_t nThreads);
     ~WebSocketPoolImpl();
 
     WebSocketPoolImpl(const WebSocketPoolImpl &) = delete;
@@ -30,6 +61,12 @@ public:
     WebSocketPoolImpl &operator=(const WebSocketPoolImpl &) = delete;
     WebSocketPoolImpl &operator=(WebSocketPoolImpl &&) = delete;
 
+    /// Picks the shard with the fewest connections and reserves a slot on it
+    ///
+    /// Ties are broken round-robin.
+    WebSocketShard &acquireShard();
+
+    void addConnection(std::shared_ptr<WebSocketConnection> conn);
     void removeConnection(WebSocketConnection *conn);
 
     /// Attempts to shut down all connections by gracefully closing them.
@@ -38,19 +75,20 @@ public:
     /// this pool should be leaked.
     bool tryShutdown(std::chrono::milliseconds timeout);
 
-    std::unique_ptr<std::thread> ioThread;
-    boost::asio::io_context ioc;
+    std::vector<WebSocketShardStats> stats() const;
+
     boost::asio::ssl::context ssl;
-    boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
-        work;
+    std::vector<std::unique_ptr<WebSocketShard>> shards;
 
     std::vector<std::shared_ptr<WebSocketConnection>> connections;
-    std::mutex connectionMutex;
+    mutable std::mutex connectionMutex;
 
     bool closing = false;
     int nextID = 1;
 
-    OnceFlag shutdownFlag;
+private:
+    size_t nextShard_ = 0;
+    const std::chrono::steady_clock::time_point startedAt_;
 };
 
 }  // namespace chatterino::ws::detail
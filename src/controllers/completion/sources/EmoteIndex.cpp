@@ -0,0 +1,199 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "controllers/completion/sources/EmoteIndex.hpp"
+
+#include "Application.hpp"
+#include "common/Channel.hpp"
+#include "controllers/accounts/AccountController.hpp"
+#include "controllers/emotes/EmoteController.hpp"
+#include "providers/bttv/BttvEmotes.hpp"
+#include "providers/emoji/Emojis.hpp"
+#include "providers/ffz/FfzEmotes.hpp"
+#include "providers/seventv/SeventvEmotes.hpp"
+#include "providers/twitch/TwitchAccount.hpp"
+#include "providers/twitch/TwitchChannel.hpp"
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace chatterino::completion {
+
+namespace {
+
+struct CachedSegment {
+    std::weak_ptr<const EmoteMap> map;
+    EmoteIndexSegmentPtr segment;
+};
+
+struct CachedEmojiSegment {
+    /// Used to tell if the emojis were reloaded
+    std::weak_ptr<EmojiData> first;
+    size_t count = 0;
+    EmoteIndexSegmentPtr segment;
+};
+
+std::mutex cacheMutex;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::map<std::pair<const EmoteMap *, QString>, CachedSegment> segmentCache;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+CachedEmojiSegment emojiCache;
+
+void addItem(EmoteIndexSegment &segment, EmoteItem item)
+{
+    segment.foldedNames.push_back(item.searchName.toCaseFolded());
+    segment.items.push_back(std::move(item));
+}
+
+EmoteIndexSegmentPtr buildSegment(const EmoteMap &map,
+                                  const QString &providerName)
+{
+    auto segment = std::make_shared<EmoteIndexSegment>();
+    segment->items.reserve(map.size());
+    segment->foldedNames.reserve(map.size());
+    for (const auto &[name, emote] : map)
+    {
+        addItem(*segment, {
+                              .emote = emote,
+                              .searchName = name.string,
+                              .tabCompletionName = name.string,
+                              .displayName = emote->name.string,
+                              .providerName = providerName,
+                              .isEmoji = false,
+                          });
+    }
+    return segment;
+}
+
+EmoteIndexSegmentPtr buildEmojiSegment(const std::vector<EmojiPtr> &emojis)
+{
+    auto segment = std::make_shared<EmoteIndexSegment>();
+    for (const auto &emoji : emojis)
+    {
+        for (const auto &shortCode : emoji->shortCodes)
+        {
+            addItem(*segment,
+                    {
+                        .emote = emoji->emote,
+                        .searchName = shortCode,
+                        .tabCompletionName = QStringLiteral(":%1:").arg(
+                            shortCode),
+                        .displayName = shortCode,
+                        .providerName = "Emoji",
+                        .isEmoji = true,
+                    });
+        }
+    }
+    return segment;
+}
+
+/// Returns the (cached) segment for `map`
+EmoteIndexSegmentPtr segmentFor(const std::shared_ptr<const EmoteMap> &map,
+                                const QString &providerName)
+{
+    std::lock_guard lock(cacheMutex);
+
+    auto key = std::make_pair(map.get(), providerName);
+    auto it = segmentCache.find(key);
+    if (it != segmentCache.end() && it->second.map.lock() == map)
+    {
+        return it->second.segment;
+    }
+
+    // Drop segments of maps that were replaced
+    std::erase_if(segmentCache, [](const auto &entry) {
+        return entry.second.map.expired();
+    });
+
+    auto segment = buildSegment(*map, providerName);
+    segmentCache[key] = {
+        .map = map,
+        .segment = segment,
+    };
+    return segment;
+}
+
+EmoteIndexSegmentPtr emojiSegment(const std::vector<EmojiPtr> &emojis)
+{
+    std::lock_guard lock(cacheMutex);
+
+    if (!emojiCache.segment || emojiCache.count != emojis.size() ||
+        (!emojis.empty() && emojiCache.first.lock() != emojis.front()))
+    {
+        emojiCache = {
+            .first = emojis.empty() ? nullptr : emojis.front(),
+            .count = emojis.size(),
+            .segment = buildEmojiSegment(emojis),
+        };
+    }
+    return emojiCache.segment;
+}
+
+}  // namespace
+
+EmoteIndex::EmoteIndex(const Channel *channel)
+{
+    auto *app = getApp();
+
+    auto add = [this](const std::shared_ptr<const EmoteMap> &map,
+                      const QString &providerName) {
+        if (map)
+        {
+            this->segments_.push_back(segmentFor(map, providerName));
+        }
+    };
+
+    const auto *tc = dynamic_cast<const TwitchChannel *>(channel);
+    // returns true also for special Twitch channels (/live, /mentions, /whispers, etc.)
+    if (channel->isTwitchChannel())
+    {
+        if (tc)
+        {
+            add(tc->localTwitchEmotes(), "Local Twitch Emotes");
+
+            auto user = app->getAccounts()->twitch.getCurrent();
+            add(*user->accessEmotes(), "Twitch Emote");
+
+            // TODO extract "Channel {BetterTTV,7TV,FrankerFaceZ}" text into a #define.
+            add(tc->bttvEmotes(), "Channel BetterTTV");
+            add(tc->ffzEmotes(), "Channel FrankerFaceZ");
+            add(tc->seventvEmotes(), "Channel 7TV");
+        }
+
+        add(app->getBttvEmotes()->emotes(), "Global BetterTTV");
+        add(app->getFfzEmotes()->emotes(), "Global FrankerFaceZ");
+        add(app->getSeventvEmotes()->globalEmotes(), "Global 7TV");
+    }
+
+    this->segments_.push_back(
+        emojiSegment(app->getEmotes()->getEmojis()->getEmojis()));
+}
+
+void EmoteIndex::collect(QStringView needle, std::vector<EmoteItem> &out) const
+{
+    auto foldedNeedle = needle.toString().toCaseFolded();
+    for (const auto &segment : this->segments_)
+    {
+        for (size_t i = 0; i < segment->items.size(); i++)
+        {
+            if (segment->foldedNames[i].contains(foldedNeedle))
+            {
+                out.push_back(segment->items[i]);
+            }
+        }
+    }
+}
+
+size_t EmoteIndex::size() const
+{
+    size_t size = 0;
+    for (const auto &segment : this->segments_)
+    {
+        size += segment->items.size();
+    }
+    return size;
+}
+
+}  // namespace chatterino::completion
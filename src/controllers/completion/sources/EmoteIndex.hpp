@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "messages/Emote.hpp"
+
+#include <QString>
+#include <QStringView>
+
+#include <memory>
+#include <vector>
+
+namespace chatterino {
+
+class Channel;
+
+}  // namespace chatterino
+
+namespace chatterino::completion {
+
+struct EmoteItem {
+    /// Emote image to show in input popup
+    EmotePtr emote{};
+    /// Name to check completion queries against
+    QString searchName{};
+    /// Name to insert into split input upon tab completing
+    QString tabCompletionName{};
+    /// Display name within input popup
+    QString displayName{};
+    /// Emote provider name for input popup
+    QString providerName{};
+    /// Whether emote is emoji
+    bool isEmoji{};
+};
+
+/// Completion items of a single emote map (or of all emojis)
+struct EmoteIndexSegment {
+    std::vector<EmoteItem> items;
+    /// Case-folded `searchName` of every item in `items`
+    std::vector<QString> foldedNames;
+};
+
+using EmoteIndexSegmentPtr = std::shared_ptr<const EmoteIndexSegment>;
+
+/// All emotes that can be completed in a channel
+///
+/// The index is made up of one segment per emote map. Segments are shared
+/// between all channels using the same map and are only rebuilt once the
+/// map is replaced (e.g. when the channel's emotes are reloaded).
+class EmoteIndex
+{
+public:
+    /// Collects the segments of all emotes available in `channel`
+    explicit EmoteIndex(const Channel *channel);
+
+    /// Appends all items whose search name contains `needle`
+    /// (case-insensitive) to `out`, in completion order
+    void collect(QStringView needle, std::vector<EmoteItem> &out) const;
+
+    /// Total number of items
+    size_t size() const;
+
+private:
+    std::vector<EmoteIndexSegmentPtr> segments_;
+};
+
+}  // namespace chatterino::completion
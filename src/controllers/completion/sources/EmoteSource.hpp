@@ -5,9 +5,9 @@
 #pragma once
 
 #include "common/Channel.hpp"
+#include "controllers/completion/sources/EmoteIndex.hpp"
 #include "controllers/completion/sources/Source.hpp"
 #include "controllers/completion/strategies/Strategy.hpp"
-#include "messages/Emote.hpp"
 
 #include <QString>
 
@@ -17,21 +17,6 @@
 
 namespace chatterino::completion {
 
-struct EmoteItem {
-    /// Emote image to show in input popup
-    EmotePtr emote{};
-    /// Name to check completion queries against
-    QString searchName{};
-    /// Name to insert into split input upon tab completing
-    QString tabCompletionName{};
-    /// Display name within input popup
-    QString displayName{};
-    /// Emote provider name for input popup
-    QString providerName{};
-    /// Whether emote is emoji
-    bool isEmoji{};
-};
-
 class EmoteSource : public Source
 {
 public:
@@ -55,12 +40,12 @@ public:
     const std::vector<EmoteItem> &output() const;
 
 private:
-    void initializeFromChannel(const Channel *channel);
-
     std::unique_ptr<EmoteStrategy> strategy_;
     ActionCallback callback_;
 
-    std::vector<EmoteItem> items_{};
+    EmoteIndex index_;
+    /// Items that might match the current query, passed to the strategy
+    std::vector<EmoteItem> candidates_{};
     std::vector<EmoteItem> output_{};
 };
 
@@ -15,11 +15,11 @@ namespace chatterino::completion {
 UserSource::UserSource(const Channel *channel,
                        std::unique_ptr<UserStrategy> strategy,
                        ActionCallback callback, bool prependAt)
-    : strategy_(std::move(strategy))
+    : channel_(channel->weak_from_this())
+    , strategy_(std::move(strategy))
     , callback_(std::move(callback))
     , prependAt_(prependAt)
 {
-    this->initializeFromChannel(channel);
 }
 
 void UserSource::update(const QString &query)
@@ -27,6 +27,7 @@ void UserSource::update(const QString &query)
     this->output_.clear();
     if (this->strategy_)
     {
+        this->loadItems(query);
         this->strategy_->apply(this->items_, this->output_, query);
     }
 }
@@ -55,15 +56,25 @@ void UserSource::addToStringList(QStringList &list, size_t maxCount,
                        });
 }
 
-void UserSource::initializeFromChannel(const Channel *channel)
+void UserSource::loadItems(const QString &query)
 {
-    const auto *tc = dynamic_cast<const TwitchChannel *>(channel);
+    this->items_.clear();
+
+    auto channel = this->channel_.lock();
+    const auto *tc = dynamic_cast<const TwitchChannel *>(channel.get());
     if (!tc)
     {
         return;
     }
 
-    this->items_ = tc->accessChatters()->all();
+    // Only users starting with the query can match, look them up in the
+    // chatters' index instead of copying all of them
+    QStringView prefix = query;
+    if (prefix.startsWith(u'@'))
+    {
+        prefix = prefix.mid(1);
+    }
+    this->items_ = tc->accessChatters()->allWithPrefix(prefix.toString());
 
     if (getSettings()->alwaysIncludeBroadcasterInUserCompletions)
     {
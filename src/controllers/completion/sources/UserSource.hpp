@@ -26,7 +26,7 @@ public:
     using UserStrategy = Strategy<UserItem>;
 
     /// @brief Initializes a source for UserItems from the given channel.
-    /// @param channel Channel to initialize users from. Must be a TwitchChannel
+    /// @param channel Channel to complete users from. Must be a TwitchChannel
     /// or completion is a no-op.
     /// @param strategy Strategy to apply
     /// @param callback ActionCallback to invoke upon InputCompletionItem selection.
@@ -44,8 +44,10 @@ public:
     const std::vector<UserItem> &output() const;
 
 private:
-    void initializeFromChannel(const Channel *channel);
+    /// Loads the users whose name starts with the query into `items_`
+    void loadItems(const QString &query);
 
+    std::weak_ptr<const Channel> channel_;
     std::unique_ptr<UserStrategy> strategy_;
     ActionCallback callback_;
     bool prependAt_;
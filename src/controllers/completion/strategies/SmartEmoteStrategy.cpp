@@ -12,6 +12,7 @@
 #include <Qt>
 
 #include <algorithm>
+#include <iterator>
 
 namespace chatterino::completion {
 namespace {
@@ -135,39 +136,48 @@ void completeEmotes(
         }
     }
 
-    std::sort(output.begin(), output.end(),
-              [query, prioritizeUpper, ignoreColonForCost, ignoreTildeForCost](
-                  const EmoteItem &a, const EmoteItem &b) -> bool {
-                  auto tempA = a.searchName;
-                  auto tempB = b.searchName;
-                  if (ignoreColonForCost && tempA.startsWith(":"))
-                  {
-                      tempA = tempA.mid(1);
-                  }
-                  if (ignoreTildeForCost && tempA.startsWith("~"))
-                  {
-                      tempA = tempA.mid(1);
-                  }
-                  if (ignoreColonForCost && tempB.startsWith(":"))
-                  {
-                      tempB = tempB.mid(1);
-                  }
-                  if (ignoreTildeForCost && tempB.startsWith("~"))
-                  {
-                      tempB = tempB.mid(1);
-                  }
-
-                  auto costA = costOfEmote(query, tempA, prioritizeUpper);
-                  auto costB = costOfEmote(query, tempB, prioritizeUpper);
-                  if (costA == costB)
-                  {
-                      // Case difference and length came up tied for (a, b), break the tie
-                      return QString::compare(tempA, tempB,
-                                              Qt::CaseInsensitive) < 0;
-                  }
-
-                  return costA < costB;
-              });
+    // Compute the cost of every item once instead of in each comparison
+    struct RankedItem {
+        int cost;
+        QStringView name;
+        EmoteItem *item;
+    };
+    std::vector<RankedItem> ranked;
+    ranked.reserve(output.size());
+    for (auto &item : output)
+    {
+        QStringView name = item.searchName;
+        if (ignoreColonForCost && name.startsWith(u':'))
+        {
+            name = name.mid(1);
+        }
+        if (ignoreTildeForCost && name.startsWith(u'~'))
+        {
+            name = name.mid(1);
+        }
+        ranked.push_back({
+            .cost = costOfEmote(query, name, prioritizeUpper),
+            .name = name,
+            .item = &item,
+        });
+    }
+
+    std::ranges::sort(ranked, [](const RankedItem &a, const RankedItem &b) {
+        if (a.cost == b.cost)
+        {
+            // Case difference and length came up tied for (a, b), break the tie
+            return a.name.compare(b.name, Qt::CaseInsensitive) < 0;
+        }
+        return a.cost < b.cost;
+    });
+
+    std::vector<EmoteItem> sorted;
+    sorted.reserve(ranked.size());
+    for (const auto &entry : ranked)
+    {
+        sorted.push_back(std::move(*entry.item));
+    }
+    output = std::move(sorted);
 }
 }  // namespace
 
@@ -176,7 +186,9 @@ void SmartEmoteStrategy::apply(const std::vector<EmoteItem> &items,
                                const QString &query) const
 {
     qCDebug(LOG) << "SmartEmoteStrategy apply" << query;
-    std::vector<EmoteItem> filteredItems = items;
+    // Only copied if we need to filter out emotes
+    std::vector<EmoteItem> zeroWidthItems;
+    const auto *filteredItems = &items;
     QString normalizedQuery = query;
     bool ignoreColonForCost = false;
     bool zeroWidthOnly = false;
@@ -190,14 +202,14 @@ void SmartEmoteStrategy::apply(const std::vector<EmoteItem> &items,
         normalizedQuery = normalizedQuery.mid(1);
         zeroWidthOnly = true;
 
-        auto [first, last] = std::ranges::remove_if(
-            filteredItems, [](const EmoteItem &emoteItem) {
-                return !emoteItem.emote->zeroWidth;
-            });
-        filteredItems.erase(first, last);
+        std::ranges::copy_if(items, std::back_inserter(zeroWidthItems),
+                             [](const EmoteItem &emoteItem) {
+                                 return emoteItem.emote->zeroWidth;
+                             });
+        filteredItems = &zeroWidthItems;
     }
 
-    completeEmotes(filteredItems, output, normalizedQuery, ignoreColonForCost,
+    completeEmotes(*filteredItems, output, normalizedQuery, ignoreColonForCost,
                    zeroWidthOnly,
                    [normalizedQuery](const EmoteItem &left,
                                      Qt::CaseSensitivity caseHandling) {
@@ -4,10 +4,13 @@
 
 #include "controllers/emotes/EmoteController.hpp"
 
+#include "debug/StartupProfiler.hpp"
 #include "providers/emoji/Emojis.hpp"
 #include "providers/twitch/TwitchEmotes.hpp"
 #include "singletons/helper/GifTimer.hpp"
 
+#include <QtConcurrent>
+
 namespace chatterino {
 
 EmoteController::EmoteController()
@@ -16,14 +19,27 @@ EmoteController::EmoteController()
     , gifTimer_(std::make_unique<GIFTimer>())
 {
 }
-EmoteController::~EmoteController() = default;
+
+EmoteController::~EmoteController()
+{
+    this->emojiData_.waitForFinished();
+}
 
 void EmoteController::initialize()
 {
-    this->emojis_->load();
+    this->emojiData_ = QtConcurrent::run([emojis = this->emojis_.get()] {
+        StartupProfiler::Phase phase("emoji data");
+        emojis->loadData();
+    });
     this->gifTimer_->initialize();
 }
 
+void EmoteController::finishInitialize()
+{
+    this->emojiData_.waitForFinished();
+    this->emojis_->load();
+}
+
 TwitchEmotes *EmoteController::getTwitchEmotes() const
 {
     return this->twitchEmotes_.get();
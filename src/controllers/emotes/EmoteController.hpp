@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <QFuture>
+
 #include <memory>
 
 namespace chatterino {
@@ -18,8 +20,14 @@ public:
     EmoteController();
     virtual ~EmoteController();
 
+    /// Starts parsing the emoji data in the background
     virtual void initialize();
 
+    /// Waits for the emoji data and makes the emojis available
+    ///
+    /// Must be called before any messages are built.
+    virtual void finishInitialize();
+
     TwitchEmotes *getTwitchEmotes() const;
 
     Emojis *getEmojis() const;
@@ -30,6 +38,8 @@ private:
     std::unique_ptr<TwitchEmotes> twitchEmotes_;
     std::unique_ptr<Emojis> emojis_;
     std::unique_ptr<GIFTimer> gifTimer_;
+
+    QFuture<void> emojiData_;
 };
 
 }  // namespace chatterino
@@ -0,0 +1,261 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "controllers/emotes/EmoteSnapshot.hpp"
+
+#include "Application.hpp"
+#include "common/QLogging.hpp"
+#include "debug/StartupProfiler.hpp"
+#include "messages/Image.hpp"
+#include "singletons/Paths.hpp"
+
+#include <QDataStream>
+#include <QFile>
+#include <QFuture>
+#include <QSaveFile>
+#include <QSize>
+#include <QStringBuilder>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+using namespace chatterino;
+
+constexpr quint32 SNAPSHOT_MAGIC = 0x43454d53;  // "CEMS"
+/// Must be bumped whenever the format changes
+constexpr quint16 SNAPSHOT_VERSION = 1;
+
+QString snapshotPath(const QString &id, const QString &provider)
+{
+    return getApp()->getPaths().cacheFilePath(id % "." % provider %
+                                              ".emotes");
+}
+
+void writeImage(QDataStream &stream, const ImagePtr &image)
+{
+    stream << image->url().string << image->scale() << image->expectedSize();
+}
+
+ImagePtr readImage(QDataStream &stream)
+{
+    QString url;
+    qreal scale = 1;
+    QSize expectedSize;
+    stream >> url >> scale >> expectedSize;
+
+    if (url.isEmpty())
+    {
+        return getEmptyImagePtr();
+    }
+    return Image::fromUrl({url}, scale, expectedSize);
+}
+
+/// Like operator==, but also compares fields that aren't visible in messages
+bool sameEmote(const Emote &a, const Emote &b)
+{
+    return a == b && a.zeroWidth == b.zeroWidth && a.id == b.id &&
+           a.author == b.author && a.baseName == b.baseName;
+}
+
+/// Snapshot path -> read that was started by prefetchEmoteSnapshot
+std::unordered_map<QString, QFuture<std::shared_ptr<const EmoteMap>>>
+    prefetched;
+std::mutex prefetchMutex;
+
+std::shared_ptr<const EmoteMap> readSnapshotFile(const QString &path,
+                                                 const QString &id,
+                                                 const QString &provider)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return nullptr;
+    }
+
+    auto map = parseEmoteSnapshot(file.readAll());
+    if (!map)
+    {
+        qCWarning(chatterinoCache)
+            << "Emote snapshot" << id << provider << "is invalid";
+        return nullptr;
+    }
+
+    qCDebug(chatterinoCache)
+        << "Loaded emote snapshot" << id << provider << map->size();
+    return std::make_shared<const EmoteMap>(std::move(*map));
+}
+
+
+}  // namespace
+
+namespace chatterino {
+
+QByteArray serializeEmoteSnapshot(const EmoteMap &map)
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    // Keep the format stable between Qt versions
+    stream.setVersion(QDataStream::Qt_5_15);
+
+    stream << SNAPSHOT_MAGIC << SNAPSHOT_VERSION
+           << static_cast<quint32>(map.size());
+    for (const auto &[name, emote] : map)
+    {
+        stream << name.string << emote->name.string << emote->id.string
+               << emote->tooltip.string << emote->homePage.string
+               << emote->author.string << emote->zeroWidth
+               << emote->baseName.has_value()
+               << emote->baseName.value_or(EmoteName{}).string;
+        writeImage(stream, emote->images.getImage1());
+        writeImage(stream, emote->images.getImage2());
+        writeImage(stream, emote->images.getImage3());
+    }
+
+    return qCompress(data);
+}
+
+std::optional<EmoteMap> parseEmoteSnapshot(const QByteArray &data)
+{
+    auto uncompressed = qUncompress(data);
+    QDataStream stream(uncompressed);
+    stream.setVersion(QDataStream::Qt_5_15);
+
+    quint32 magic = 0;
+    quint16 version = 0;
+    quint32 size = 0;
+    stream >> magic >> version >> size;
+    if (magic != SNAPSHOT_MAGIC || version != SNAPSHOT_VERSION)
+    {
+        return std::nullopt;
+    }
+
+    EmoteMap map;
+    map.reserve(size);
+    for (quint32 i = 0; i < size && stream.status() == QDataStream::Ok; i++)
+    {
+        QString key;
+        Emote emote;
+        bool hasBaseName = false;
+        QString baseName;
+        stream >> key >> emote.name.string >> emote.id.string >>
+            emote.tooltip.string >> emote.homePage.string >>
+            emote.author.string >> emote.zeroWidth >> hasBaseName >> baseName;
+        if (hasBaseName)
+        {
+            emote.baseName = EmoteName{baseName};
+        }
+
+        auto image1 = readImage(stream);
+        auto image2 = readImage(stream);
+        auto image3 = readImage(stream);
+        emote.images = ImageSet(image1, image2, image3);
+
+        map.emplace(EmoteName{key},
+                    std::make_shared<const Emote>(std::move(emote)));
+    }
+
+    if (stream.status() != QDataStream::Ok)
+    {
+        return std::nullopt;
+    }
+
+    return map;
+}
+
+std::shared_ptr<const EmoteMap> readEmoteSnapshot(const QString &id,
+                                                  const QString &provider)
+{
+    auto path = snapshotPath(id, provider);
+    std::unique_lock lock(prefetchMutex);
+    auto it = prefetched.find(path);
+    if (it == prefetched.end())
+    {
+        lock.unlock();
+        return readSnapshotFile(path, id, provider);
+    }
+
+    auto future = std::move(it->second);
+    prefetched.erase(it);
+    lock.unlock();
+
+    return future.result();
+}
+
+void prefetchEmoteSnapshot(const QString &id, const QString &provider)
+{
+    auto path = snapshotPath(id, provider);
+    std::lock_guard lock(prefetchMutex);
+    if (prefetched.contains(path))
+    {
+        return;
+    }
+
+    prefetched.emplace(path, QtConcurrent::run([path, id, provider] {
+                           StartupProfiler::Phase phase(
+                               u"emote snapshot " % id % u' ' % provider);
+                           return readSnapshotFile(path, id, provider);
+                       }));
+}
+
+void writeEmoteSnapshot(const QString &id, const QString &provider,
+                        std::shared_ptr<const EmoteMap> map)
+{
+    auto *threadPool = QThreadPool::globalInstance();
+    if (threadPool == nullptr)
+    {
+        // Must be exiting - do nothing
+        return;
+    }
+
+    auto path = snapshotPath(id, provider);
+    threadPool->start([path, map = std::move(map)]() {
+        QSaveFile file(path);
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            return;
+        }
+
+        file.write(serializeEmoteSnapshot(*map));
+        if (file.commit())
+        {
+            qCDebug(chatterinoCache) << "Saved emote snapshot" << path;
+        }
+    });
+}
+
+std::shared_ptr<const EmoteMap> reconcileEmoteMap(
+    const std::shared_ptr<const EmoteMap> &current, EmoteMap &&fresh)
+{
+    if (!current)
+    {
+        return std::make_shared<const EmoteMap>(std::move(fresh));
+    }
+
+    bool changed = current->size() != fresh.size();
+    for (auto &[name, emote] : fresh)
+    {
+        auto it = current->find(name);
+        if (it != current->end() && sameEmote(*it->second, *emote))
+        {
+            // keep the emote that's already in use
+            emote = it->second;
+        }
+        else
+        {
+            changed = true;
+        }
+    }
+
+    if (!changed)
+    {
+        return nullptr;
+    }
+    return std::make_shared<const EmoteMap>(std::move(fresh));
+}
+
+}  // namespace chatterino
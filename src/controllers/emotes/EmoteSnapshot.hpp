@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "messages/Emote.hpp"
+
+#include <QByteArray>
+#include <QString>
+
+#include <memory>
+#include <optional>
+
+namespace chatterino {
+
+/// Serializes `map` into a compact binary snapshot
+QByteArray serializeEmoteSnapshot(const EmoteMap &map);
+
+/// Restores an emote map from a snapshot created by `serializeEmoteSnapshot`
+///
+/// Returns std::nullopt if the snapshot is corrupt or from an incompatible
+/// version.
+std::optional<EmoteMap> parseEmoteSnapshot(const QByteArray &data);
+
+/// Loads the last known emotes of `provider` for `id` (a channel ID or
+/// "global") from the cache directory
+///
+/// This is done synchronously, so emotes can be shown before the provider
+/// responds. If the snapshot was prefetched, this waits for that read
+/// instead. Returns nullptr if there's no usable snapshot.
+std::shared_ptr<const EmoteMap> readEmoteSnapshot(const QString &id,
+                                                  const QString &provider);
+
+/// Starts reading the snapshot of `provider` for `id` in the background
+///
+/// The next `readEmoteSnapshot` call for the same snapshot uses the result.
+void prefetchEmoteSnapshot(const QString &id, const QString &provider);
+
+/// Saves `map` as the last known emotes of `provider` for `id` in the
+/// background
+void writeEmoteSnapshot(const QString &id, const QString &provider,
+                        std::shared_ptr<const EmoteMap> map);
+
+/// Merges a freshly loaded emote map into the `current` one
+///
+/// Returns nullptr if `fresh` contains the same emotes as `current`.
+/// Otherwise, the returned map contains the emotes from `fresh`, where
+/// unchanged emotes are shared with `current`.
+std::shared_ptr<const EmoteMap> reconcileEmoteMap(
+    const std::shared_ptr<const EmoteMap> &current, EmoteMap &&fresh);
+
+}  // namespace chatterino
@@ -6,8 +6,16 @@
 
 #include "controllers/filters/lang/Filter.hpp"
 
+#include <atomic>
+
 namespace chatterino {
 
+namespace {
+
+std::atomic<uint64_t> nextGeneration{1};
+
+}  // namespace
+
 static std::unique_ptr<filters::Filter> buildFilter(const QString &filterText)
 {
     using namespace filters;
@@ -38,6 +46,12 @@ FilterRecord::FilterRecord(QString name, QString filter, const QUuid &id)
     : name_(std::move(name))
     , filterText_(std::move(filter))
     , id_(id)
+    , generation_(nextGeneration.fetch_add(1, std::memory_order_relaxed))
+    // These variables change without the message changing. This is a plain
+    // text search, so a string literal might match as well - which only
+    // disables caching.
+    , dependsOnChannelState_(this->filterText_.contains("channel.live") ||
+                             this->filterText_.contains("channel.watching"))
     , filter_(buildFilter(this->filterText_))
 {
 }
@@ -62,6 +76,16 @@ bool FilterRecord::valid() const
     return this->filter_ != nullptr;
 }
 
+uint64_t FilterRecord::generation() const
+{
+    return this->generation_;
+}
+
+bool FilterRecord::dependsOnChannelState() const
+{
+    return this->dependsOnChannelState_;
+}
+
 bool FilterRecord::filter(const filters::ContextMap &context) const
 {
     assert(this->valid());
@@ -13,6 +13,7 @@
 #include <QString>
 #include <QUuid>
 
+#include <cstdint>
 #include <memory>
 
 namespace chatterino {
@@ -32,6 +33,18 @@ public:
 
     bool valid() const;
 
+    /// Uniquely identifies this version of the filter
+    ///
+    /// Every record gets a new generation, so editing a filter (which
+    /// replaces its record) invalidates cached results of it.
+    uint64_t generation() const;
+
+    /// Does the result of this filter depend on the state of the channel (or
+    /// the app) rather than only on the message?
+    ///
+    /// Results of such filters can't be cached.
+    bool dependsOnChannelState() const;
+
     bool filter(const filters::ContextMap &context) const;
 
     bool operator==(const FilterRecord &other) const;
@@ -40,6 +53,8 @@ private:
     const QString name_;
     const QString filterText_;
     const QUuid id_;
+    const uint64_t generation_;
+    const bool dependsOnChannelState_;
 
     const std::unique_ptr<filters::Filter> filter_;
 };
@@ -5,8 +5,11 @@
 #include "controllers/filters/FilterSet.hpp"
 
 #include "controllers/filters/FilterRecord.hpp"
+#include "messages/Message.hpp"
 #include "singletons/Settings.hpp"
 
+#include <optional>
+
 namespace chatterino {
 
 FilterSet::FilterSet()
@@ -46,10 +49,39 @@ bool FilterSet::filter(const MessagePtr &m, ChannelPtr channel) const
         return true;
     }
 
-    filters::ContextMap context = filters::buildContextMap(m, channel.get());
-    for (const auto &f : this->filters_.values())
+    // Only built if one of the filters isn't cached
+    std::optional<filters::ContextMap> context;
+    for (const auto &f : this->filters_)
     {
-        if (!f->valid() || !f->filter(context))
+        if (!f->valid())
+        {
+            return false;
+        }
+
+        const bool cacheable = !f->dependsOnChannelState();
+        if (cacheable)
+        {
+            if (auto verdict =
+                    m->filterVerdicts.get(f->getId(), f->generation()))
+            {
+                if (!*verdict)
+                {
+                    return false;
+                }
+                continue;
+            }
+        }
+
+        if (!context)
+        {
+            context = filters::buildContextMap(m, channel.get());
+        }
+        const bool verdict = f->filter(*context);
+        if (cacheable)
+        {
+            m->filterVerdicts.set(f->getId(), f->generation(), verdict);
+        }
+        if (!verdict)
         {
             return false;
         }
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QUuid>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace chatterino {
+
+/// Remembers the results of filters evaluated on a single message
+///
+/// Entries are keyed by the filter's id and are only valid for the
+/// generation of the filter they were computed with (see
+/// FilterRecord::generation), so edited filters are evaluated again.
+///
+/// This must only be used from the GUI thread.
+class FilterVerdictCache
+{
+public:
+    std::optional<bool> get(const QUuid &filterId, uint64_t generation) const
+    {
+        for (const auto &entry : this->entries_)
+        {
+            if (entry.filterId == filterId)
+            {
+                if (entry.generation != generation)
+                {
+                    return std::nullopt;
+                }
+                return entry.verdict;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void set(const QUuid &filterId, uint64_t generation, bool verdict)
+    {
+        for (auto &entry : this->entries_)
+        {
+            if (entry.filterId == filterId)
+            {
+                entry.generation = generation;
+                entry.verdict = verdict;
+                return;
+            }
+        }
+        this->entries_.push_back({
+            .filterId = filterId,
+            .generation = generation,
+            .verdict = verdict,
+        });
+    }
+
+private:
+    struct Entry {
+        QUuid filterId;
+        uint64_t generation = 0;
+        bool verdict = false;
+    };
+
+    // Messages are usually checked against a handful of filters at most, so
+    // a linear search is fine here
+    std::vector<Entry> entries_;
+};
+
+}  // namespace chatterino
@@ -0,0 +1,592 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "controllers/ignores/IgnoreRewriter.hpp"
+
+#include "common/Literals.hpp"
+#include "common/QLogging.hpp"
+#include "controllers/ignores/IgnorePhrase.hpp"
+#include "providers/twitch/TwitchIrc.hpp"
+#include "singletons/Settings.hpp"
+
+#include <QRegularExpression>
+#include <QVarLengthArray>
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+
+namespace {
+
+using namespace chatterino::literals;
+
+using SizeType = QString::size_type;
+
+/// Messages with more matches of a single regex phrase are replaced with an
+/// error to avoid runaway replacements
+constexpr size_t MAX_REGEX_REPLACEMENTS = 128;
+
+char16_t fold(char16_t c)
+{
+    return QChar::toCaseFolded(c);
+}
+
+/**
+  * Computes (only) the replacement of @a match in @a source.
+  * The parts before and after the match in @a source are ignored.
+  *
+  * Occurrences of \b{\\1}, \b{\\2}, ..., in @a replacement are replaced
+  * with the string captured by the corresponding capturing group.
+  * This function should only be used if the regex contains capturing groups.
+  *
+  * Since Qt doesn't provide a way of replacing a single match with some replacement
+  * while supporting both capturing groups and lookahead/-behind in the regex,
+  * this is included here. It's essentially the implementation of
+  * QString::replace(const QRegularExpression &, const QString &).
+  * @see https://github.com/qt/qtbase/blob/97bb0ecfe628b5bb78e798563212adf02129c6f6/src/corelib/text/qstring.cpp#L4594-L4703
+  */
+QString makeRegexReplacement(QStringView source,
+                             const QRegularExpression &regex,
+                             const QRegularExpressionMatch &match,
+                             const QString &replacement)
+{
+    struct QStringCapture {
+        SizeType pos;
+        SizeType len;
+        int captureNumber;
+    };
+
+    qsizetype numCaptures = regex.captureCount();
+
+    // 1. build the backreferences list, holding where the backreferences
+    //    are in the replacement string
+    QVarLengthArray<QStringCapture> backReferences;
+
+    SizeType replacementLength = replacement.size();
+    for (SizeType i = 0; i < replacementLength - 1; i++)
+    {
+        if (replacement[i] != u'\\')
+        {
+            continue;
+        }
+
+        int no = replacement[i + 1].digitValue();
+        if (no <= 0 || no > numCaptures)
+        {
+            continue;
+        }
+
+        QStringCapture backReference{.pos = i, .len = 2};
+
+        if (i < replacementLength - 2)
+        {
+            int secondDigit = replacement[i + 2].digitValue();
+            if (secondDigit != -1 && ((no * 10) + secondDigit) <= numCaptures)
+            {
+                no = (no * 10) + secondDigit;
+                ++backReference.len;
+            }
+        }
+
+        backReference.captureNumber = no;
+        backReferences.append(backReference);
+    }
+
+    // 2. iterate on the matches.
+    //    For every match, copy the replacement string in chunks
+    //    with the proper replacements for the backreferences
+
+    // length of the new string, with all the replacements
+    SizeType newLength = 0;
+    QVarLengthArray<QStringView> chunks;
+    QStringView replacementView{replacement};
+
+    // Initially: empty, as we only care about the replacement
+    SizeType len = 0;
+    SizeType lastEnd = 0;
+    for (const QStringCapture &backReference : std::as_const(backReferences))
+    {
+        // part of "replacement" before the backreference
+        len = backReference.pos - lastEnd;
+        if (len > 0)
+        {
+            chunks << replacementView.mid(lastEnd, len);
+            newLength += len;
+        }
+
+        // backreference itself
+        len = match.capturedLength(backReference.captureNumber);
+        if (len > 0)
+        {
+            chunks << source.mid(
+                match.capturedStart(backReference.captureNumber), len);
+            newLength += len;
+        }
+
+        lastEnd = backReference.pos + backReference.len;
+    }
+
+    // add the last part of the replacement string
+    len = replacementView.size() - lastEnd;
+    if (len > 0)
+    {
+        chunks << replacementView.mid(lastEnd, len);
+        newLength += len;
+    }
+
+    // 3. assemble the chunks together
+    QString dst;
+    dst.reserve(newLength);
+    for (const QStringView &chunk : std::as_const(chunks))
+    {
+        dst += chunk;
+    }
+    return dst;
+}
+
+bool isUsable(const chatterino::IgnorePhrase &phrase)
+{
+    return !phrase.getPattern().isEmpty() &&
+           (!phrase.isRegex() || phrase.isRegexValid());
+}
+
+/// A single match of a phrase in the message
+struct Replacement {
+    SizeType start;
+    SizeType length;
+    QString text;
+};
+
+}  // namespace
+
+namespace chatterino::ignores::detail {
+
+LiteralMatcher::LiteralMatcher()
+    : nodes_(1)
+{
+}
+
+void LiteralMatcher::add(const QString &pattern, bool caseSensitive,
+                         uint32_t id)
+{
+    uint32_t state = 0;
+    for (auto c : pattern)
+    {
+        auto folded = fold(c.unicode());
+        auto it = this->nodes_[state].next.find(folded);
+        if (it != this->nodes_[state].next.end())
+        {
+            state = it->second;
+            continue;
+        }
+
+        auto next = static_cast<uint32_t>(this->nodes_.size());
+        this->nodes_[state].next.emplace(folded, next);
+        this->nodes_.emplace_back();
+        state = next;
+    }
+
+    this->nodes_[state].outputs.push_back(
+        static_cast<uint32_t>(this->patterns_.size()));
+    this->patterns_.push_back({
+        .text = pattern,
+        .caseSensitive = caseSensitive,
+        .id = id,
+    });
+}
+
+void LiteralMatcher::build()
+{
+    // Breadth-first, so the failure links of shallower nodes are done first
+    std::deque<uint32_t> queue;
+    for (const auto &[c, child] : this->nodes_[0].next)
+    {
+        this->nodes_[child].fail = 0;
+        queue.push_back(child);
+    }
+
+    while (!queue.empty())
+    {
+        auto state = queue.front();
+        queue.pop_front();
+
+        for (const auto &[c, child] : this->nodes_[state].next)
+        {
+            auto fail = this->step(this->nodes_[state].fail, c);
+            this->nodes_[child].fail = fail;
+            const auto &inherited = this->nodes_[fail].outputs;
+            auto &outputs = this->nodes_[child].outputs;
+            outputs.insert(outputs.end(), inherited.begin(), inherited.end());
+            queue.push_back(child);
+        }
+    }
+}
+
+bool LiteralMatcher::empty() const
+{
+    return this->patterns_.empty();
+}
+
+uint32_t LiteralMatcher::step(uint32_t state, char16_t c) const
+{
+    while (true)
+    {
+        const auto &node = this->nodes_[state];
+        auto it = node.next.find(c);
+        if (it != node.next.end())
+        {
+            return it->second;
+        }
+        if (state == 0)
+        {
+            return 0;
+        }
+        state = node.fail;
+    }
+}
+
+template <typename F>
+void LiteralMatcher::forEachMatch(QStringView text, F &&cb) const
+{
+    uint32_t state = 0;
+    for (SizeType i = 0; i < text.size(); i++)
+    {
+        state = this->step(state, fold(text[i].unicode()));
+        for (auto patternIdx : this->nodes_[state].outputs)
+        {
+            const auto &pattern = this->patterns_[patternIdx];
+            auto length = pattern.text.size();
+            auto start = i + 1 - length;
+            if (pattern.caseSensitive &&
+                text.mid(start, length) != QStringView{pattern.text})
+            {
+                continue;
+            }
+            if (!cb(pattern.id, start, length))
+            {
+                return;
+            }
+        }
+    }
+}
+
+}  // namespace chatterino::ignores::detail
+
+namespace chatterino {
+
+IgnoreRewriter::IgnoreRewriter(const std::vector<IgnorePhrase> &phrases)
+{
+    for (const auto &phrase : phrases)
+    {
+        if (!isUsable(phrase))
+        {
+            continue;
+        }
+
+        auto &list =
+            phrase.isBlock() ? this->blockPhrases_ : this->replacePhrases_;
+        auto &literals =
+            phrase.isBlock() ? this->blockLiterals_ : this->replaceLiterals_;
+        if (!phrase.isRegex())
+        {
+            literals.add(phrase.getPattern(), phrase.isCaseSensitive(),
+                         static_cast<uint32_t>(list.size()));
+        }
+        list.push_back(&phrase);
+    }
+
+    this->blockLiterals_.build();
+    this->replaceLiterals_.build();
+}
+
+IgnoreRewriter::~IgnoreRewriter() = default;
+
+std::shared_ptr<const IgnoreRewriter> IgnoreRewriter::fromSettings()
+{
+    static std::mutex mutex;
+    static std::shared_ptr<IgnoreRewriter> cached;
+
+    auto phrases = getSettings()->ignoredMessages.readOnly();
+
+    std::lock_guard lock(mutex);
+    if (!cached || cached->source_ != phrases)
+    {
+        cached.reset(new IgnoreRewriter(*phrases));
+        cached->source_ = std::move(phrases);
+    }
+    return cached;
+}
+
+const IgnorePhrase *IgnoreRewriter::findBlockingPhrase(
+    const QString &message) const
+{
+    if (message.isEmpty())
+    {
+        return nullptr;
+    }
+
+    // The phrase that comes first in the settings wins
+    auto first = this->blockPhrases_.size();
+    this->blockLiterals_.forEachMatch(message,
+                                      [&](uint32_t id, auto, auto) {
+                                          first = std::min<size_t>(first, id);
+                                          return first != 0;
+                                      });
+
+    for (size_t i = 0; i < first; i++)
+    {
+        const auto *phrase = this->blockPhrases_[i];
+        if (phrase->isRegex() &&
+            phrase->getRegex().match(message).hasMatch())
+        {
+            return phrase;
+        }
+    }
+
+    if (first < this->blockPhrases_.size())
+    {
+        return this->blockPhrases_[first];
+    }
+    return nullptr;
+}
+
+void IgnoreRewriter::rewrite(
+    QString &content, std::vector<TwitchEmoteOccurrence> &twitchEmotes) const
+{
+    if (this->replacePhrases_.empty())
+    {
+        return;
+    }
+
+    // Literal phrases that don't occur in the message can be skipped. Phrases
+    // are still applied in order, so a phrase can match the replacement of
+    // an earlier one.
+    std::vector<bool> matched(this->replacePhrases_.size());
+    this->scanLiterals(content, matched);
+
+    for (size_t i = 0; i < this->replacePhrases_.size(); i++)
+    {
+        const auto &phrase = *this->replacePhrases_[i];
+        if (!phrase.isRegex() && !matched[i])
+        {
+            continue;
+        }
+
+        switch (this->applyPhrase(phrase, content, twitchEmotes))
+        {
+            case PhraseResult::NoMatch:
+                break;
+            case PhraseResult::Replaced:
+                std::ranges::fill(matched, false);
+                this->scanLiterals(content, matched);
+                break;
+            case PhraseResult::TooManyReplacements:
+                return;
+        }
+    }
+}
+
+void IgnoreRewriter::scanLiterals(QStringView content,
+                                  std::vector<bool> &matched) const
+{
+    if (this->replaceLiterals_.empty())
+    {
+        return;
+    }
+
+    this->replaceLiterals_.forEachMatch(content, [&](uint32_t id, auto, auto) {
+        matched[id] = true;
+        return true;
+    });
+}
+
+IgnoreRewriter::PhraseResult IgnoreRewriter::applyPhrase(
+    const IgnorePhrase &phrase, QString &content,
+    std::vector<TwitchEmoteOccurrence> &twitchEmotes) const
+{
+    // 1. Find all (non-overlapping) matches in the current content
+    std::vector<Replacement> replacements;
+    if (phrase.isRegex())
+    {
+        const auto &regex = phrase.getRegex();
+        auto it = regex.globalMatch(content);
+        while (it.hasNext())
+        {
+            auto match = it.next();
+            if (replacements.size() + 1 >= MAX_REGEX_REPLACEMENTS)
+            {
+                content = u"Too many replacements - check your ignores!"_s;
+                return PhraseResult::TooManyReplacements;
+            }
+
+            auto text = phrase.getReplace();
+            if (regex.captureCount() > 0)
+            {
+                text = makeRegexReplacement(content, regex, match, text);
+            }
+            replacements.push_back({
+                .start = match.capturedStart(),
+                .length = match.capturedLength(),
+                .text = std::move(text),
+            });
+        }
+    }
+    else
+    {
+        const auto &pattern = phrase.getPattern();
+        SizeType from = 0;
+        while ((from = content.indexOf(pattern, from,
+                                       phrase.caseSensitivity())) != -1)
+        {
+            replacements.push_back({
+                .start = from,
+                .length = pattern.size(),
+                .text = phrase.getReplace(),
+            });
+            from += pattern.size();
+        }
+    }
+
+    if (replacements.empty())
+    {
+        return PhraseResult::NoMatch;
+    }
+
+    // 2. Write the content with all replacements into one buffer
+    SizeType newSize = content.size();
+    for (const auto &replacement : replacements)
+    {
+        newSize += replacement.text.size() - replacement.length;
+    }
+
+    QStringView source{content};
+    QString output;
+    output.reserve(newSize);
+    // Start of each replacement in the output
+    std::vector<SizeType> outputStarts;
+    outputStarts.reserve(replacements.size());
+    SizeType lastEnd = 0;
+    for (const auto &replacement : replacements)
+    {
+        output += source.mid(lastEnd, replacement.start - lastEnd);
+        outputStarts.push_back(output.size());
+        output += replacement.text;
+        lastEnd = replacement.start + replacement.length;
+    }
+    output += source.mid(lastEnd);
+
+    // 3. Move emotes behind the replacements, collect the ones inside of them
+    std::vector<std::vector<TwitchEmoteOccurrence>> removedEmotes(
+        replacements.size());
+    std::vector<TwitchEmoteOccurrence> emotes;
+    emotes.reserve(twitchEmotes.size());
+    for (auto &emote : twitchEmotes)
+    {
+        // The last replacement starting at or before the emote
+        auto it = std::ranges::upper_bound(replacements, SizeType{emote.start},
+                                           {}, &Replacement::start);
+        if (it == replacements.begin())
+        {
+            emotes.push_back(std::move(emote));
+            continue;
+        }
+
+        auto idx = static_cast<size_t>(it - replacements.begin() - 1);
+        const auto &replacement = replacements[idx];
+        auto end = replacement.start + replacement.length;
+        if (emote.start < end)
+        {
+            removedEmotes[idx].push_back(std::move(emote));
+            continue;
+        }
+
+        auto shift = static_cast<int>(outputStarts[idx] +
+                                      replacement.text.size() - end);
+        emote.start += shift;
+        emote.end += shift;
+        emotes.push_back(std::move(emote));
+    }
+
+    // 4. Find emotes in and around the replacements
+    for (size_t i = 0; i < replacements.size(); i++)
+    {
+        auto from = outputStarts[i];
+        auto wordStart = from;
+        while (wordStart > 0 && output[wordStart - 1] != ' ')
+        {
+            --wordStart;
+        }
+        auto wordEnd = from + replacements[i].text.size();
+        while (wordEnd < output.size() && output[wordEnd] != ' ')
+        {
+            ++wordEnd;
+        }
+        auto midExtendedRef =
+            QStringView{output}.mid(wordStart, wordEnd - wordStart);
+
+        for (auto &emote : removedEmotes[i])
+        {
+            if (emote.ptr == nullptr)
+            {
+                qCDebug(chatterinoTwitch)
+                    << "Invalid emote occurrence" << emote.name.string;
+                continue;
+            }
+            QRegularExpression emoteregex(
+                "\\b" + emote.name.string + "\\b",
+                QRegularExpression::UseUnicodePropertiesOption);
+#if QT_VERSION >= QT_VERSION_CHECK(6, 5, 0)
+            auto match = emoteregex.matchView(midExtendedRef);
+#else
+            auto match = emoteregex.match(midExtendedRef);
+#endif
+            if (match.hasMatch())
+            {
+                emote.start = static_cast<int>(from + match.capturedStart());
+                emote.end = static_cast<int>(from + match.capturedEnd());
+                emotes.push_back(std::move(emote));
+            }
+        }
+
+        if (!phrase.containsEmote())
+        {
+            continue;
+        }
+
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        auto words = midExtendedRef.tokenize(u' ');
+#else
+        auto words = midExtendedRef.split(' ');
+#endif
+        SizeType pos = 0;
+        for (const auto &word : words)
+        {
+            for (const auto &emote : phrase.getEmotes())
+            {
+                if (word == emote.first.string)
+                {
+                    if (emote.second == nullptr)
+                    {
+                        qCDebug(chatterinoTwitch)
+                            << "emote null" << emote.first.string;
+                    }
+                    emotes.push_back(TwitchEmoteOccurrence{
+                        static_cast<int>(wordStart + pos),
+                        static_cast<int>(wordStart + pos +
+                                         emote.first.string.length()),
+                        emote.second,
+                        emote.first,
+                    });
+                }
+            }
+            pos += word.length() + 1;
+        }
+    }
+
+    content = std::move(output);
+    twitchEmotes = std::move(emotes);
+    return PhraseResult::Replaced;
+}
+
+}  // namespace chatterino
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QString>
+#include <QStringView>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace chatterino {
+
+class IgnorePhrase;
+struct TwitchEmoteOccurrence;
+
+namespace ignores::detail {
+
+/// Finds occurrences of many literal patterns in a single pass over a text
+/// (Aho-Corasick).
+///
+/// Patterns and the text are compared case-folded. Matches of case-sensitive
+/// patterns are verified against the original text.
+class LiteralMatcher
+{
+public:
+    LiteralMatcher();
+
+    void add(const QString &pattern, bool caseSensitive, uint32_t id);
+
+    /// Must be called after all patterns are added and before matching
+    void build();
+
+    bool empty() const;
+
+    /// Calls `cb(id, start, length)` for every occurrence of every pattern
+    ///
+    /// If `cb` returns false, the search is stopped.
+    template <typename F>
+    void forEachMatch(QStringView text, F &&cb) const;
+
+private:
+    struct Pattern {
+        QString text;
+        bool caseSensitive;
+        uint32_t id;
+    };
+
+    struct Node {
+        std::unordered_map<char16_t, uint32_t> next;
+        uint32_t fail = 0;
+        /// Indices into `patterns_` of all patterns ending in this node
+        /// (including the ones reachable through `fail`)
+        std::vector<uint32_t> outputs;
+    };
+
+    uint32_t step(uint32_t state, char16_t c) const;
+
+    std::vector<Pattern> patterns_;
+    std::vector<Node> nodes_;
+};
+
+}  // namespace ignores::detail
+
+/// Compiled form of a list of ignore phrases
+///
+/// All literal phrases are put into one automaton, so a message only has to
+/// be scanned once to know which of them match. Regex phrases are run one
+/// after another.
+class IgnoreRewriter
+{
+public:
+    /// The phrases have to outlive the rewriter
+    explicit IgnoreRewriter(const std::vector<IgnorePhrase> &phrases);
+    ~IgnoreRewriter();
+
+    IgnoreRewriter(const IgnoreRewriter &) = delete;
+    IgnoreRewriter &operator=(const IgnoreRewriter &) = delete;
+    IgnoreRewriter(IgnoreRewriter &&) = delete;
+    IgnoreRewriter &operator=(IgnoreRewriter &&) = delete;
+
+    /// Returns the rewriter for the ignored phrases from the settings
+    ///
+    /// It's recompiled whenever the phrases change. This can be called from
+    /// any thread.
+    static std::shared_ptr<const IgnoreRewriter> fromSettings();
+
+    /// Returns the first block phrase that matches `message`, if any
+    const IgnorePhrase *findBlockingPhrase(const QString &message) const;
+
+    /// Applies all replace phrases to `content`
+    ///
+    /// @see processIgnorePhrases
+    void rewrite(QString &content,
+                 std::vector<TwitchEmoteOccurrence> &twitchEmotes) const;
+
+private:
+    enum class PhraseResult : uint8_t {
+        NoMatch,
+        Replaced,
+        /// The content was replaced with an error message
+        TooManyReplacements,
+    };
+
+    /// Replaces all matches of `phrase` in `content`
+    PhraseResult applyPhrase(
+        const IgnorePhrase &phrase, QString &content,
+        std::vector<TwitchEmoteOccurrence> &twitchEmotes) const;
+
+    /// Marks the replace phrases that occur literally in `content`
+    void scanLiterals(QStringView content, std::vector<bool> &matched) const;
+
+    /// Keeps the phrases alive if this was created from the settings
+    std::shared_ptr<const std::vector<IgnorePhrase>> source_;
+
+    std::vector<const IgnorePhrase *> blockPhrases_;
+    /// Ids are indices into `blockPhrases_`
+    ignores::detail::LiteralMatcher blockLiterals_;
+
+    std::vector<const IgnorePhrase *> replacePhrases_;
+    /// Ids are indices into `replacePhrases_`
+    ignores::detail::LiteralMatcher replaceLiterals_;
+};
+
+}  // namespace chatterino
@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#ifdef CHATTERINO_HAVE_PLUGINS
+#    include "controllers/plugins/MessageBatcher.hpp"
+
+#    include "controllers/plugins/LuaUtilities.hpp"
+#    include "controllers/plugins/Plugin.hpp"
+#    include "debug/AssertInGuiThread.hpp"
+#    include "messages/Message.hpp"
+
+#    include <lua.h>
+#    include <sol/sol.hpp>
+
+#    include <algorithm>
+
+namespace {
+
+using namespace chatterino;
+
+/// Set by instructionBudgetHook to tell a budget overrun apart from other errors
+thread_local bool instructionBudgetExceeded = false;
+
+void instructionBudgetHook(lua_State *L, lua_Debug * /* ar */)
+{
+    instructionBudgetExceeded = true;
+    lua::fail(L, "instruction budget of %d exceeded",
+              lua::MessageBatcher::INSTRUCTION_BUDGET);
+}
+
+}  // namespace
+
+namespace chatterino::lua {
+
+using namespace std::chrono_literals;
+
+MessageBatcher::MessageBatcher(PluginWeakRef pluginRef,
+                               sol::main_protected_function pfn)
+    : pluginRef(std::move(pluginRef))
+    , pfn(std::move(pfn))
+{
+    assert(this->pfn.valid());
+
+    this->flushTimer.setSingleShot(true);
+    this->flushTimer.setInterval(FLUSH_INTERVAL);
+    QObject::connect(&this->flushTimer, &QTimer::timeout, &this->flushTimer,
+                     [this] {
+                         this->flush();
+                     });
+}
+
+MessageBatcher::~MessageBatcher()
+{
+    assertInGuiThread();
+    if (!this->pluginRef.isAlive())
+    {
+        this->pfn.abandon();  // don't destruct the function in this case
+    }
+}
+
+void MessageBatcher::push(const MessagePtr &message)
+{
+    assertInGuiThread();
+
+    this->pending.push_back(message);
+    if (this->pending.size() >= MAX_BATCH_SIZE && !this->flushing)
+    {
+        this->flush();
+        return;
+    }
+
+    if (!this->flushTimer.isActive())
+    {
+        this->flushTimer.start();
+    }
+}
+
+void MessageBatcher::flush()
+{
+    this->flushTimer.stop();
+    if (this->pending.empty() || this->flushing)
+    {
+        return;
+    }
+
+    auto batch = std::exchange(this->pending, {});
+
+    auto strong = this->pluginRef.strong();
+    if (!strong)
+    {
+        return;
+    }
+    auto *plugin = strong.plugin();
+    auto &stats = plugin->messageHandlerStats;
+
+    auto start = std::chrono::steady_clock::now();
+    if (start < this->throttledUntil)
+    {
+        stats.droppedBatches++;
+        return;
+    }
+
+    // Plugins take messages as `Message`, but check that they're frozen
+    std::vector<MessagePtrMut> messages;
+    messages.reserve(batch.size());
+    for (const auto &msg : batch)
+    {
+        messages.emplace_back(std::const_pointer_cast<Message>(msg));
+    }
+
+    this->flushing = true;
+    auto *L = this->pfn.lua_state();
+    instructionBudgetExceeded = false;
+    lua_sethook(L, &instructionBudgetHook, LUA_MASKCOUNT, INSTRUCTION_BUDGET);
+    auto res = tryCall<void>(this->pfn, sol::as_table(messages));
+    lua_sethook(L, nullptr, 0, 0);
+    this->flushing = false;
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    stats.calls++;
+    stats.messages += batch.size();
+    stats.totalTime += elapsed;
+    stats.maxTime = std::max<std::chrono::nanoseconds>(stats.maxTime, elapsed);
+
+    if (instructionBudgetExceeded)
+    {
+        stats.budgetExceeded++;
+        this->throttle =
+            std::clamp(this->throttle * 2, MIN_THROTTLE, MAX_THROTTLE);
+        this->throttledUntil = start + this->throttle;
+        logError(plugin, u"Channel:on_messages",
+                 QStringLiteral("Handler exceeded its instruction budget, "
+                                "dropping messages for %1ms")
+                     .arg(this->throttle.count()));
+        return;
+    }
+
+    this->throttle = 0ms;
+    hasValueOrLog(res, u"Channel:on_messages", plugin);
+}
+
+}  // namespace chatterino::lua
+
+#endif
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#ifdef CHATTERINO_HAVE_PLUGINS
+
+#    include "controllers/plugins/PluginRef.hpp"
+#    include "controllers/plugins/SolTypes.hpp"
+
+#    include <QTimer>
+
+#    include <chrono>
+#    include <memory>
+#    include <vector>
+
+namespace chatterino {
+
+struct Message;
+using MessagePtr = std::shared_ptr<const Message>;
+
+}  // namespace chatterino
+
+namespace chatterino::lua {
+
+/// Delivers messages appended to a channel to a plugin callback in batches.
+///
+/// Messages are collected until MAX_BATCH_SIZE messages are pending or until
+/// the next frame, whichever comes first. Each call of the callback may execute
+/// at most INSTRUCTION_BUDGET Lua instructions. Once a call exceeds the budget,
+/// the handler is throttled: batches are dropped for a backoff period which
+/// doubles every time the budget is exceeded again.
+class MessageBatcher
+{
+public:
+    static constexpr size_t MAX_BATCH_SIZE = 100;
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL{16};
+    static constexpr int INSTRUCTION_BUDGET = 5'000'000;
+    static constexpr std::chrono::milliseconds MIN_THROTTLE{1000};
+    static constexpr std::chrono::milliseconds MAX_THROTTLE{60'000};
+
+    MessageBatcher(PluginWeakRef pluginRef, sol::main_protected_function pfn);
+    ~MessageBatcher();
+
+    MessageBatcher(const MessageBatcher &) = delete;
+    MessageBatcher(MessageBatcher &&) = delete;
+    MessageBatcher &operator=(const MessageBatcher &) = delete;
+    MessageBatcher &operator=(MessageBatcher &&) = delete;
+
+    void push(const MessagePtr &message);
+
+    /// Delivers all pending messages to the callback
+    void flush();
+
+private:
+    PluginWeakRef pluginRef;
+    sol::main_protected_function pfn;
+
+    std::vector<MessagePtr> pending;
+    QTimer flushTimer;
+    /// Set while the callback runs. Messages added by the callback itself are
+    /// delivered in the next batch.
+    bool flushing = false;
+
+    std::chrono::steady_clock::time_point throttledUntil;
+    std::chrono::milliseconds throttle{0};
+};
+
+}  // namespace chatterino::lua
+
+#endif
@@ -22,6 +22,25 @@
 
 namespace chatterino {
 
+QString PluginHandlerStats::toString() const
+{
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+
+    auto average = this->calls == 0 ? microseconds{0}
+                                    : duration_cast<microseconds>(
+                                          this->totalTime / this->calls);
+    return QStringLiteral(
+               "%1 batches (%2 messages), average %3µs, max %4µs, "
+               "budget exceeded %5 times, %6 batches dropped while throttled")
+        .arg(this->calls)
+        .arg(this->messages)
+        .arg(average.count())
+        .arg(duration_cast<microseconds>(this->maxTime).count())
+        .arg(this->budgetExceeded)
+        .arg(this->droppedBatches);
+}
+
 bool Plugin::registerCommand(const QString &name,
                              sol::protected_function function)
 {
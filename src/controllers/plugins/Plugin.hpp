@@ -18,6 +18,7 @@
 #    include <semver/semver.hpp>
 #    include <sol/forward.hpp>
 
+#    include <chrono>
 #    include <memory>
 #    include <optional>
 #    include <unordered_map>
@@ -37,6 +38,23 @@ struct SignalCallback;
 
 namespace chatterino {
 
+/// Timing statistics for the message handlers of a plugin
+/// (see lua::MessageBatcher)
+struct PluginHandlerStats {
+    /// Number of batches delivered to handlers
+    size_t calls = 0;
+    /// Number of messages in all delivered batches
+    size_t messages = 0;
+    std::chrono::nanoseconds totalTime{0};
+    std::chrono::nanoseconds maxTime{0};
+    /// Number of calls that were aborted because they ran out of budget
+    size_t budgetExceeded = 0;
+    /// Number of batches dropped while a handler was throttled
+    size_t droppedBatches = 0;
+
+    QString toString() const;
+};
+
 class Plugin
 {
 public:
@@ -128,6 +146,8 @@ public:
     // This is a lifetime hack to ensure they get deleted with the plugin. This relies on the Plugin getting deleted on reload!
     std::vector<std::shared_ptr<lua::api::HTTPRequest>> httpRequests;
 
+    PluginHandlerStats messageHandlerStats;
+
     boost::signals2::signal<void()> onUnloaded;
     boost::signals2::signal<void(lua::api::LogLevel, const QString &)> onLog;
     lua::ConnectionManager connections;
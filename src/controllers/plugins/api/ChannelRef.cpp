@@ -8,6 +8,7 @@
 #    include "Application.hpp"
 #    include "common/Channel.hpp"
 #    include "controllers/commands/CommandController.hpp"
+#    include "controllers/plugins/MessageBatcher.hpp"
 #    include "controllers/plugins/Plugin.hpp"
 #    include "controllers/plugins/SignalCallback.hpp"
 #    include "controllers/plugins/SolTypes.hpp"
@@ -254,6 +255,21 @@ api::ConnectionHandle ChannelRef::on_display_name_changed(
         plugin->createCallback(std::move(pfn)));
 }
 
+api::ConnectionHandle ChannelRef::on_messages(ThisPluginState state,
+                                              sol::main_protected_function pfn)
+{
+    auto *plugin = state.plugin();
+    // The batcher lives as long as the connection
+    auto batcher = std::make_shared<lua::MessageBatcher>(plugin->weakRef(),
+                                                         std::move(pfn));
+    return plugin->connections.managedConnect(
+        this->strong()->messageAppended,
+        [batcher](MessagePtr &message,
+                  std::optional<MessageFlags> /* overridingFlags */) {
+            batcher->push(message);
+        });
+}
+
 std::optional<ChannelRef> ChannelRef::get_by_name(const QString &name)
 {
     auto chan = getApp()->getTwitch()->getChannelOrEmpty(name);
@@ -304,6 +320,7 @@ void ChannelRef::createUserType(sol::table &c2)
         "count_messages", &ChannelRef::count_messages,
 
         "on_display_name_changed", &ChannelRef::on_display_name_changed,
+        "on_messages", &ChannelRef::on_messages,
 
         // TwitchChannel
         "get_room_modes", &ChannelRef::get_room_modes, 
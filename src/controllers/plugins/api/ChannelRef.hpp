@@ -257,6 +257,20 @@ public:
     ConnectionHandle on_display_name_changed(ThisPluginState state,
                                              sol::main_protected_function pfn);
 
+    /**
+     * Callback when messages are added to the channel.
+     *
+     * Messages are delivered in batches of up to 100 messages, at most once
+     * per frame. Each call may run a limited number of instructions. Handlers
+     * exceeding this budget are throttled and miss messages.
+     *
+     * @lua@param cb fun(messages: c2.Message[])
+     * @lua@return c2.ConnectionHandle hdl
+     * @exposed c2.Channel:on_messages
+     */
+    ConnectionHandle on_messages(ThisPluginState state,
+                                 sol::main_protected_function pfn);
+
     /**
      * Static functions
      */
@@ -13,9 +13,12 @@
 
 #define MINIAUDIO_IMPLEMENTATION
 #include <miniaudio.h>
+#include <QDateTime>
 #include <QFile>
+#include <QFileInfo>
 #include <QScopeGuard>
 
+#include <cassert>
 #include <memory>
 
 namespace {
@@ -26,6 +29,18 @@ using namespace chatterino;
 // returning the handle to idle letting the computer or monitors sleep
 constexpr const auto STOP_AFTER_DURATION = std::chrono::seconds(30);
 
+// The number of sounds that can play at the same time
+constexpr const size_t NUM_VOICES = 8;
+// The number of custom sounds we keep decoded in memory
+constexpr const size_t MAX_CACHED_SOUNDS = 8;
+// Longer sounds are streamed from their file instead of being decoded into
+// memory. With MAX_CACHED_SOUNDS, this bounds the memory used by the cache.
+constexpr const auto MAX_DECODED_DURATION = std::chrono::seconds(5);
+// A sound is played at most MAX_PLAYS_PER_WINDOW times within PLAY_WINDOW,
+// more plays are dropped
+constexpr const size_t MAX_PLAYS_PER_WINDOW = 3;
+constexpr const auto PLAY_WINDOW = std::chrono::milliseconds(500);
+
 void miniaudioLogCallback(void *userData, ma_uint32 level, const char *pMessage)
 {
     (void)userData;
@@ -62,16 +77,147 @@ void miniaudioLogCallback(void *userData, ma_uint32 level, const char *pMessage)
     }
 }
 
+/// Decode sounds to the format the engine mixes in, so they can be played
+/// without any conversion
+ma_decoder_config makeDecoderConfig(ma_engine *engine)
+{
+    return ma_decoder_config_init(ma_format_f32,
+                                  ma_engine_get_channels(engine),
+                                  ma_engine_get_sample_rate(engine));
+}
+
 }  // namespace
 
 namespace chatterino {
 
-// NUM_SOUNDS specifies how many simultaneous default ping sounds & decoders to create
-constexpr const auto NUM_SOUNDS = 4;
+struct MiniaudioBackend::DecodedSound {
+    DecodedSound(void *frames, ma_uint64 frameCount, QDateTime lastModified)
+        : frames(frames)
+        , frameCount(frameCount)
+        , lastModified(std::move(lastModified))
+    {
+    }
+
+    DecodedSound(QString streamPath, QDateTime lastModified)
+        : frames(nullptr)
+        , frameCount(0)
+        , lastModified(std::move(lastModified))
+        , streamPath(std::move(streamPath))
+    {
+    }
+
+    ~DecodedSound()
+    {
+        ma_free(this->frames, nullptr);
+    }
+
+    DecodedSound(const DecodedSound &) = delete;
+    DecodedSound(DecodedSound &&) = delete;
+    DecodedSound &operator=(const DecodedSound &) = delete;
+    DecodedSound &operator=(DecodedSound &&) = delete;
+
+    // Allocated by miniaudio
+    void *frames;
+    ma_uint64 frameCount;
+    // Modification time of the file when it was decoded
+    QDateTime lastModified;
+    // If set, the sound is too long to be kept in memory. It isn't decoded
+    // and `frames` is null; it's streamed from this file when it's played.
+    QString streamPath;
+
+    bool isStreamed() const
+    {
+        return !this->streamPath.isEmpty();
+    }
+};
+
+struct MiniaudioBackend::Voice {
+    ma_audio_buffer_ref buffer{};
+    ma_sound sound{};
+    bool initialized = false;
+
+    // The sound this voice was last initialized with. This keeps the frames
+    // alive while they're referenced by `buffer`.
+    std::shared_ptr<const DecodedSound> data;
+    std::chrono::steady_clock::time_point startedAt;
+
+    bool isPlaying()
+    {
+        return this->initialized && ma_sound_is_playing(&this->sound);
+    }
+
+    ma_result load(ma_engine *engine, std::shared_ptr<const DecodedSound> next)
+    {
+        this->unload();
+
+        ma_uint32 soundFlags = 0;
+        // Disable pitch control (we don't use it, so this saves some performance)
+        soundFlags |= MA_SOUND_FLAG_NO_PITCH;
+        // Disable spatialization control, this brings the volume up to "normal levels"
+        soundFlags |= MA_SOUND_FLAG_NO_SPATIALIZATION;
+
+        if (next->isStreamed())
+        {
+            ma_result result = ma_sound_init_from_file(
+                engine, qPrintable(next->streamPath),
+                soundFlags | MA_SOUND_FLAG_STREAM, nullptr, nullptr,
+                &this->sound);
+            if (result != MA_SUCCESS)
+            {
+                return result;
+            }
+
+            this->initialized = true;
+            this->data = std::move(next);
+            return MA_SUCCESS;
+        }
+
+        ma_result result = ma_audio_buffer_ref_init(
+            ma_format_f32, ma_engine_get_channels(engine), next->frames,
+            next->frameCount, &this->buffer);
+        if (result != MA_SUCCESS)
+        {
+            return result;
+        }
+
+        result = ma_sound_init_from_data_source(engine, &this->buffer,
+                                                soundFlags, nullptr,
+                                                &this->sound);
+        if (result != MA_SUCCESS)
+        {
+            ma_audio_buffer_ref_uninit(&this->buffer);
+            return result;
+        }
+
+        this->initialized = true;
+        this->data = std::move(next);
+        return MA_SUCCESS;
+    }
+
+    void unload()
+    {
+        if (!this->initialized)
+        {
+            return;
+        }
+
+        // Detaches the sound from the node graph, so the audio thread of
+        // miniaudio doesn't read from the buffer anymore
+        ma_sound_uninit(&this->sound);
+        if (!this->data->isStreamed())
+        {
+            ma_audio_buffer_ref_uninit(&this->buffer);
+        }
+        this->initialized = false;
+        this->data.reset();
+    }
+};
 
 MiniaudioBackend::MiniaudioBackend()
     : context(std::make_unique<ma_context>())
     , engine(std::make_unique<ma_engine>())
+    , soundCache(MAX_CACHED_SOUNDS)
+    , rateLimiter(MAX_PLAYS_PER_WINDOW, PLAY_WINDOW)
     , workGuard(boost::asio::make_work_guard(this->ioContext))
     , sleepTimer(this->ioContext)
 {
@@ -140,57 +286,36 @@ MiniaudioBackend::MiniaudioBackend()
             return;
         }
 
-        /// Initialize default ping sounds
+        /// Decode default ping sound
         {
-            // TODO: Can we optimize this?
             BenchmarkGuard b("init sounds");
 
-            ma_uint32 soundFlags = 0;
-            // Decode the sound during loading instead of during playback
-            soundFlags |= MA_SOUND_FLAG_DECODE;
-            // Disable pitch control (we don't use it, so this saves some performance)
-            soundFlags |= MA_SOUND_FLAG_NO_PITCH;
-            // Disable spatialization control, this brings the volume up to "normal levels"
-            soundFlags |= MA_SOUND_FLAG_NO_SPATIALIZATION;
-
-            auto decoderConfig =
-                ma_decoder_config_init(ma_format_f32, 0, 48000);
+            auto decoderConfig = makeDecoderConfig(this->engine.get());
             // This must match the encoding format of our default ping sound
             decoderConfig.encodingFormat = ma_encoding_format_wav;
 
-            for (auto i = 0; i < NUM_SOUNDS; ++i)
+            ma_uint64 frameCount = 0;
+            void *frames = nullptr;
+            result = ma_decode_memory(
+                this->defaultPingData.data(),
+                static_cast<size_t>(this->defaultPingData.size()),
+                &decoderConfig, &frameCount, &frames);
+            if (result != MA_SUCCESS)
             {
-                auto dec = std::make_unique<ma_decoder>();
-                auto snd = std::make_unique<ma_sound>();
-
-                result = ma_decoder_init_memory(
-                    (void *)this->defaultPingData.data(),
-                    this->defaultPingData.size() * sizeof(char), &decoderConfig,
-                    dec.get());
-                if (result != MA_SUCCESS)
-                {
-                    qCWarning(chatterinoSound) << "Error initializing default "
-                                                  "ping decoder from memory:"
-                                               << result;
-                    this->state = State::Failed;
-                    return;
-                }
-
-                result = ma_sound_init_from_data_source(this->engine.get(),
-                                                        dec.get(), soundFlags,
-                                                        nullptr, snd.get());
-                if (result != MA_SUCCESS)
-                {
-                    qCWarning(chatterinoSound)
-                        << "Error initializing default sound from data source:"
-                        << result;
-                    this->state = State::Failed;
-                    return;
-                }
-
-                this->defaultPingDecoders.emplace_back(std::move(dec));
-                this->defaultPingSounds.emplace_back(std::move(snd));
+                qCWarning(chatterinoSound)
+                    << "Error decoding default ping sound:" << result;
+                this->state = State::Failed;
+                return;
             }
+
+            this->defaultPing =
+                std::make_shared<const DecodedSound>(frames, frameCount,
+                                                     QDateTime{});
+        }
+
+        for (size_t i = 0; i < NUM_VOICES; ++i)
+        {
+            this->voices.emplace_back(std::make_unique<Voice>());
         }
 
         qCInfo(chatterinoSound) << "miniaudio sound system initialized";
@@ -213,13 +338,9 @@ MiniaudioBackend::~MiniaudioBackend()
     this->state = State::Stopping;
 
     boost::asio::post(this->ioContext, [this] {
-        for (const auto &snd : this->defaultPingSounds)
-        {
-            ma_sound_uninit(snd.get());
-        }
-        for (const auto &dec : this->defaultPingDecoders)
+        for (const auto &voice : this->voices)
         {
-            ma_decoder_uninit(dec.get());
+            voice->unload();
         }
 
         ma_engine_uninit(this->engine.get());
@@ -252,8 +373,6 @@ void MiniaudioBackend::play(const QUrl &sound)
     }
 
     boost::asio::post(this->ioContext, [this, sound] {
-        static size_t i = 0;
-
         this->tgPlay.guard();
 
         if (this->state != State::Initialized)
@@ -263,6 +382,21 @@ void MiniaudioBackend::play(const QUrl &sound)
             return;
         }
 
+        // Non-local urls all play the default sound, so they share a key
+        auto key = sound.isLocalFile() ? sound.toLocalFile() : QString();
+        if (!this->rateLimiter.tryPlay(key))
+        {
+            // The sound is already playing a few times, another one wouldn't
+            // be noticeable
+            return;
+        }
+
+        auto decoded = this->loadSound(sound);
+        if (!decoded)
+        {
+            return;
+        }
+
         auto result = ma_engine_start(this->engine.get());
         if (result != MA_SUCCESS)
         {
@@ -270,29 +404,26 @@ void MiniaudioBackend::play(const QUrl &sound)
             return;
         }
 
-        if (sound.isLocalFile())
+        auto &voice = this->acquireVoice(decoded.get());
+        if (voice.data != decoded)
         {
-            auto soundPath = sound.toLocalFile();
-            result = ma_engine_play_sound(this->engine.get(),
-                                          qPrintable(soundPath), nullptr);
+            result = voice.load(this->engine.get(), std::move(decoded));
             if (result != MA_SUCCESS)
             {
-                qCWarning(chatterinoSound) << "Failed to play sound" << sound
-                                           << soundPath << ":" << result;
+                qCWarning(chatterinoSound)
+                    << "Failed to initialize sound" << sound << ":" << result;
+                return;
             }
-
-            return;
         }
 
-        // Play default sound, loaded from our resources in the constructor
-        auto &snd = this->defaultPingSounds[++i % NUM_SOUNDS];
-        ma_sound_seek_to_pcm_frame(snd.get(), 0);
-        result = ma_sound_start(snd.get());
+        ma_sound_seek_to_pcm_frame(&voice.sound, 0);
+        result = ma_sound_start(&voice.sound);
         if (result != MA_SUCCESS)
         {
             qCWarning(chatterinoSound)
-                << "Failed to play default ping" << result;
+                << "Failed to play sound" << sound << ":" << result;
         }
+        voice.startedAt = std::chrono::steady_clock::now();
 
         this->sleepTimer.expires_after(STOP_AFTER_DURATION);
         this->sleepTimer.async_wait([this](const auto &ec) {
@@ -313,4 +444,115 @@ void MiniaudioBackend::play(const QUrl &sound)
     });
 }
 
+std::shared_ptr<const MiniaudioBackend::DecodedSound>
+    MiniaudioBackend::loadSound(const QUrl &sound)
+{
+    if (!sound.isLocalFile())
+    {
+        return this->defaultPing;
+    }
+
+    auto soundPath = sound.toLocalFile();
+    auto lastModified = QFileInfo(soundPath).lastModified();
+    if (this->soundCache.exists(soundPath))
+    {
+        const auto &cached = this->soundCache.get(soundPath);
+        if (cached->lastModified == lastModified)
+        {
+            return cached;
+        }
+    }
+
+    auto decoderConfig = makeDecoderConfig(this->engine.get());
+    ma_decoder decoder;
+    auto result =
+        ma_decoder_init_file(qPrintable(soundPath), &decoderConfig, &decoder);
+    if (result != MA_SUCCESS)
+    {
+        qCWarning(chatterinoSound)
+            << "Failed to decode sound" << sound << soundPath << ":" << result;
+        return nullptr;
+    }
+    auto decoderGuard = qScopeGuard([&] {
+        ma_decoder_uninit(&decoder);
+    });
+
+    auto maxFrameCount =
+        static_cast<ma_uint64>(ma_engine_get_sample_rate(this->engine.get()) *
+                               MAX_DECODED_DURATION.count());
+    ma_uint64 frameCount = 0;
+    result = ma_decoder_get_length_in_pcm_frames(&decoder, &frameCount);
+    if (result != MA_SUCCESS || frameCount == 0 || frameCount > maxFrameCount)
+    {
+        // Too long (or of unknown length) to be kept in memory
+        auto streamed =
+            std::make_shared<const DecodedSound>(soundPath, lastModified);
+        this->soundCache.put(soundPath, streamed);
+        return streamed;
+    }
+
+    auto bytesPerFrame =
+        ma_get_bytes_per_frame(decoder.outputFormat, decoder.outputChannels);
+    void *frames =
+        ma_malloc(static_cast<size_t>(frameCount * bytesPerFrame), nullptr);
+    if (!frames)
+    {
+        qCWarning(chatterinoSound)
+            << "Failed to allocate memory for sound" << soundPath;
+        return nullptr;
+    }
+
+    ma_uint64 framesRead = 0;
+    result =
+        ma_decoder_read_pcm_frames(&decoder, frames, frameCount, &framesRead);
+    if ((result != MA_SUCCESS && result != MA_AT_END) || framesRead == 0)
+    {
+        qCWarning(chatterinoSound)
+            << "Failed to decode sound" << sound << soundPath << ":" << result;
+        ma_free(frames, nullptr);
+        return nullptr;
+    }
+
+    auto decoded = std::make_shared<const DecodedSound>(frames, framesRead,
+                                                        lastModified);
+    this->soundCache.put(soundPath, decoded);
+    return decoded;
+}
+
+MiniaudioBackend::Voice &MiniaudioBackend::acquireVoice(
+    const DecodedSound *sound)
+{
+    Voice *idle = nullptr;
+    Voice *oldest = nullptr;
+    for (const auto &voice : this->voices)
+    {
+        if (voice->isPlaying())
+        {
+            if (!oldest || voice->startedAt < oldest->startedAt)
+            {
+                oldest = voice.get();
+            }
+            continue;
+        }
+
+        if (voice->data.get() == sound)
+        {
+            // Doesn't need to be initialized again
+            return *voice;
+        }
+        if (!idle)
+        {
+            idle = voice.get();
+        }
+    }
+
+    if (idle)
+    {
+        return *idle;
+    }
+
+    assert(oldest);
+    return *oldest;
+}
+
 }  // namespace chatterino
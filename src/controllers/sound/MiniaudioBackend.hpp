@@ -5,12 +5,14 @@
 #pragma once
 
 #include "controllers/sound/ISoundController.hpp"
+#include "controllers/sound/SoundRateLimiter.hpp"
 #include "util/OnceFlag.hpp"
 #include "util/ThreadGuard.hpp"
 
 #include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/steady_timer.hpp>
+#include <lrucache/lrucache.hpp>
 #include <QByteArray>
 #include <QString>
 #include <QUrl>
@@ -26,8 +28,6 @@ struct ma_engine;
 struct ma_device;
 struct ma_resource_manager;
 struct ma_context;
-struct ma_sound;
-struct ma_decoder;
 
 namespace chatterino {
 
@@ -60,14 +60,30 @@ private:
     // The engine is a high-level API for playing sounds from paths in a simple & efficient-enough manner
     std::unique_ptr<ma_engine> engine;
 
+    // PCM frames of a sound, decoded to the format of the engine, or the
+    // file of a sound that's too long to be decoded into memory
+    struct DecodedSound;
+    // A sound object that can play any decoded sound
+    struct Voice;
+
+    // Returns the decoded sound for the url, decoding and caching local files
+    // when they're first played (or when they changed). Long files aren't
+    // decoded, they're streamed when played.
+    std::shared_ptr<const DecodedSound> loadSound(const QUrl &sound);
+    // Returns an idle voice, preferring one that already plays `sound`.
+    // If all voices are busy, the one that started playing first is stolen.
+    Voice &acquireVoice(const DecodedSound *sound);
+
     // Stores the data of our default ping sounds
     QByteArray defaultPingData;
-    // Stores N decoders for simultaneous default ping playback.
-    // We can't use the engine API for this as this requires direct access to a custom data_source
-    std::vector<std::unique_ptr<ma_decoder>> defaultPingDecoders;
-    // Stores N sounds for simultaneous default ping playback
-    // We can't use the engine API for this as this requires direct access to a custom data_source
-    std::vector<std::unique_ptr<ma_sound>> defaultPingSounds;
+    // The default ping sound, decoded when initializing the engine
+    std::shared_ptr<const DecodedSound> defaultPing;
+    // Custom sounds by their local path
+    cache::lru_cache<QString, std::shared_ptr<const DecodedSound>> soundCache;
+    // Fixed pool of voices all sounds are played on
+    std::vector<std::unique_ptr<Voice>> voices;
+    // Drops plays of a sound if it's played too often in a short time
+    SoundRateLimiter rateLimiter;
 
     // Thread guard for the play method
     // Ensures play is only ever called from the same thread
@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "controllers/sound/SoundRateLimiter.hpp"
+
+namespace chatterino {
+
+SoundRateLimiter::SoundRateLimiter(size_t maxPlays,
+                                   std::chrono::milliseconds window)
+    : maxPlays_(maxPlays)
+    , window_(window)
+{
+}
+
+bool SoundRateLimiter::tryPlay(const QString &key, Clock::time_point now)
+{
+    // Forget about sounds that haven't been played in a while, so switching
+    // between many custom sounds doesn't keep their history around
+    std::erase_if(this->plays_, [&](const auto &it) {
+        return it.second.empty() || it.second.back() + this->window_ <= now;
+    });
+
+    auto &plays = this->plays_[key];
+    while (!plays.empty() && plays.front() + this->window_ <= now)
+    {
+        plays.pop_front();
+    }
+
+    if (plays.size() >= this->maxPlays_)
+    {
+        return false;
+    }
+
+    plays.push_back(now);
+    return true;
+}
+
+}  // namespace chatterino
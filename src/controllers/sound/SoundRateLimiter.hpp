@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QString>
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <unordered_map>
+
+namespace chatterino {
+
+/// @brief Limits how often the same sound is played
+///
+/// Bursts of highlights (e.g. a raid or a mass ping) would otherwise play the
+/// same sound dozens of times on top of each other. Plays above the limit are
+/// dropped, since they'd be indistinguishable from the ones already playing.
+///
+/// This isn't thread safe, the sound backend only uses it from its audio
+/// thread.
+class SoundRateLimiter
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Allows at most @a maxPlays plays of a sound within @a window
+    SoundRateLimiter(size_t maxPlays, std::chrono::milliseconds window);
+
+    /// @brief Records a play of @a key at @a now
+    ///
+    /// @returns true if the sound should be played, false if it was played
+    ///          too often recently
+    bool tryPlay(const QString &key, Clock::time_point now = Clock::now());
+
+private:
+    size_t maxPlays_;
+    std::chrono::milliseconds window_;
+
+    /// sound -> times of recent plays (oldest first)
+    std::unordered_map<QString, std::deque<Clock::time_point>> plays_;
+};
+
+}  // namespace chatterino
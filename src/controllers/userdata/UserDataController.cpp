@@ -8,10 +8,15 @@
 #include "util/CombinePath.hpp"
 #include "util/Helpers.hpp"
 
+#include <QtConcurrent>
+
 namespace {
 
 using namespace chatterino;
 
+/// Changes made within this window are written to disk together
+constexpr int SAVE_DEBOUNCE_MS = 2000;
+
 std::shared_ptr<pajlada::Settings::SettingManager> initSettingsInstance(
     const Paths &paths)
 {
@@ -23,8 +28,9 @@ std::shared_ptr<pajlada::Settings::SettingManager> initSettingsInstance(
 
     sm->setBackupEnabled(true);
     sm->setBackupSlots(9);
+    // Saves are debounced and triggered by UserDataController::scheduleSave
     sm->saveMethod =
-        pajlada::Settings::SettingManager::SaveMethod::SaveAllTheTime;
+        pajlada::Settings::SettingManager::SaveMethod::SaveManually;
 
     return sm;
 }
@@ -38,7 +44,50 @@ UserDataController::UserDataController(const Paths &paths)
     , setting("/users", this->sm)
 {
     this->sm->load();
-    this->users = this->setting.getValue();
+
+    std::array<Shard, SHARD_COUNT> shards;
+    for (const auto &[userID, user] : this->setting.getValue())
+    {
+        shards[shardIndex(userID)].emplace(userID, user);
+    }
+
+    auto snapshot = std::make_shared<Snapshot>();
+    for (size_t i = 0; i < SHARD_COUNT; ++i)
+    {
+        (*snapshot)[i] = std::make_shared<const Shard>(std::move(shards[i]));
+    }
+    this->users.set(std::move(snapshot));
+
+    this->saveTimer.setSingleShot(true);
+    this->saveTimer.setInterval(SAVE_DEBOUNCE_MS);
+    QObject::connect(&this->saveTimer, &QTimer::timeout, &this->saveTimer,
+                     [this] {
+                         this->startSave();
+                     });
+}
+
+UserDataController::~UserDataController()
+{
+    this->save();
+}
+
+size_t UserDataController::shardIndex(const QString &userID)
+{
+    return qHash(userID) % SHARD_COUNT;
+}
+
+const UserData *UserDataController::findUser(
+    const std::shared_ptr<const Snapshot> &snapshot,
+    const QString &userID) const
+{
+    const auto &shard = *(*snapshot)[shardIndex(userID)];
+    auto it = shard.find(userID);
+    if (it == shard.end())
+    {
+        return nullptr;
+    }
+
+    return &it->second;
 }
 
 std::optional<UserData> UserDataController::getUser(const QString &userID) const
@@ -48,21 +97,32 @@ std::optional<UserData> UserDataController::getUser(const QString &userID) const
         return std::nullopt;
     }
 
-    std::shared_lock lock(this->usersMutex);
-    auto it = this->users.find(userID);
-
-    if (it == this->users.end())
+    auto snapshot = this->users.get();
+    const auto *user = this->findUser(snapshot, userID);
+    if (user == nullptr)
     {
         return std::nullopt;
     }
 
-    return it->second;
+    return *user;
 }
 
-std::unordered_map<QString, UserData> UserDataController::getUsers() const
+std::optional<QColor> UserDataController::getUserColor(
+    const QString &userID) const
 {
-    std::shared_lock lock(this->usersMutex);
-    return this->users;
+    if (userID.isEmpty())
+    {
+        return std::nullopt;
+    }
+
+    auto snapshot = this->users.get();
+    const auto *user = this->findUser(snapshot, userID);
+    if (user == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    return user->color;
 }
 
 void UserDataController::setUserColor(const QString &userID,
@@ -73,64 +133,136 @@ void UserDataController::setUserColor(const QString &userID,
         return;
     }
 
-    std::unique_lock lock(this->usersMutex);
-
-    auto c = this->users;
-    auto it = c.find(userID);
     std::optional<QColor> finalColor =
         makeConditionedOptional(!colorString.isEmpty(), QColor(colorString));
-    if (it == c.end())
-    {
-        if (!finalColor)
+
+    this->update(userID, [&](UserData &user) {
+        if (!finalColor && user.isEmpty())
         {
             // Early out - user is not configured and will not get a new color
-            return;
+            return false;
         }
 
-        UserData user;
         user.color = finalColor;
-        c.insert({userID, user});
-    }
-    else
+        return true;
+    });
+}
+
+void UserDataController::setUserNotes(const QString &userID,
+                                      const QString &notes)
+{
+    if (userID.isEmpty())
     {
-        it->second.color = finalColor;
+        return;
     }
 
-    this->update(std::move(c), std::move(lock));
+    this->update(userID, [&](UserData &user) {
+        user.notes = notes;
+        return true;
+    });
 }
 
-void UserDataController::update(
-    std::unordered_map<QString, UserData> &&newUsers,
-    std::unique_lock<std::shared_mutex> usersLock)
+void UserDataController::update(const QString &userID,
+                                const std::function<bool(UserData &)> &fn)
 {
-    // Remove empty user data items
-    std::erase_if(newUsers, [](const auto &pair) {
-        return pair.second.isEmpty();
-    });
+    {
+        std::unique_lock lock(this->writeMutex);
+
+        auto oldSnapshot = this->users.get();
+        auto index = shardIndex(userID);
+        const auto &oldShard = *(*oldSnapshot)[index];
+
+        UserData user;
+        if (auto it = oldShard.find(userID); it != oldShard.end())
+        {
+            user = it->second;
+        }
 
-    this->users = std::move(newUsers);
-    this->setting.setValue(this->users);
+        if (!fn(user))
+        {
+            return;
+        }
+
+        auto shard = std::make_shared<Shard>(oldShard);
+        if (user.isEmpty())
+        {
+            // Remove empty user data items
+            shard->erase(userID);
+        }
+        else
+        {
+            (*shard)[userID] = std::move(user);
+        }
+
+        // Only the modified shard is copied, all others are shared with the
+        // previous snapshot
+        auto snapshot = std::make_shared<Snapshot>(*oldSnapshot);
+        (*snapshot)[index] = std::move(shard);
+        this->users.set(std::move(snapshot));
+    }
 
-    // unlock before invoking updated signal
-    usersLock.unlock();
+    this->scheduleSave();
 
+    // invoked after releasing the write lock
     this->userDataUpdated_.invoke();
 }
 
-void UserDataController::setUserNotes(const QString &userID,
-                                      const QString &notes)
+void UserDataController::scheduleSave()
 {
-    if (userID.isEmpty())
+    // The timer lives in the GUI thread, updates may come from anywhere
+    QMetaObject::invokeMethod(&this->saveTimer, [this] {
+        this->dirty = true;
+        this->saveTimer.start();
+    });
+}
+
+void UserDataController::startSave()
+{
+    if (this->pendingSave.isRunning())
     {
+        // Writes must not overtake each other. `dirty` is still set, so the
+        // changes are saved once the running write finished.
         return;
     }
 
-    std::unique_lock lock(this->usersMutex);
+    this->dirty = false;
+    this->pendingSave =
+        QtConcurrent::run([this, snapshot = this->users.get()] {
+            this->writeSnapshot(snapshot);
+        });
+    std::ignore = this->pendingSave.then(&this->saveTimer, [this] {
+        if (this->dirty && !this->saveTimer.isActive())
+        {
+            this->saveTimer.start();
+        }
+    });
+}
+
+void UserDataController::save()
+{
+    // An older write must not land after the one below
+    this->pendingSave.waitForFinished();
+
+    if (this->dirty)
+    {
+        this->saveTimer.stop();
+        this->dirty = false;
+        this->writeSnapshot(this->users.get());
+    }
+}
 
-    auto users = this->users;
-    users[userID].notes = notes;
+void UserDataController::writeSnapshot(
+    const std::shared_ptr<const Snapshot> &snapshot)
+{
+    std::unordered_map<QString, UserData> flat;
+    for (const auto &shard : *snapshot)
+    {
+        flat.insert(shard->begin(), shard->end());
+    }
 
-    this->update(std::move(users), std::move(lock));
+    std::unique_lock lock(this->saveMutex);
+    this->setting.setValue(std::move(flat));
+    this->sm->save();
 }
 
 pajlada::Signals::NoArgSignal &UserDataController::userDataUpdated()
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "common/Atomic.hpp"
 #include "controllers/userdata/UserData.hpp"
 #include "util/QStringHash.hpp"
 #include "util/RapidjsonHelpers.hpp"
@@ -13,10 +14,15 @@
 #include <pajlada/settings.hpp>
 #include <pajlada/signals/signal.hpp>
 #include <QColor>
+#include <QFuture>
 #include <QString>
+#include <QTimer>
 
+#include <array>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
-#include <shared_mutex>
 #include <unordered_map>
 
 namespace chatterino {
@@ -30,6 +36,10 @@ public:
 
     virtual std::optional<UserData> getUser(const QString &userID) const = 0;
 
+    // Get the color override for a user, if any
+    // Unlike getUser, this does not copy the rest of the user's data
+    virtual std::optional<QColor> getUserColor(const QString &userID) const = 0;
+
     virtual void setUserColor(const QString &userID,
                               const QString &colorString) = 0;
     virtual void setUserNotes(const QString &userID, const QString &notes) = 0;
@@ -41,11 +51,19 @@ class UserDataController : public IUserDataController
 {
 public:
     explicit UserDataController(const Paths &paths);
+    ~UserDataController() override;
+
+    UserDataController(const UserDataController &) = delete;
+    UserDataController(UserDataController &&) = delete;
+    UserDataController &operator=(const UserDataController &) = delete;
+    UserDataController &operator=(UserDataController &&) = delete;
 
     // Get extra data about a user
     // If the user does not have any extra data, return none
     std::optional<UserData> getUser(const QString &userID) const override;
 
+    std::optional<QColor> getUserColor(const QString &userID) const override;
+
     // Update or insert extra data for the user's color override
     void setUserColor(const QString &userID,
                       const QString &colorString) override;
@@ -55,19 +73,52 @@ public:
 
     pajlada::Signals::NoArgSignal &userDataUpdated() override;
 
+    // Write any pending changes to disk and wait for the write to finish
+    void save();
+
 private:
-    void update(std::unordered_map<QString, UserData> &&newUsers,
-                std::unique_lock<std::shared_mutex> usersLock);
+    // Users are split into shards so an update only has to copy the shard
+    // the user lives in. Shards are shared between snapshots.
+    static constexpr size_t SHARD_COUNT = 64;
+    using Shard = std::unordered_map<QString, UserData>;
+    using Snapshot = std::array<std::shared_ptr<const Shard>, SHARD_COUNT>;
+
+    static size_t shardIndex(const QString &userID);
 
-    std::unordered_map<QString, UserData> getUsers() const;
+    // Finds the user in the current snapshot
+    // The returned pointer is valid as long as the snapshot is alive
+    const UserData *findUser(const std::shared_ptr<const Snapshot> &snapshot,
+                             const QString &userID) const;
+
+    // Applies `fn` to a copy of the user's data and publishes a new snapshot
+    // with only the user's shard replaced
+    void update(const QString &userID,
+                const std::function<bool(UserData &)> &fn);
+
+    void scheduleSave();
+    /// Writes the current snapshot in the background unless a write is
+    /// still running
+    void startSave();
+
+    // Serializes the given snapshot into the setting and writes it to disk
+    void writeSnapshot(const std::shared_ptr<const Snapshot> &snapshot);
 
     // Stores a real-time list of users & their customizations
-    std::unordered_map<QString, UserData> users;
-    mutable std::shared_mutex usersMutex;
+    // Readers load the snapshot without taking any lock held by writers
+    Atomic<std::shared_ptr<const Snapshot>> users;
+    // Serializes writers
+    std::mutex writeMutex;
 
     std::shared_ptr<pajlada::Settings::SettingManager> sm;
     pajlada::Settings::Setting<std::unordered_map<QString, UserData>> setting;
     pajlada::Signals::NoArgSignal userDataUpdated_;
+
+    // Changes are coalesced and written in the background once this fires
+    QTimer saveTimer;
+    // Guards `sm` and `setting` while a write is in progress
+    std::mutex saveMutex;
+    QFuture<void> pendingSave;
+    bool dirty = false;
 };
 
 }  // namespace chatterino
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "debug/StartupProfiler.hpp"
+
+#include "common/QLogging.hpp"
+#include "debug/AssertInGuiThread.hpp"
+
+namespace {
+
+/// Number of phases that are active in the current thread
+thread_local size_t activePhases = 0;
+
+QString formatMs(qint64 ns)
+{
+    return QString::number(static_cast<double>(ns) / 1000000.0, 'f', 1) +
+           " ms";
+}
+
+}  // namespace
+
+namespace chatterino {
+
+StartupProfiler::Phase::Phase(const QString &name)
+    : index_(StartupProfiler::instance().begin(name))
+{
+}
+
+StartupProfiler::Phase::~Phase()
+{
+    StartupProfiler::instance().end(this->index_);
+}
+
+StartupProfiler::StartupProfiler()
+{
+    this->timer_.start();
+}
+
+StartupProfiler &StartupProfiler::instance()
+{
+    static StartupProfiler instance;
+    return instance;
+}
+
+void StartupProfiler::setEnabled(bool enabled)
+{
+    this->recording_ = enabled;
+}
+
+size_t StartupProfiler::begin(const QString &name)
+{
+    if (!this->recording_)
+    {
+        return NO_ENTRY;
+    }
+
+    std::lock_guard lock(this->mutex_);
+    this->entries_.push_back({
+        .name = name,
+        .start = this->timer_.nsecsElapsed(),
+        .duration = 0,
+        .depth = activePhases,
+        .background = !isGuiThread(),
+    });
+    activePhases++;
+
+    return this->entries_.size() - 1;
+}
+
+void StartupProfiler::end(size_t index)
+{
+    if (index == NO_ENTRY)
+    {
+        return;
+    }
+
+    activePhases--;
+
+    std::lock_guard lock(this->mutex_);
+    if (index >= this->entries_.size())
+    {
+        // The phase ended after the report
+        return;
+    }
+    auto &entry = this->entries_[index];
+    entry.duration = this->timer_.nsecsElapsed() - entry.start;
+}
+
+void StartupProfiler::mark(const QString &name)
+{
+    if (!this->recording_)
+    {
+        return;
+    }
+
+    std::lock_guard lock(this->mutex_);
+    this->entries_.push_back({
+        .name = name,
+        .start = this->timer_.nsecsElapsed(),
+        .depth = activePhases,
+        .background = !isGuiThread(),
+    });
+}
+
+void StartupProfiler::report()
+{
+    if (!this->recording_.exchange(false))
+    {
+        return;
+    }
+
+    std::lock_guard lock(this->mutex_);
+    qCInfo(chatterinoApp) << "Startup profile:";
+    for (const auto &entry : this->entries_)
+    {
+        QString line =
+            QString(static_cast<qsizetype>(entry.depth) * 2, u' ') +
+            entry.name;
+        if (entry.duration < 0)
+        {
+            line += " at " + formatMs(entry.start);
+        }
+        else
+        {
+            line += ": " + formatMs(entry.duration) + " (started at " +
+                    formatMs(entry.start) + ')';
+        }
+        if (entry.background)
+        {
+            line += " [background]";
+        }
+        qCInfo(chatterinoApp).noquote() << line;
+    }
+    this->entries_.clear();
+}
+
+}  // namespace chatterino
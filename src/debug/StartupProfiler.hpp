@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QString>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace chatterino {
+
+/// Records how long the phases of the startup take
+///
+/// Phases are only recorded if Chatterino was started with
+/// `--startup-profile` and until #report() is called, so the phases don't
+/// cost anything in a regular startup.
+class StartupProfiler
+{
+public:
+    /// Records the time between its construction and destruction as a phase
+    ///
+    /// Phases started while another phase is active in the same thread are
+    /// reported as children of that phase.
+    class Phase
+    {
+    public:
+        Phase(const QString &name);
+        ~Phase();
+
+        Phase(const Phase &) = delete;
+        Phase &operator=(const Phase &) = delete;
+
+        Phase(Phase &&) = delete;
+        Phase &operator=(Phase &&) = delete;
+
+    private:
+        size_t index_;
+    };
+
+    static StartupProfiler &instance();
+
+    void setEnabled(bool enabled);
+
+    /// Records a point in time (e.g. when the main window was shown)
+    void mark(const QString &name);
+
+    /// Logs all recorded phases and stops recording
+    void report();
+
+private:
+    StartupProfiler();
+
+    static constexpr size_t NO_ENTRY = static_cast<size_t>(-1);
+
+    struct Entry {
+        QString name;
+        /// Nanoseconds since the profiler was created
+        qint64 start = 0;
+        /// -1 for marks
+        qint64 duration = -1;
+        size_t depth = 0;
+        bool background = false;
+    };
+
+    size_t begin(const QString &name);
+    void end(size_t index);
+
+    std::atomic<bool> recording_{false};
+    QElapsedTimer timer_;
+
+    std::mutex mutex_;
+    std::vector<Entry> entries_;
+};
+
+}  // namespace chatterino
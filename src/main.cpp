@@ -8,6 +8,7 @@
 #include "common/Modes.hpp"
 #include "common/QLogging.hpp"
 #include "common/Version.hpp"
+#include "debug/StartupProfiler.hpp"
 #include "providers/IvrApi.hpp"
 #include "providers/NetworkConfigurationProvider.hpp"
 #include "providers/twitch/api/Helix.hpp"
@@ -80,6 +81,7 @@ int main(int argc, char **argv)
     ipc::initPaths(paths.get());
 
     const Args args(a, *paths);
+    StartupProfiler::instance().setEnabled(args.startupProfile);
 
 #ifdef CHATTERINO_WITH_CRASHPAD
     const auto crashpadHandler = installCrashHandler(args, *paths);
@@ -133,6 +135,7 @@ int main(int argc, char **argv)
 #endif
 
         Settings settings(args, paths->settingsDirectory);
+        StartupProfiler::instance().mark("settings loaded");
 
         Updates updates(*paths, settings);
 
@@ -0,0 +1,349 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/ColdMessageStore.hpp"
+
+#include "messages/Link.hpp"
+#include "messages/Message.hpp"
+#include "messages/MessageBuilder.hpp"
+#include "messages/MessageElement.hpp"
+#include "singletons/Fonts.hpp"
+
+#include <QDataStream>
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+/// Writes one field of every row
+template <typename Rows, typename Get>
+void writeColumn(QDataStream &stream, const Rows &rows, Get get)
+{
+    for (const auto &row : rows)
+    {
+        stream << get(row);
+    }
+}
+
+/// Reads one field of every row
+template <typename T, typename Rows, typename Set>
+void readColumn(QDataStream &stream, Rows &rows, Set set)
+{
+    for (auto &row : rows)
+    {
+        T value{};
+        stream >> value;
+        set(row, std::move(value));
+    }
+}
+
+}  // namespace
+
+namespace chatterino {
+
+ColdMessageStore::ColdMessageStore(size_t limit, Rebuild rebuild)
+    : limit_(limit)
+    , rebuild_(std::move(rebuild))
+{
+}
+
+void ColdMessageStore::push(const Message &message)
+{
+    if (this->limit_ == 0)
+    {
+        return;
+    }
+
+    Row row{
+        .serverReceivedTime = message.serverReceivedTime,
+        .flags = static_cast<int64_t>(message.flags.value()),
+        .id = message.id,
+        .loginName = message.loginName,
+        .displayName = message.displayName,
+        .userID = message.userID,
+        .channelName = message.channelName,
+        .messageText = message.messageText,
+        .searchText = message.searchText,
+        .ircData = message.ircData,
+        .usernameColor = message.usernameColor,
+        .highlightColor = message.highlightColor ? *message.highlightColor
+                                                 : QColor(),
+    };
+
+    std::unique_lock lock(this->mutex_);
+    this->open_.emplace_back(std::move(row));
+    if (this->open_.size() < BLOCK_SIZE)
+    {
+        return;
+    }
+
+    auto block = compress(this->open_);
+    this->open_.clear();
+    this->compressedCount_ += block.count;
+    this->blocks_.emplace_back(std::move(block));
+
+    while (!this->blocks_.empty() &&
+           this->compressedCount_ - this->blocks_.front().count >=
+               this->limit_)
+    {
+        this->compressedCount_ -= this->blocks_.front().count;
+        this->blocks_.pop_front();
+    }
+}
+
+size_t ColdMessageStore::size() const
+{
+    std::unique_lock lock(this->mutex_);
+    return this->compressedCount_ + this->open_.size();
+}
+
+size_t ColdMessageStore::compressedSize() const
+{
+    std::unique_lock lock(this->mutex_);
+    return this->compressedCount_;
+}
+
+void ColdMessageStore::clear()
+{
+    std::unique_lock lock(this->mutex_);
+    this->blocks_.clear();
+    this->compressedCount_ = 0;
+    this->open_.clear();
+}
+
+std::vector<MessagePtr> ColdMessageStore::find(
+    const std::function<bool(const MessagePtr &)> &predicate,
+    const QDateTime &before, size_t limit) const
+{
+    std::deque<Block> blocks;
+    std::vector<Row> open;
+    {
+        // The blocks are copied, so searching doesn't block pushing.
+        // Block::data is implicitly shared, so this is cheap.
+        std::unique_lock lock(this->mutex_);
+        blocks = this->blocks_;
+        open = this->open_;
+    }
+
+    // Collected newest first
+    std::vector<MessagePtr> result;
+    auto addMatching = [&](const std::vector<Row> &rows) {
+        for (auto it = rows.rbegin(); it != rows.rend(); it++)
+        {
+            if (result.size() >= limit)
+            {
+                return;
+            }
+            if (before.isValid() && it->serverReceivedTime >= before)
+            {
+                continue;
+            }
+
+            auto header = std::make_shared<Message>();
+            fillMessage(*header, *it);
+            if (predicate(header))
+            {
+                result.emplace_back(rebuild(*it));
+            }
+        }
+    };
+
+    addMatching(open);
+    for (auto it = blocks.rbegin(); it != blocks.rend(); it++)
+    {
+        if (result.size() >= limit)
+        {
+            break;
+        }
+        if (before.isValid() && it->oldest >= before)
+        {
+            // Every message in this block is too new
+            continue;
+        }
+        addMatching(decompress(*it));
+    }
+
+    std::ranges::reverse(result);
+    return result;
+}
+
+ColdMessageStore::Block ColdMessageStore::compress(const std::vector<Row> &rows)
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_15);
+
+    // Times are stored relative to the previous message, so they're small
+    qint64 previous = 0;
+    for (const auto &row : rows)
+    {
+        auto time = row.serverReceivedTime.toMSecsSinceEpoch();
+        stream << static_cast<qint64>(time - previous);
+        previous = time;
+    }
+    writeColumn(stream, rows, [](const Row &row) {
+        return static_cast<qint64>(row.flags);
+    });
+    writeColumn(stream, rows, [](const Row &row) {
+        return row.usernameColor.isValid() ? row.usernameColor.rgba() : 0U;
+    });
+    writeColumn(stream, rows, [](const Row &row) {
+        return row.highlightColor.isValid() ? row.highlightColor.rgba() : 0U;
+    });
+    writeColumn(stream, rows, [](const Row &row) -> const QString & {
+        return row.id;
+    });
+    writeColumn(stream, rows, [](const Row &row) -> const QString & {
+        return row.loginName;
+    });
+    writeColumn(stream, rows, [](const Row &row) -> const QString & {
+        return row.displayName;
+    });
+    writeColumn(stream, rows, [](const Row &row) -> const QString & {
+        return row.userID;
+    });
+    writeColumn(stream, rows, [](const Row &row) -> const QString & {
+        return row.channelName;
+    });
+    writeColumn(stream, rows, [](const Row &row) -> const QString & {
+        return row.messageText;
+    });
+    writeColumn(stream, rows, [](const Row &row) -> const QString & {
+        return row.searchText;
+    });
+    writeColumn(stream, rows, [](const Row &row) -> const QByteArray & {
+        return row.ircData;
+    });
+
+    return {
+        .data = qCompress(data),
+        .count = rows.size(),
+        .oldest = rows.front().serverReceivedTime,
+    };
+}
+
+std::vector<ColdMessageStore::Row> ColdMessageStore::decompress(
+    const Block &block)
+{
+    auto data = qUncompress(block.data);
+    QDataStream stream(data);
+    stream.setVersion(QDataStream::Qt_5_15);
+
+    std::vector<Row> rows(block.count);
+
+    qint64 time = 0;
+    readColumn<qint64>(stream, rows, [&](Row &row, qint64 delta) {
+        time += delta;
+        row.serverReceivedTime = QDateTime::fromMSecsSinceEpoch(time);
+    });
+    readColumn<qint64>(stream, rows, [](Row &row, qint64 flags) {
+        row.flags = flags;
+    });
+    readColumn<QRgb>(stream, rows, [](Row &row, QRgb color) {
+        if (color != 0)
+        {
+            row.usernameColor = QColor::fromRgba(color);
+        }
+    });
+    readColumn<QRgb>(stream, rows, [](Row &row, QRgb color) {
+        if (color != 0)
+        {
+            row.highlightColor = QColor::fromRgba(color);
+        }
+    });
+    readColumn<QString>(stream, rows, [](Row &row, QString value) {
+        row.id = std::move(value);
+    });
+    readColumn<QString>(stream, rows, [](Row &row, QString value) {
+        row.loginName = std::move(value);
+    });
+    readColumn<QString>(stream, rows, [](Row &row, QString value) {
+        row.displayName = std::move(value);
+    });
+    readColumn<QString>(stream, rows, [](Row &row, QString value) {
+        row.userID = std::move(value);
+    });
+    readColumn<QString>(stream, rows, [](Row &row, QString value) {
+        row.channelName = std::move(value);
+    });
+    readColumn<QString>(stream, rows, [](Row &row, QString value) {
+        row.messageText = std::move(value);
+    });
+    readColumn<QString>(stream, rows, [](Row &row, QString value) {
+        row.searchText = std::move(value);
+    });
+    readColumn<QByteArray>(stream, rows, [](Row &row, QByteArray value) {
+        row.ircData = std::move(value);
+    });
+
+    return rows;
+}
+
+void ColdMessageStore::fillMessage(Message &message, const Row &row)
+{
+    message.flags = MessageFlags(static_cast<MessageFlag>(row.flags));
+    message.serverReceivedTime = row.serverReceivedTime;
+    message.parseTime = row.serverReceivedTime.time();
+    message.id = row.id;
+    message.loginName = row.loginName;
+    message.displayName = row.displayName;
+    message.userID = row.userID;
+    message.channelName = row.channelName;
+    message.messageText = row.messageText;
+    message.searchText = row.searchText;
+    message.ircData = row.ircData;
+    message.usernameColor = row.usernameColor;
+    if (row.highlightColor.isValid())
+    {
+        message.highlightColor = std::make_shared<QColor>(row.highlightColor);
+    }
+}
+
+MessagePtr ColdMessageStore::rebuild(const Row &row) const
+{
+    if (!row.ircData.isEmpty() && this->rebuild_)
+    {
+        if (auto message = this->rebuild_(row.ircData))
+        {
+            // Flags that were changed after the message was received (e.g.
+            // Disabled after a timeout) aren't part of the IRC message
+            message->flags = MessageFlags(static_cast<MessageFlag>(row.flags));
+            return message;
+        }
+    }
+
+    return rebuildPlain(row);
+}
+
+MessagePtr ColdMessageStore::rebuildPlain(const Row &row)
+{
+    MessageBuilder builder;
+    fillMessage(builder.message(), row);
+
+    builder.emplace<TimestampElement>(row.serverReceivedTime.time());
+
+    if (row.displayName.isEmpty())
+    {
+        builder.emplace<TextElement>(row.messageText, MessageElementFlag::Text,
+                                     MessageColor::System);
+    }
+    else
+    {
+        MessageColor usernameColor = row.usernameColor.isValid()
+                                         ? MessageColor(row.usernameColor)
+                                         : MessageColor(MessageColor::Text);
+        builder
+            .emplace<TextElement>(row.displayName + ':',
+                                  MessageElementFlag::Username, usernameColor,
+                                  FontStyle::ChatMediumBold)
+            ->setLink({Link::UserInfo, row.displayName});
+        builder.emplace<TextElement>(row.messageText, MessageElementFlag::Text,
+                                     MessageColor::Text);
+    }
+
+    return builder.release();
+}
+
+}  // namespace chatterino
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QByteArray>
+#include <QColor>
+#include <QDateTime>
+#include <QString>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace chatterino {
+
+struct Message;
+using MessagePtr = std::shared_ptr<const Message>;
+
+/// @brief Compact storage for messages that scrolled out of a channel
+///
+/// A Message keeps its whole element tree, which makes long scrollback
+/// buffers expensive. Once a message is removed from the start of a
+/// channel's buffer, only the IRC message it was built from
+/// (Message::ircData) and the fields needed to search it are kept here: the
+/// time, flags, author, colors and text.
+///
+/// Messages are stored in blocks of #BLOCK_SIZE. When a block is full, its
+/// rows are written column by column (all times, then all flags, ...) and
+/// compressed with qCompress. Storing similar values next to each other
+/// compresses a lot better than storing them per message.
+///
+/// #find() turns stored messages back into Messages. Messages with IRC data
+/// are built again by the `rebuild` function passed to the constructor, the
+/// same way they were built when they were received. Other messages (and
+/// messages `rebuild` returns nullptr for) only consist of a timestamp, the
+/// username and the text.
+///
+/// This can be used from any thread. #find() must be called from the thread
+/// `rebuild` can be called from.
+class ColdMessageStore
+{
+public:
+    static constexpr size_t BLOCK_SIZE = 256;
+
+    /// Builds a message from its IRC data (see Message::ircData)
+    using Rebuild = std::function<MessagePtr(const QByteArray &ircData)>;
+
+    /// Keeps at most `limit` messages (rounded up to a full block)
+    explicit ColdMessageStore(size_t limit, Rebuild rebuild = {});
+
+    /// Stores `message` as the newest message
+    void push(const Message &message);
+
+    /// Returns the number of stored messages
+    size_t size() const;
+
+    /// Returns the number of messages in compressed blocks
+    size_t compressedSize() const;
+
+    void clear();
+
+    /// Returns the newest `limit` stored messages that `predicate` returns
+    /// true for (oldest first)
+    ///
+    /// `predicate` is called with a message that only has the fields of the
+    /// stored message (no elements), so only matching messages are rebuilt.
+    /// If `before` is valid, only messages received before it are searched.
+    /// Blocks are only decompressed until enough messages were found.
+    std::vector<MessagePtr> find(
+        const std::function<bool(const MessagePtr &)> &predicate,
+        const QDateTime &before = {}, size_t limit = SIZE_MAX) const;
+
+private:
+    struct Row {
+        QDateTime serverReceivedTime;
+        int64_t flags = 0;
+        QString id;
+        QString loginName;
+        QString displayName;
+        QString userID;
+        QString channelName;
+        QString messageText;
+        QString searchText;
+        QByteArray ircData;
+        /// Invalid if the message didn't have a color
+        QColor usernameColor;
+        QColor highlightColor;
+    };
+
+    struct Block {
+        QByteArray data;
+        size_t count = 0;
+        /// Time of the oldest message in this block
+        QDateTime oldest;
+    };
+
+    static Block compress(const std::vector<Row> &rows);
+    static std::vector<Row> decompress(const Block &block);
+    static void fillMessage(Message &message, const Row &row);
+    static MessagePtr rebuildPlain(const Row &row);
+    MessagePtr rebuild(const Row &row) const;
+
+    const size_t limit_;
+    const Rebuild rebuild_;
+
+    mutable std::mutex mutex_;
+    /// Compressed blocks, oldest first
+    std::deque<Block> blocks_;
+    size_t compressedCount_ = 0;
+    /// The newest messages, compressed once there are BLOCK_SIZE of them
+    std::vector<Row> open_;
+};
+
+}  // namespace chatterino
@@ -455,6 +455,11 @@ qreal Image::scale() const
     return this->scale_;
 }
 
+QSize Image::expectedSize() const
+{
+    return this->expectedSize_;
+}
+
 bool Image::isEmpty() const
 {
     return this->empty_;
@@ -510,6 +515,7 @@ void Image::actuallyLoad()
 {
     auto weak = weakOf(this);
     NetworkRequest(this->url().string)
+        .priority(NetworkRequestPriority::VisibleImage)
         .concurrent()
         .cache()
         .onSuccess([weak](auto result) {
@@ -100,6 +100,8 @@ public:
     std::optional<QPixmap> pixmapOrLoad() const;
     void load() const;
     qreal scale() const;
+    /// The size this image is expected to have before it's loaded
+    QSize expectedSize() const;
     bool isEmpty() const;
     int width() const;
     int height() const;
@@ -6,9 +6,12 @@
 
 #include <boost/circular_buffer.hpp>
 
+#include <atomic>
 #include <cassert>
+#include <cstdint>
 #include <mutex>
 #include <optional>
+#include <ranges>
 #include <shared_mutex>
 #include <utility>
 #include <vector>
@@ -19,6 +22,10 @@ template <typename T>
 class LimitedQueue
 {
 public:
+    /// A read-only view of (a part of) the queue, see #visit
+    using View = std::ranges::subrange<
+        typename boost::circular_buffer<T>::const_iterator>;
+
     LimitedQueue(size_t limit = 1000)
         : limit_(limit)
         , buffer_(limit)
@@ -64,6 +71,17 @@ public:
         return this->buffer_.size();
     }
 
+    /**
+     * @brief Return a counter that changes whenever the queue is modified
+     *
+     * Readers that keep a copy of the items can compare this to the value
+     * they saw when copying to find out if their copy is still up to date.
+     */
+    [[nodiscard]] uint64_t epoch() const
+    {
+        return this->epoch_.load(std::memory_order_acquire);
+    }
+
     /// Value Accessors
     // Copies of values are returned so that references aren't invalidated
 
@@ -125,6 +143,7 @@ public:
     void clear()
     {
         std::unique_lock lock(this->mutex_);
+        this->bumpEpoch();
 
         this->buffer_.clear();
     }
@@ -139,6 +158,7 @@ public:
     bool pushBack(const T &item, T &deleted)
     {
         std::unique_lock lock(this->mutex_);
+        this->bumpEpoch();
 
         bool full = this->buffer_.full();
         if (full)
@@ -158,6 +178,7 @@ public:
     bool pushBack(const T &item)
     {
         std::unique_lock lock(this->mutex_);
+        this->bumpEpoch();
 
         bool full = this->buffer_.full();
         this->buffer_.push_back(item);
@@ -177,6 +198,7 @@ public:
     std::vector<T> pushFront(const std::vector<T> &items)
     {
         std::unique_lock lock(this->mutex_);
+        this->bumpEpoch();
 
         size_t numToPush = std::min(items.size(), this->space());
         std::vector<T> pushed;
@@ -205,6 +227,7 @@ public:
     int replaceItem(const T &needle, const T &replacement)
     {
         std::unique_lock lock(this->mutex_);
+        this->bumpEpoch();
 
         Equals eq;
         for (size_t i = 0; i < this->buffer_.size(); ++i)
@@ -229,6 +252,7 @@ public:
     bool replaceItem(size_t index, const T &replacement, T *prev = nullptr)
     {
         std::unique_lock lock(this->mutex_);
+        this->bumpEpoch();
 
         if (index >= this->buffer_.size())
         {
@@ -257,6 +281,7 @@ public:
     int replaceItem(size_t hint, const T &needle, const T &replacement)
     {
         std::unique_lock lock(this->mutex_);
+        this->bumpEpoch();
 
         if (hint < this->buffer_.size() && this->buffer_[hint] == needle)
         {
@@ -287,6 +312,7 @@ public:
     bool insertBefore(const T &needle, const T &item)
     {
         std::unique_lock lock(this->mutex_);
+        this->bumpEpoch();
 
         Equals eq;
         for (auto it = this->buffer_.begin(); it != this->buffer_.end(); ++it)
@@ -313,6 +339,7 @@ public:
     bool insertAfter(const T &needle, const T &item)
     {
         std::unique_lock lock(this->mutex_);
+        this->bumpEpoch();
 
         Equals eq;
         for (auto it = this->buffer_.begin(); it != this->buffer_.end(); ++it)
@@ -328,6 +355,63 @@ public:
         return false;
     }
 
+    /**
+     * @brief Inserts the given item before the first item matching a predicate
+     *
+     * @param[in] pred predicate that will be applied to items
+     * @param[in] item the item to insert
+     * @return true if an insertion took place
+     */
+    template <typename Predicate>
+    bool insertBeforeIf(Predicate pred, const T &item)
+    {
+        std::unique_lock lock(this->mutex_);
+
+        for (auto it = this->buffer_.begin(); it != this->buffer_.end(); ++it)
+        {
+            if (pred(*it))
+            {
+                this->bumpEpoch();
+                this->buffer_.insert(it, item);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /// Zero-copy Accessors
+
+    /**
+     * @brief Calls `cb` with a view of all items without copying them
+     *
+     * The view is a random access range of `const T &` from front to back.
+     * The queue is locked (shared) while `cb` runs, so `cb` must not modify
+     * the queue and must not keep the view (or references into it) around.
+     *
+     * @return whatever `cb` returns
+     */
+    decltype(auto) visit(auto &&cb) const
+    {
+        std::shared_lock lock(this->mutex_);
+        return std::forward<decltype(cb)>(cb)(
+            View(this->buffer_.begin(), this->buffer_.end()));
+    }
+
+    /**
+     * @brief Calls `cb` with a view of the last `nItems` items
+     *
+     * Same as #visit, but only the last `nItems` items (or fewer if the queue
+     * isn't that large) are part of the view.
+     */
+    decltype(auto) visitLastN(size_t nItems, auto &&cb) const
+    {
+        std::shared_lock lock(this->mutex_);
+        return std::forward<decltype(cb)>(cb)(
+            View(this->buffer_.end() - std::min(nItems, this->buffer_.size()),
+                 this->buffer_.end()));
+    }
+
     [[nodiscard]] std::vector<T> getSnapshot() const
     {
         std::shared_lock lock(this->mutex_);
@@ -447,7 +531,14 @@ public:
     }
 
 private:
+    /// Must be called while holding a unique lock
+    void bumpEpoch()
+    {
+        this->epoch_.fetch_add(1, std::memory_order_release);
+    }
+
     mutable std::shared_mutex mutex_;
+    std::atomic<uint64_t> epoch_{0};
 
     const size_t limit_;
     boost::circular_buffer<T> buffer_;
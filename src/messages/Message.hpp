@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include "controllers/filters/FilterVerdictCache.hpp"
 #include "messages/MessageFlag.hpp"
 #include "providers/twitch/ChannelPointReward.hpp"
 #include "util/DebugCount.hpp"
 #include "util/QStringHash.hpp"
 
+#include <QByteArray>
 #include <QColor>
 #include <QTime>
 
@@ -59,6 +61,9 @@ struct Message {
     QString channelName;
     QColor usernameColor;
     QDateTime serverReceivedTime;
+    /// The IRC message this was built from, if it can be built from it again
+    /// (see ColdMessageStore)
+    QByteArray ircData;
 
     /// List of Twitch badges associated with this message
     std::vector<TwitchBadge> twitchBadges;
@@ -113,6 +118,12 @@ struct Message {
     /// true.
     mutable bool frozen = false;
 
+    /// Results of filters that were run on this message
+    ///
+    /// Shared by all views showing this message, so each filter only has to
+    /// run once per message. Only used from the GUI thread.
+    mutable FilterVerdictCache filterVerdicts;
+
     std::vector<std::unique_ptr<MessageElement>> elements;
 
     ScrollbarHighlight getScrollBarHighlight() const;
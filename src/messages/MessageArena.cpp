@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/MessageArena.hpp"
+
+#include "util/DebugCount.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace {
+
+/// All allocations are aligned to this
+constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+
+constexpr size_t alignUp(size_t size)
+{
+    return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+}  // namespace
+
+namespace chatterino {
+
+struct MessageArena::Block {
+    /// One reference is held by the arena while this is its current block,
+    /// one by every live allocation
+    std::atomic<size_t> refs{1};
+    size_t capacity = 0;
+    size_t used = 0;
+
+    /// The data follows the (padded) header
+    std::byte *data()
+    {
+        return reinterpret_cast<std::byte *>(this) + alignUp(sizeof(Block));
+    }
+};
+
+namespace {
+
+/// Every allocation is prefixed with a pointer to its block, or `nullptr` if
+/// it lives on the heap. The prefix is padded to keep the alignment.
+constexpr size_t PREFIX_SIZE = alignUp(sizeof(void *));
+
+}  // namespace
+
+MessageArena::~MessageArena()
+{
+    if (this->current_)
+    {
+        release(this->current_);
+    }
+}
+
+void *MessageArena::allocate(size_t size)
+{
+    size_t needed = PREFIX_SIZE + alignUp(size);
+    if (needed > MAX_BLOCK_SIZE / 2)
+    {
+        return allocateHeap(size);
+    }
+
+    if (!this->current_ ||
+        this->current_->used + needed > this->current_->capacity)
+    {
+        if (this->current_)
+        {
+            release(this->current_);
+        }
+
+        auto capacity = this->nextBlockSize_;
+        this->nextBlockSize_ = std::min(capacity * 2, MAX_BLOCK_SIZE);
+
+        auto *memory = ::operator new(alignUp(sizeof(Block)) + capacity);
+        this->current_ = new (memory) Block;
+        this->current_->capacity = capacity;
+        DebugCount::increase(DebugObject::MessageArenaBlock);
+    }
+
+    auto *prefix = this->current_->data() + this->current_->used;
+    this->current_->used += needed;
+    this->current_->refs.fetch_add(1, std::memory_order_relaxed);
+
+    *reinterpret_cast<Block **>(prefix) = this->current_;
+    return prefix + PREFIX_SIZE;
+}
+
+void *MessageArena::allocateHeap(size_t size)
+{
+    auto *prefix = static_cast<std::byte *>(::operator new(PREFIX_SIZE + size));
+    *reinterpret_cast<Block **>(prefix) = nullptr;
+    return prefix + PREFIX_SIZE;
+}
+
+void MessageArena::deallocate(void *ptr) noexcept
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    auto *prefix = static_cast<std::byte *>(ptr) - PREFIX_SIZE;
+    auto *block = *reinterpret_cast<Block **>(prefix);
+    if (!block)
+    {
+        ::operator delete(prefix);
+        return;
+    }
+
+    release(block);
+}
+
+void MessageArena::reset()
+{
+    if (this->current_ &&
+        this->current_->refs.load(std::memory_order_acquire) == 1)
+    {
+        this->current_->used = 0;
+    }
+}
+
+void MessageArena::release(Block *block) noexcept
+{
+    if (block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        block->~Block();
+        ::operator delete(block);
+        DebugCount::decrease(DebugObject::MessageArenaBlock);
+    }
+}
+
+}  // namespace chatterino
@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+
+namespace chatterino {
+
+/// A bump allocator for message elements and layout elements.
+///
+/// Memory is handed out from blocks that are shared by all allocations made
+/// through the arena. Every allocation holds a reference to its block, so
+/// allocations may outlive the arena and may be freed from any thread. A
+/// block is freed once the arena has moved past it and all allocations in it
+/// are gone.
+///
+/// Every allocation (including ones from `allocateHeap`) is prefixed with a
+/// pointer to its block, so `deallocate` can free either kind. This lets
+/// classes with an arena-aware `operator new` keep using `std::unique_ptr`
+/// with the default deleter.
+class MessageArena
+{
+public:
+    MessageArena() = default;
+    ~MessageArena();
+
+    MessageArena(const MessageArena &) = delete;
+    MessageArena &operator=(const MessageArena &) = delete;
+
+    MessageArena(MessageArena &&) = delete;
+    MessageArena &operator=(MessageArena &&) = delete;
+
+    /// Allocates `size` bytes from this arena
+    ///
+    /// Large allocations fall back to the heap.
+    void *allocate(size_t size);
+
+    /// Allocates `size` bytes on the heap in a way `deallocate` understands
+    static void *allocateHeap(size_t size);
+
+    /// Frees memory returned by `allocate` or `allocateHeap`
+    static void deallocate(void *ptr) noexcept;
+
+    /// Rewinds the current block if nothing allocated from it is alive anymore
+    ///
+    /// Used when everything allocated in the arena was just freed, e.g. when a
+    /// layout is recreated.
+    void reset();
+
+private:
+    struct Block;
+
+    static void release(Block *block) noexcept;
+
+    Block *current_ = nullptr;
+    size_t nextBlockSize_ = MIN_BLOCK_SIZE;
+
+    static constexpr size_t MIN_BLOCK_SIZE = 512;
+    static constexpr size_t MAX_BLOCK_SIZE = 8192;
+};
+
+}  // namespace chatterino
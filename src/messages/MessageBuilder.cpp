@@ -14,6 +14,7 @@
 #include "controllers/highlights/HighlightResult.hpp"
 #include "controllers/ignores/IgnoreController.hpp"
 #include "controllers/ignores/IgnorePhrase.hpp"
+#include "controllers/ignores/IgnoreRewriter.hpp"
 #include "controllers/userdata/UserDataController.hpp"
 #include "messages/Emote.hpp"
 #include "messages/Image.hpp"
@@ -21,6 +22,7 @@
 #include "messages/MessageColor.hpp"
 #include "messages/MessageElement.hpp"
 #include "messages/MessageThread.hpp"
+#include "messages/SharedChatMessageCache.hpp"
 #include "providers/bttv/BttvBadges.hpp"
 #include "providers/bttv/BttvEmotes.hpp"
 #include "providers/chatterino/ChatterinoBadges.hpp"
@@ -191,7 +193,8 @@ void actuallyTriggerHighlights(const QString &channelName, bool playSound,
     }
 }
 
-QString stylizeUsername(const QString &username, const Message &message)
+QString stylizeUsername(const QString &username, const Message &message,
+                        UsernameDisplayMode displayMode)
 {
     const QString &localizedName = message.localizedName;
     bool hasLocalizedName = !localizedName.isEmpty();
@@ -199,7 +202,7 @@ QString stylizeUsername(const QString &username, const Message &message)
     // The full string that will be rendered in the chat widget
     QString usernameText;
 
-    switch (getSettings()->usernameDisplayMode.getValue())
+    switch (displayMode)
     {
         case UsernameDisplayMode::Username: {
             usernameText = username;
@@ -261,7 +264,8 @@ std::optional<EmotePtr> getTwitchBadge(const TwitchBadge &badge,
 void appendBadges(MessageBuilder *builder,
                   const std::vector<TwitchBadge> &badges,
                   const std::unordered_map<QString, QString> &badgeInfos,
-                  const TwitchChannel *twitchChannel)
+                  const TwitchChannel *twitchChannel,
+                  const PipelineSettings &settings)
 {
     if (twitchChannel == nullptr)
     {
@@ -283,7 +287,7 @@ void appendBadges(MessageBuilder *builder,
             tooltip = QString("Twitch cheer %0").arg(cheerAmount);
         }
         else if (badge.key_ == "moderator" &&
-                 getSettings()->useCustomFfzModeratorBadges)
+                 settings.useCustomFfzModeratorBadges)
         {
             if (auto customModBadge = twitchChannel->ffzCustomModBadge())
             {
@@ -296,7 +300,7 @@ void appendBadges(MessageBuilder *builder,
                 continue;
             }
         }
-        else if (badge.key_ == "vip" && getSettings()->useCustomFfzVipBadges)
+        else if (badge.key_ == "vip" && settings.useCustomFfzVipBadges)
         {
             if (auto customVipBadge = twitchChannel->ffzCustomVipBadge())
             {
@@ -518,6 +522,14 @@ EmotePtr parseEmote(TwitchChannel *twitchChannel, const EmoteName &name)
     return {};
 }
 
+void resolveLinkInfo(LinkElement *link)
+{
+    if (!getSettings()->linkInfoOnHover)
+    {
+        getApp()->getLinkResolver()->resolve(link->linkInfo());
+    }
+}
+
 }  // namespace
 
 namespace chatterino {
@@ -1051,7 +1063,7 @@ void MessageBuilder::addLink(const linkparser::Parsed &parsedLink,
                                    MessageElementFlag::Text, this->textColor_);
     }
 
-    getApp()->getLinkResolver()->resolve(el->linkInfo());
+    resolveLinkInfo(el);
 }
 
 bool MessageBuilder::isIgnored(const QString &originalMessage,
@@ -1560,7 +1572,9 @@ std::pair<MessagePtrMut, HighlightAlert> MessageBuilder::makeIrcMessage(
 {
     assert(ircMessage != nullptr);
     assert(channel != nullptr);
+    assert(args.settings != nullptr);
 
+    const auto &settings = *args.settings;
     auto tags = ircMessage->tags();
     if (args.allowIgnore)
     {
@@ -1577,7 +1591,7 @@ std::pair<MessagePtrMut, HighlightAlert> MessageBuilder::makeIrcMessage(
     auto userID = tags.value("user-id").toString();
 
     MessageBuilder builder;
-    builder.parseUsernameColor(tags, userID);
+    builder.parseUsernameColor(tags, userID, settings);
     builder->userID = userID;
 
     if (args.isAction)
@@ -1643,7 +1657,7 @@ std::pair<MessagePtrMut, HighlightAlert> MessageBuilder::makeIrcMessage(
     }
 
     // reply threads
-    builder.parseThread(content, tags, channel, thread, parent);
+    builder.parseThread(content, tags, channel, thread, parent, settings);
 
     // timestamp
     builder->serverReceivedTime = calculateMessageTime(ircMessage);
@@ -1670,7 +1684,7 @@ std::pair<MessagePtrMut, HighlightAlert> MessageBuilder::makeIrcMessage(
         builder.emplace<TwitchModerationElement>();
     }
 
-    builder.appendTwitchBadges(tags, twitchChannel);
+    builder.appendTwitchBadges(tags, twitchChannel, settings);
 
     builder.appendChatterinoBadges(userID);
     builder.appendFfzBadges(twitchChannel, userID);
@@ -1679,7 +1693,10 @@ std::pair<MessagePtrMut, HighlightAlert> MessageBuilder::makeIrcMessage(
 
     builder.appendUsername(tags, args);
 
-    TextState textState{.twitchChannel = twitchChannel};
+    TextState textState{
+        .settings = settings,
+        .twitchChannel = twitchChannel,
+    };
     QString bits;
 
     auto iterator = tags.find("bits");
@@ -1690,30 +1707,62 @@ std::pair<MessagePtrMut, HighlightAlert> MessageBuilder::makeIrcMessage(
         bits = iterator.value().toString();
     }
 
-    // Twitch emotes
-    auto twitchEmotes =
-        parseTwitchEmotes(tags, content, static_cast<int>(messageOffset));
+    // In shared chat sessions, the same message arrives in every channel of
+    // the session. If the source channel is joined, all copies are built
+    // against it, so the text of the first copy can be reused.
+    QString sharedRoomID;
+    if (twitchChannel != nullptr && !builder->id.isEmpty())
+    {
+        auto sourceRoom = tags.value("source-room-id").toString();
+        if (!sourceRoom.isEmpty() && sourceRoom == twitchChannel->roomId())
+        {
+            sharedRoomID = sourceRoom;
+        }
+    }
+
+    const auto textBegin = builder->elements.size();
+    bool textCopied = false;
+    if (!sharedRoomID.isEmpty())
+    {
+        auto entry = SharedChatMessageCache::instance().find(builder->id,
+                                                             sharedRoomID);
+        auto source = entry ? entry->message.lock() : nullptr;
+        if (source && entry->settings == args.settings &&
+            builder.appendCopies(*source, entry->begin, entry->end))
+        {
+            content = entry->content;
+            textCopied = true;
+        }
+    }
 
-    // This runs through all ignored phrases and runs its replacements on content
-    processIgnorePhrases(*getSettings()->ignoredMessages.readOnly(), content,
-                         twitchEmotes);
+    if (!textCopied)
+    {
+        // Twitch emotes
+        auto twitchEmotes =
+            parseTwitchEmotes(tags, content, static_cast<int>(messageOffset));
 
-    std::ranges::sort(twitchEmotes, [](const auto &a, const auto &b) {
-        return a.start < b.start;
-    });
-    auto uniqueEmotes = std::ranges::unique(
-        twitchEmotes, [](const auto &first, const auto &second) {
-            return first.start == second.start;
+        // This runs through all ignored phrases and runs its replacements on
+        // content
+        IgnoreRewriter::fromSettings()->rewrite(content, twitchEmotes);
+
+        std::ranges::sort(twitchEmotes, [](const auto &a, const auto &b) {
+            return a.start < b.start;
         });
-    twitchEmotes.erase(uniqueEmotes.begin(), uniqueEmotes.end());
+        auto uniqueEmotes = std::ranges::unique(
+            twitchEmotes, [](const auto &first, const auto &second) {
+                return first.start == second.start;
+            });
+        twitchEmotes.erase(uniqueEmotes.begin(), uniqueEmotes.end());
 
-    // words
-    QStringList splits = content.split(' ');
+        // words
+        QStringList splits = content.split(' ');
 
-    builder.addWords(splits, twitchEmotes, textState);
+        builder.addWords(splits, twitchEmotes, textState);
+    }
+    const auto textEnd = builder->elements.size();
 
-    QString stylizedUsername =
-        stylizeUsername(builder->loginName, builder.message());
+    QString stylizedUsername = stylizeUsername(
+        builder->loginName, builder.message(), settings.usernameDisplayMode);
 
     builder->messageText = content;
     builder->searchText = stylizedUsername + " " + builder->localizedName +
@@ -1729,7 +1778,7 @@ std::pair<MessagePtrMut, HighlightAlert> MessageBuilder::makeIrcMessage(
     }
 
     // highlighting incoming whispers if requested per setting
-    if (args.isReceivedWhisper && getSettings()->highlightInlineWhispers)
+    if (args.isReceivedWhisper && settings.highlightInlineWhispers)
     {
         builder->flags.set(MessageFlag::HighlightedWhisper);
         builder->highlightColor =
@@ -1758,6 +1807,19 @@ std::pair<MessagePtrMut, HighlightAlert> MessageBuilder::makeIrcMessage(
         }
     }
 
+    if (!sharedRoomID.isEmpty() && !textCopied)
+    {
+        SharedChatMessageCache::instance().insert(
+            builder->id, sharedRoomID,
+            {
+                .message = builder.weakOf(),
+                .begin = textBegin,
+                .end = textEnd,
+                .content = content,
+                .settings = args.settings,
+            });
+    }
+
     return {builder.release(), highlight};
 }
 
@@ -1779,7 +1841,7 @@ void MessageBuilder::addTextOrEmote(TextState &state, QString string)
     // Emote name: "forsenPuke" - if string in ignoredEmotes
     // Will match emote regardless of source (i.e. bttv, ffz)
     // Emote source + name: "bttv:nyanPls"
-    if (this->tryAppendEmote(state.twitchChannel, {string}))
+    if (this->tryAppendEmote(state, {string}))
     {
         // Successfully appended an emote
         return;
@@ -1830,7 +1892,7 @@ void MessageBuilder::addTextOrEmote(TextState &state, QString string)
         }
     }
 
-    if (state.twitchChannel != nullptr && getSettings()->findAllUsernames)
+    if (state.twitchChannel != nullptr && state.settings.findAllUsernames)
     {
         auto match = allUsernamesMentionRegex.match(string);
         QString username = match.captured(1);
@@ -1893,19 +1955,17 @@ TextElement *MessageBuilder::emplaceSystemTextAndUpdate(const QString &text,
 }
 
 void MessageBuilder::parseUsernameColor(const QVariantMap &tags,
-                                        const QString &userID)
+                                        const QString &userID,
+                                        const PipelineSettings &settings)
 {
     const auto *userData = getApp()->getUserData();
     assert(userData != nullptr);
 
-    if (const auto &user = userData->getUser(userID))
+    if (auto color = userData->getUserColor(userID))
     {
-        if (user->color)
-        {
-            this->usernameColor_ = user->color.value();
-            this->message().usernameColor = this->usernameColor_;
-            return;
-        }
+        this->usernameColor_ = *color;
+        this->message().usernameColor = this->usernameColor_;
+        return;
     }
 
     const auto iterator = tags.find("color");
@@ -1919,7 +1979,7 @@ void MessageBuilder::parseUsernameColor(const QVariantMap &tags,
         }
     }
 
-    if (getSettings()->colorizeNicknames && tags.contains("user-id"))
+    if (settings.colorizeNicknames && tags.contains("user-id"))
     {
         this->usernameColor_ = getRandomColor(tags.value("user-id").toString());
         this->message().usernameColor = this->usernameColor_;
@@ -2033,7 +2093,8 @@ void MessageBuilder::parseThread(const QString &messageContent,
                                  const QVariantMap &tags,
                                  const Channel *channel,
                                  const std::shared_ptr<MessageThread> &thread,
-                                 const MessagePtr &parent)
+                                 const MessagePtr &parent,
+                                 const PipelineSettings &settings)
 {
     if (thread)
     {
@@ -2060,8 +2121,8 @@ void MessageBuilder::parseThread(const QString &messageContent,
             threadRoot = parent;
         }
 
-        QString usernameText =
-            stylizeUsername(threadRoot->loginName, *threadRoot);
+        QString usernameText = stylizeUsername(
+            threadRoot->loginName, *threadRoot, settings.usernameDisplayMode);
 
         this->emplace<ReplyCurveElement>();
 
@@ -2218,7 +2279,8 @@ void MessageBuilder::appendUsername(const QVariantMap &tags,
         }
     }
 
-    QString usernameText = stylizeUsername(username, this->message());
+    QString usernameText = stylizeUsername(username, this->message(),
+                                           args.settings->usernameDisplayMode);
 
     if (args.isSentWhisper)
     {
@@ -2263,17 +2325,17 @@ void MessageBuilder::appendUsername(const QVariantMap &tags,
     }
 }
 
-Outcome MessageBuilder::tryAppendEmote(TwitchChannel *twitchChannel,
+Outcome MessageBuilder::tryAppendEmote(const TextState &state,
                                        const EmoteName &name)
 {
-    auto emote = parseEmote(twitchChannel, name);
+    auto emote = parseEmote(state.twitchChannel, name);
 
     if (!emote)
     {
         return Failure;
     }
 
-    if (emote->zeroWidth && getSettings()->enableZeroWidthEmotes &&
+    if (emote->zeroWidth && state.settings.enableZeroWidthEmotes &&
         !this->isEmpty())
     {
         // Attempt to merge current zero-width emote into any previous emotes
@@ -2406,8 +2468,33 @@ void MessageBuilder::addWords(
     }
 }
 
+bool MessageBuilder::appendCopies(const Message &source, size_t begin,
+                                  size_t end)
+{
+    assert(begin <= end && end <= source.elements.size());
+
+    const auto previousSize = this->message().elements.size();
+    for (auto i = begin; i < end; i++)
+    {
+        auto *copy = source.elements[i]->copyInto(*this);
+        if (!copy)
+        {
+            this->message().elements.resize(previousSize);
+            return false;
+        }
+
+        if (auto *link = dynamic_cast<LinkElement *>(copy))
+        {
+            resolveLinkInfo(link);
+        }
+    }
+
+    return true;
+}
+
 void MessageBuilder::appendTwitchBadges(const QVariantMap &tags,
-                                        TwitchChannel *twitchChannel)
+                                        TwitchChannel *twitchChannel,
+                                        const PipelineSettings &settings)
 {
     if (twitchChannel == nullptr)
     {
@@ -2465,7 +2552,7 @@ void MessageBuilder::appendTwitchBadges(const QVariantMap &tags,
     }
 
     auto badgeInfos = parseBadgeInfoTag(tags);
-    appendBadges(this, badges, badgeInfos, twitchChannel);
+    appendBadges(this, badges, badgeInfos, twitchChannel, settings);
 }
 
 void MessageBuilder::appendChatterinoBadges(const QString &userID)
@@ -2554,7 +2641,7 @@ Outcome MessageBuilder::tryAppendCheermote(TextState &state,
 
     int cheerValue = match.captured(1).toInt();
 
-    if (getSettings()->stackBits)
+    if (state.settings.stackBits)
     {
         if (state.bitsStacked)
         {
@@ -6,8 +6,10 @@
 
 #include "common/Aliases.hpp"
 #include "common/Outcome.hpp"
+#include "messages/MessageArena.hpp"
 #include "messages/MessageColor.hpp"
 #include "messages/MessageFlag.hpp"
+#include "messages/PipelineSettings.hpp"
 
 #include <IrcMessage>
 #include <QRegularExpression>
@@ -85,6 +87,10 @@ struct MessageParseArgs {
     bool allowIgnore = true;
     bool isAction = false;
     QString channelPointRewardId = "";
+    /// The settings used while building this message, captured when the
+    /// arguments are created
+    std::shared_ptr<const PipelineSettings> settings =
+        PipelineSettings::current();
 };
 
 struct HighlightAlert {
@@ -151,7 +157,9 @@ public:
         static_assert(std::is_base_of_v<MessageElement, T>,
                       "T must extend MessageElement");
 
-        auto unique = std::make_unique<T>(std::forward<Args>(args)...);
+        // Elements of a message are allocated together (see arena_)
+        auto unique = std::unique_ptr<T>(
+            new (this->arena_) T(std::forward<Args>(args)...));
         auto pointer = unique.get();
         this->append(std::move(unique));
         return pointer;
@@ -259,6 +267,7 @@ public:
 
 private:
     struct TextState {
+        const PipelineSettings &settings;
         TwitchChannel *twitchChannel = nullptr;
         bool hasBits = false;
         bool bitsStacked = false;
@@ -268,14 +277,15 @@ private:
     void addTextOrEmote(TextState &state, QString string);
 
     Outcome tryAppendCheermote(TextState &state, const QString &string);
-    Outcome tryAppendEmote(TwitchChannel *twitchChannel, const EmoteName &name);
+    Outcome tryAppendEmote(const TextState &state, const EmoteName &name);
 
     bool isEmpty() const;
     MessageElement &back();
     std::unique_ptr<MessageElement> releaseBack();
 
     void parse();
-    void parseUsernameColor(const QVariantMap &tags, const QString &userID);
+    void parseUsernameColor(const QVariantMap &tags, const QString &userID,
+                            const PipelineSettings &settings);
     void parseUsername(const Communi::IrcMessage *ircMessage,
                        TwitchChannel *twitchChannel,
                        bool trimSubscriberUsername);
@@ -302,7 +312,8 @@ private:
     void parseThread(const QString &messageContent, const QVariantMap &tags,
                      const Channel *channel,
                      const std::shared_ptr<MessageThread> &thread,
-                     const MessagePtr &parent);
+                     const MessagePtr &parent,
+                     const PipelineSettings &settings);
     // parseHighlights only updates the visual state of the message, but leaves the playing of alerts and sounds to the triggerHighlights function
     HighlightAlert parseHighlights(const QVariantMap &tags,
                                    const QString &originalMessage,
@@ -315,8 +326,15 @@ private:
                   const std::vector<TwitchEmoteOccurrence> &twitchEmotes,
                   TextState &state);
 
+    /// Appends copies of the elements in [begin, end) of @a source
+    ///
+    /// If one of the elements can't be copied, nothing is appended and
+    /// `false` is returned.
+    bool appendCopies(const Message &source, size_t begin, size_t end);
+
     void appendTwitchBadges(const QVariantMap &tags,
-                            TwitchChannel *twitchChannel);
+                            TwitchChannel *twitchChannel,
+                            const PipelineSettings &settings);
     void appendChatterinoBadges(const QString &userID);
     void appendFfzBadges(TwitchChannel *twitchChannel, const QString &userID);
     void appendBttvBadges(const QString &userID);
@@ -326,6 +344,10 @@ private:
                                         const QString &userID,
                                         const Channel *channel);
 
+    /// Elements emplaced into this message are bump-allocated from here.
+    /// Each element keeps its block alive, so the message can outlive the
+    /// builder.
+    MessageArena arena_;
     std::shared_ptr<Message> message_;
     MessageColor textColor_ = MessageColor::Text;
 
@@ -14,6 +14,8 @@
 #include "messages/layouts/MessageLayoutContainer.hpp"
 #include "messages/layouts/MessageLayoutContext.hpp"
 #include "messages/layouts/MessageLayoutElement.hpp"
+#include "messages/MessageArena.hpp"
+#include "messages/MessageBuilder.hpp"
 #include "providers/emoji/Emojis.hpp"
 #include "providers/twitch/TwitchEmotes.hpp"
 #include "singletons/Settings.hpp"
@@ -63,6 +65,27 @@ MessageElement::~MessageElement()
     DebugCount::decrease(DebugObject::MessageElement);
 }
 
+void *MessageElement::operator new(size_t size)
+{
+    return MessageArena::allocateHeap(size);
+}
+
+void *MessageElement::operator new(size_t size, MessageArena &arena)
+{
+    return arena.allocate(size);
+}
+
+void MessageElement::operator delete(void *ptr) noexcept
+{
+    MessageArena::deallocate(ptr);
+}
+
+void MessageElement::operator delete(void *ptr,
+                                     MessageArena & /*arena*/) noexcept
+{
+    MessageArena::deallocate(ptr);
+}
+
 MessageElement *MessageElement::setLink(const Link &link)
 {
     this->link_ = link;
@@ -106,6 +129,19 @@ void MessageElement::addFlags(MessageElementFlags flags)
     this->flags_.set(flags);
 }
 
+MessageElement *MessageElement::copyInto(MessageBuilder & /* builder */) const
+{
+    return nullptr;
+}
+
+void MessageElement::copyStateTo(MessageElement &other) const
+{
+    other.link_ = this->link_;
+    other.tooltip_ = this->tooltip_;
+    other.flags_ = this->flags_;
+    other.trailingSpace = this->trailingSpace;
+}
+
 QJsonObject MessageElement::toJson() const
 {
     return {
@@ -134,7 +170,7 @@ void ImageElement::addToContainer(MessageLayoutContainer &container,
 {
     if (ctx.flags.hasAny(this->getFlags()))
     {
-        container.addElement(new ImageLayoutElement(
+        container.addElement(new (container.arena()) ImageLayoutElement(
             *this, this->image_, this->image_->size() * container.getScale()));
     }
 }
@@ -171,8 +207,10 @@ void CircularImageElement::addToContainer(MessageLayoutContainer &container,
         auto imgSize = QSize(this->image_->width(), this->image_->height()) *
                        container.getScale();
 
-        container.addElement(new ImageWithCircleBackgroundLayoutElement(
-            *this, this->image_, imgSize, this->background_, this->padding_));
+        container.addElement(
+            new (container.arena()) ImageWithCircleBackgroundLayoutElement(
+                *this, this->image_, imgSize, this->background_,
+                this->padding_));
     }
 }
 
@@ -230,7 +268,8 @@ void EmoteElement::addToContainer(MessageLayoutContainer &container,
 
             auto size = image->size() * container.getScale() * emoteScale;
 
-            container.addElement(this->makeImageLayoutElement(image, size));
+            container.addElement(
+                this->makeImageLayoutElement(container.arena(), image, size));
             return;
         }
     }
@@ -245,9 +284,9 @@ void EmoteElement::addToContainer(MessageLayoutContainer &container,
 }
 
 MessageLayoutElement *EmoteElement::makeImageLayoutElement(
-    const ImagePtr &image, QSizeF size)
+    MessageArena &arena, const ImagePtr &image, QSizeF size)
 {
-    return new ImageLayoutElement(*this, image, size);
+    return new (arena) ImageLayoutElement(*this, image, size);
 }
 
 void EmoteElement::ensureText(bool asFallback)
@@ -285,6 +324,14 @@ std::string_view EmoteElement::type() const
     return std::remove_pointer_t<decltype(this)>::TYPE;
 }
 
+MessageElement *EmoteElement::copyInto(MessageBuilder &builder) const
+{
+    auto *copy = builder.emplace<EmoteElement>(this->emote_, this->getFlags(),
+                                               this->textColor_);
+    this->copyStateTo(*copy);
+    return copy;
+}
+
 LayeredEmoteElement::LayeredEmoteElement(
     std::vector<LayeredEmoteElement::Emote> &&emotes, MessageElementFlags flags,
     const MessageColor &textElementColor)
@@ -326,7 +373,7 @@ void LayeredEmoteElement::addToContainer(MessageLayoutContainer &container,
             }
 
             container.addElement(this->makeImageLayoutElement(
-                images, individualSizes, largestSize));
+                container.arena(), images, individualSizes, largestSize));
         }
         else
         {
@@ -358,10 +405,11 @@ std::vector<ImagePtr> LayeredEmoteElement::getLoadedImages(float scale)
 }
 
 MessageLayoutElement *LayeredEmoteElement::makeImageLayoutElement(
-    const std::vector<ImagePtr> &images, const std::vector<QSizeF> &sizes,
-    QSizeF largestSize)
+    MessageArena &arena, const std::vector<ImagePtr> &images,
+    const std::vector<QSizeF> &sizes, QSizeF largestSize)
 {
-    return new LayeredImageLayoutElement(*this, images, sizes, largestSize);
+    return new (arena)
+        LayeredImageLayoutElement(*this, images, sizes, largestSize);
 }
 
 void LayeredEmoteElement::updateTooltips()
@@ -485,6 +533,15 @@ std::string_view LayeredEmoteElement::type() const
     return std::remove_pointer_t<decltype(this)>::TYPE;
 }
 
+MessageElement *LayeredEmoteElement::copyInto(MessageBuilder &builder) const
+{
+    auto emotes = this->emotes_;
+    auto *copy = builder.emplace<LayeredEmoteElement>(
+        std::move(emotes), this->getFlags(), this->textElementColor_);
+    this->copyStateTo(*copy);
+    return copy;
+}
+
 // BADGE
 BadgeElement::BadgeElement(const EmotePtr &emote, MessageElementFlags flags)
     : MessageElement(flags)
@@ -506,7 +563,7 @@ void BadgeElement::addToContainer(MessageLayoutContainer &container,
         }
 
         container.addElement(this->makeImageLayoutElement(
-            image, image->size() * container.getScale()));
+            container.arena(), image, image->size() * container.getScale()));
     }
 }
 
@@ -516,9 +573,9 @@ EmotePtr BadgeElement::getEmote() const
 }
 
 MessageLayoutElement *BadgeElement::makeImageLayoutElement(
-    const ImagePtr &image, QSizeF size)
+    MessageArena &arena, const ImagePtr &image, QSizeF size)
 {
-    auto *element = new ImageLayoutElement(*this, image, size);
+    auto *element = new (arena) ImageLayoutElement(*this, image, size);
 
     return element;
 }
@@ -545,11 +602,11 @@ ModBadgeElement::ModBadgeElement(const EmotePtr &data,
 }
 
 MessageLayoutElement *ModBadgeElement::makeImageLayoutElement(
-    const ImagePtr &image, QSizeF size)
+    MessageArena &arena, const ImagePtr &image, QSizeF size)
 {
     static const QColor modBadgeBackgroundColor("#34AE0A");
 
-    auto *element = new ImageWithBackgroundLayoutElement(
+    auto *element = new (arena) ImageWithBackgroundLayoutElement(
         *this, image, size, modBadgeBackgroundColor);
 
     return element;
@@ -576,9 +633,9 @@ VipBadgeElement::VipBadgeElement(const EmotePtr &data,
 }
 
 MessageLayoutElement *VipBadgeElement::makeImageLayoutElement(
-    const ImagePtr &image, QSizeF size)
+    MessageArena &arena, const ImagePtr &image, QSizeF size)
 {
-    auto *element = new ImageLayoutElement(*this, image, size);
+    auto *element = new (arena) ImageLayoutElement(*this, image, size);
 
     return element;
 }
@@ -605,10 +662,10 @@ FfzBadgeElement::FfzBadgeElement(const EmotePtr &data,
 }
 
 MessageLayoutElement *FfzBadgeElement::makeImageLayoutElement(
-    const ImagePtr &image, QSizeF size)
+    MessageArena &arena, const ImagePtr &image, QSizeF size)
 {
-    auto *element =
-        new ImageWithBackgroundLayoutElement(*this, image, size, this->color);
+    auto *element = new (arena)
+        ImageWithBackgroundLayoutElement(*this, image, size, this->color);
 
     return element;
 }
@@ -657,7 +714,7 @@ void TextElement::addToContainer(MessageLayoutContainer &container,
                 auto color = this->color_.getColor(ctx.messageColors);
                 app->getThemes()->normalizeColor(color);
 
-                auto *e = new TextLayoutElement(
+                auto *e = new (container.arena()) TextLayoutElement(
                     *this, text, QSizeF(width, metrics.height()), color,
                     this->style_, container.getScale());
                 e->setTrailingSpace(hasTrailingSpace);
@@ -876,6 +933,14 @@ std::string_view TextElement::type() const
     return std::remove_pointer_t<decltype(this)>::TYPE;
 }
 
+MessageElement *TextElement::copyInto(MessageBuilder &builder) const
+{
+    auto *copy = builder.emplace<TextElement>(
+        this->words_.join(' '), this->getFlags(), this->color_, this->style_);
+    this->copyStateTo(*copy);
+    return copy;
+}
+
 SingleLineTextElement::SingleLineTextElement(const QString &text,
                                              MessageElementFlags flags,
                                              const MessageColor &color,
@@ -902,7 +967,7 @@ void SingleLineTextElement::addToContainer(MessageLayoutContainer &container,
             auto color = this->color_.getColor(ctx.messageColors);
             app->getThemes()->normalizeColor(color);
 
-            auto *e = new TextLayoutElement(
+            auto *e = new (container.arena()) TextLayoutElement(
                 *this, text, QSizeF(width, metrics.height()), color,
                 this->style_, container.getScale());
             e->setTrailingSpace(hasTrailingSpace);
@@ -975,7 +1040,8 @@ void SingleLineTextElement::addToContainer(MessageLayoutContainer &container,
                         currentText.clear();
 
                         container.addElementNoLineBreak(
-                            (new ImageLayoutElement(*this, image, emoteSize))
+                            (new (container.arena())
+                                 ImageLayoutElement(*this, image, emoteSize))
                                 ->setLink(this->getLink())
                                 ->setTrailingSpace(false));
                     }
@@ -1057,6 +1123,21 @@ std::string_view LinkElement::type() const
     return std::remove_pointer_t<decltype(this)>::TYPE;
 }
 
+MessageElement *LinkElement::copyInto(MessageBuilder &builder) const
+{
+    // The copy gets its own link info. The link resolver caches results, so
+    // resolving it doesn't cause another request.
+    auto *copy = builder.emplace<LinkElement>(
+        Parsed{
+            .lowercase = this->lowercase_.join(' '),
+            .original = this->original_.join(' '),
+        },
+        this->linkInfo_.originalUrl(), this->getFlags(), this->color_,
+        this->style_);
+    this->copyStateTo(*copy);
+    return copy;
+}
+
 MentionElement::MentionElement(const QString &displayName, QString loginName_,
                                MessageColor fallbackColor_,
                                MessageColor userColor_)
@@ -1144,6 +1225,15 @@ std::string_view MentionElement::type() const
     return std::remove_pointer_t<decltype(this)>::TYPE;
 }
 
+MessageElement *MentionElement::copyInto(MessageBuilder &builder) const
+{
+    auto *copy = builder.emplace<MentionElement>(
+        this->words_.join(' '), this->userLoginName_, this->fallbackColor_,
+        this->userColor_);
+    this->copyStateTo(*copy);
+    return copy;
+}
+
 // TIMESTAMP
 TimestampElement::TimestampElement()
     : TimestampElement(getApp()->isTest() ? QTime::fromMSecsSinceStartOfDay(0)
@@ -1233,15 +1323,16 @@ void TwitchModerationElement::addToContainer(MessageLayoutContainer &container,
             if (const auto &image = action.getImage())
             {
                 container.addElement(
-                    (new ImageLayoutElement(*this, *image, size))
+                    (new (container.arena())
+                         ImageLayoutElement(*this, *image, size))
                         ->setLink(Link(Link::UserAction, action.getAction())));
             }
             else
             {
                 container.addElement(
-                    (new TextIconLayoutElement(*this, action.getLine1(),
-                                               action.getLine2(),
-                                               container.getScale(), size))
+                    (new (container.arena()) TextIconLayoutElement(
+                         *this, action.getLine1(), action.getLine2(),
+                         container.getScale(), size))
                         ->setLink(Link(Link::UserAction, action.getAction())));
             }
         }
@@ -1307,7 +1398,7 @@ void ScalingImageElement::addToContainer(MessageLayoutContainer &container,
             return;
         }
 
-        container.addElement(new ImageLayoutElement(
+        container.addElement(new (container.arena()) ImageLayoutElement(
             *this, image, image->size() * container.getScale()));
     }
 }
@@ -1342,9 +1433,9 @@ void ReplyCurveElement::addToContainer(MessageLayoutContainer &container,
     if (ctx.flags.hasAny(this->getFlags()))
     {
         float scale = container.getScale();
-        container.addElement(
-            new ReplyCurveLayoutElement(*this, width * scale, thickness * scale,
-                                        radius * scale, margin * scale));
+        container.addElement(new (container.arena()) ReplyCurveLayoutElement(
+            *this, width * scale, thickness * scale, radius * scale,
+            margin * scale));
     }
 }
 
@@ -26,6 +26,8 @@ class QJsonObject;
 
 namespace chatterino {
 class Channel;
+class MessageArena;
+class MessageBuilder;
 struct MessageLayoutContainer;
 class MessageLayoutElement;
 struct MessageLayoutContext;
@@ -174,6 +176,14 @@ public:
     MessageElement(MessageElement &&) = delete;
     MessageElement &operator=(MessageElement &&) = delete;
 
+    // Elements are either allocated on the heap or in the arena of the
+    // message they're built for (see MessageBuilder::emplace). Both can be
+    // freed through a regular delete.
+    static void *operator new(size_t size);
+    static void *operator new(size_t size, MessageArena &arena);
+    static void operator delete(void *ptr) noexcept;
+    static void operator delete(void *ptr, MessageArena &arena) noexcept;
+
     virtual MessageElement *setLink(const Link &link);
     MessageElement *setTooltip(const QString &tooltip);
 
@@ -196,8 +206,18 @@ public:
     /// member.
     virtual std::string_view type() const = 0;
 
+    /// @brief Appends a copy of this element to @a builder
+    ///
+    /// Only the elements that make up the text of a message can be copied
+    /// (see SharedChatMessageCache). All other elements return nullptr.
+    virtual MessageElement *copyInto(MessageBuilder &builder) const;
+
 protected:
     MessageElement(MessageElementFlags flags);
+
+    /// Copies the link, tooltip, flags and trailing space to @a other
+    void copyStateTo(MessageElement &other) const;
+
     bool trailingSpace = true;
 
 private:
@@ -270,6 +290,7 @@ public:
 
     QJsonObject toJson() const override;
     std::string_view type() const override;
+    MessageElement *copyInto(MessageBuilder &builder) const override;
 
     const MessageColor &color() const noexcept;
     FontStyle fontStyle() const noexcept;
@@ -369,6 +390,7 @@ public:
 
     QJsonObject toJson() const override;
     std::string_view type() const override;
+    MessageElement *copyInto(MessageBuilder &builder) const override;
 
 private:
     LinkInfo linkInfo_;
@@ -428,6 +450,7 @@ public:
 
     QJsonObject toJson() const override;
     std::string_view type() const override;
+    MessageElement *copyInto(MessageBuilder &builder) const override;
 
 private:
     /**
@@ -460,9 +483,11 @@ public:
 
     QJsonObject toJson() const override;
     std::string_view type() const override;
+    MessageElement *copyInto(MessageBuilder &builder) const override;
 
 protected:
-    virtual MessageLayoutElement *makeImageLayoutElement(const ImagePtr &image,
+    virtual MessageLayoutElement *makeImageLayoutElement(MessageArena &arena,
+                                                         const ImagePtr &image,
                                                          QSizeF size);
 
 private:
@@ -505,11 +530,12 @@ public:
 
     QJsonObject toJson() const override;
     std::string_view type() const override;
+    MessageElement *copyInto(MessageBuilder &builder) const override;
 
 private:
     MessageLayoutElement *makeImageLayoutElement(
-        const std::vector<ImagePtr> &image, const std::vector<QSizeF> &sizes,
-        QSizeF largestSize);
+        MessageArena &arena, const std::vector<ImagePtr> &image,
+        const std::vector<QSizeF> &sizes, QSizeF largestSize);
 
     QString getCopyString() const;
     void updateTooltips();
@@ -538,7 +564,8 @@ public:
     std::string_view type() const override;
 
 protected:
-    virtual MessageLayoutElement *makeImageLayoutElement(const ImagePtr &image,
+    virtual MessageLayoutElement *makeImageLayoutElement(MessageArena &arena,
+                                                         const ImagePtr &image,
                                                          QSizeF size);
 
 private:
@@ -556,7 +583,8 @@ public:
     std::string_view type() const override;
 
 protected:
-    MessageLayoutElement *makeImageLayoutElement(const ImagePtr &image,
+    MessageLayoutElement *makeImageLayoutElement(MessageArena &arena,
+                                                 const ImagePtr &image,
                                                  QSizeF size) override;
 };
 
@@ -571,7 +599,8 @@ public:
     std::string_view type() const override;
 
 protected:
-    MessageLayoutElement *makeImageLayoutElement(const ImagePtr &image,
+    MessageLayoutElement *makeImageLayoutElement(MessageArena &arena,
+                                                 const ImagePtr &image,
                                                  QSizeF size) override;
 };
 
@@ -587,7 +616,8 @@ public:
     std::string_view type() const override;
 
 protected:
-    MessageLayoutElement *makeImageLayoutElement(const ImagePtr &image,
+    MessageLayoutElement *makeImageLayoutElement(MessageArena &arena,
+                                                 const ImagePtr &image,
                                                  QSizeF size) override;
     const QColor color;
 };
@@ -6,8 +6,9 @@
 
 #include "Application.hpp"
 #include "controllers/accounts/AccountController.hpp"
+#include "messages/LimitedQueue.hpp"
+#include "messages/PipelineSettings.hpp"
 #include "providers/twitch/TwitchAccount.hpp"
-#include "singletons/Settings.hpp"
 
 #include <algorithm>
 #include <vector>
@@ -60,20 +61,21 @@ float relativeSimilarity(QStringView str1, QStringView str2)
 }
 
 template <std::ranges::bidirectional_range T>
-float inMessages(const MessagePtr &msg, const T &messages)
+float inMessages(const MessagePtr &msg, const T &messages,
+                 const PipelineSettings &settings)
 {
     float similarityPercent = 0.0F;
+    auto now = QTime::currentTime();
 
     for (const auto &prevMsg :
          messages | std::views::reverse |
-             std::views::take(getSettings()->hideSimilarMaxMessagesToCheck))
+             std::views::take(settings.hideSimilarMaxMessagesToCheck))
     {
-        if (prevMsg->parseTime.secsTo(QTime::currentTime()) >=
-            getSettings()->hideSimilarMaxDelay)
+        if (prevMsg->parseTime.secsTo(now) >= settings.hideSimilarMaxDelay)
         {
             break;
         }
-        if (getSettings()->hideSimilarBySameUser &&
+        if (settings.hideSimilarBySameUser &&
             msg->loginName != prevMsg->loginName)
         {
             continue;
@@ -93,22 +95,24 @@ namespace chatterino {
 template <std::ranges::bidirectional_range T>
 void setSimilarityFlags(const MessagePtr &message, const T &messages)
 {
-    if (getSettings()->similarityEnabled)
+    auto settings = PipelineSettings::current();
+    if (settings->similarityEnabled)
     {
         bool isMyself =
             message->loginName ==
             getApp()->getAccounts()->twitch.getCurrent()->getUserName();
-        bool hideMyself = getSettings()->hideSimilarMyself;
+        bool hideMyself = settings->hideSimilarMyself;
 
         if (isMyself && !hideMyself)
         {
             return;
         }
 
-        if (inMessages(message, messages) > getSettings()->similarityPercentage)
+        if (inMessages(message, messages, *settings) >
+            settings->similarityPercentage)
         {
             message->flags.set(MessageFlag::Similar);
-            if (getSettings()->colorSimilarDisabled)
+            if (settings->colorSimilarDisabled)
             {
                 message->flags.set(MessageFlag::Disabled);
             }
@@ -118,5 +122,7 @@ void setSimilarityFlags(const MessagePtr &message, const T &messages)
 
 template void setSimilarityFlags<std::vector<MessagePtr>>(
     const MessagePtr &msg, const std::vector<MessagePtr> &messages);
+template void setSimilarityFlags<LimitedQueue<MessagePtr>::View>(
+    const MessagePtr &msg, const LimitedQueue<MessagePtr>::View &messages);
 
 }  // namespace chatterino
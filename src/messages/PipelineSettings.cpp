@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/PipelineSettings.hpp"
+
+#include "singletons/Settings.hpp"
+
+namespace chatterino {
+
+PipelineSettings PipelineSettings::fromSettings(Settings &settings)
+{
+    return {
+        .usernameDisplayMode = settings.usernameDisplayMode.getEnum(),
+        .colorizeNicknames = settings.colorizeNicknames,
+        .useCustomFfzModeratorBadges = settings.useCustomFfzModeratorBadges,
+        .useCustomFfzVipBadges = settings.useCustomFfzVipBadges,
+        .findAllUsernames = settings.findAllUsernames,
+        .enableZeroWidthEmotes = settings.enableZeroWidthEmotes,
+        .stackBits = settings.stackBits,
+        .highlightInlineWhispers = settings.highlightInlineWhispers,
+
+        .stripReplyMention = settings.stripReplyMention,
+        .hideReplyContext = settings.hideReplyContext,
+        .autoSubToParticipatedThreads = settings.autoSubToParticipatedThreads,
+
+        .similarityEnabled = settings.similarityEnabled,
+        .colorSimilarDisabled = settings.colorSimilarDisabled,
+        .hideSimilar = settings.hideSimilar,
+        .hideSimilarBySameUser = settings.hideSimilarBySameUser,
+        .hideSimilarMyself = settings.hideSimilarMyself,
+        .shownSimilarTriggerHighlights =
+            settings.shownSimilarTriggerHighlights,
+        .similarityPercentage = settings.similarityPercentage,
+        .hideSimilarMaxDelay = settings.hideSimilarMaxDelay,
+        .hideSimilarMaxMessagesToCheck =
+            settings.hideSimilarMaxMessagesToCheck,
+
+        .logTimestampFormat = settings.logTimestampFormat,
+        .tryUseTwitchTimestamps = settings.tryUseTwitchTimestamps,
+        .separatelyStoreStreamLogs = settings.separatelyStoreStreamLogs,
+    };
+}
+
+std::shared_ptr<const PipelineSettings> PipelineSettings::current()
+{
+    return getSettings()->pipelineSettings();
+}
+
+}  // namespace chatterino
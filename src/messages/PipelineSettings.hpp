@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QString>
+
+#include <memory>
+
+namespace chatterino {
+
+class Settings;
+enum UsernameDisplayMode : int;
+
+/// An immutable snapshot of the settings the message pipeline reads while
+/// building, filtering and logging messages
+///
+/// Some of these settings are read once per word or element. Rather than
+/// going through the settings every time, the pipeline captures a snapshot
+/// once per message (see `MessageParseArgs::settings`). `Settings` publishes
+/// a new snapshot whenever one of the settings below changes.
+struct PipelineSettings {
+    /// Reads the current values from `settings`
+    static PipelineSettings fromSettings(Settings &settings);
+
+    /// Returns the most recently published snapshot
+    ///
+    /// This can be called from any thread.
+    static std::shared_ptr<const PipelineSettings> current();
+
+    // Message building
+    UsernameDisplayMode usernameDisplayMode{};
+    bool colorizeNicknames = false;
+    bool useCustomFfzModeratorBadges = false;
+    bool useCustomFfzVipBadges = false;
+    bool findAllUsernames = false;
+    bool enableZeroWidthEmotes = false;
+    bool stackBits = false;
+    bool highlightInlineWhispers = false;
+
+    // Replies
+    bool stripReplyMention = false;
+    bool hideReplyContext = false;
+    bool autoSubToParticipatedThreads = false;
+
+    // Similarity
+    bool similarityEnabled = false;
+    bool colorSimilarDisabled = false;
+    bool hideSimilar = false;
+    bool hideSimilarBySameUser = false;
+    bool hideSimilarMyself = false;
+    bool shownSimilarTriggerHighlights = false;
+    float similarityPercentage = 0;
+    int hideSimilarMaxDelay = 0;
+    int hideSimilarMaxMessagesToCheck = 0;
+
+    // Logging
+    QString logTimestampFormat;
+    bool tryUseTwitchTimestamps = false;
+    bool separatelyStoreStreamLogs = false;
+};
+
+}  // namespace chatterino
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/SharedChatMessageCache.hpp"
+
+#include "messages/Message.hpp"
+#include "messages/PipelineSettings.hpp"
+
+namespace chatterino {
+
+namespace {
+
+QString makeKey(const QString &messageID, const QString &sourceRoomID)
+{
+    return messageID + ':' + sourceRoomID;
+}
+
+}  // namespace
+
+SharedChatMessageCache::SharedChatMessageCache()
+    : entries_(CAPACITY)
+{
+}
+
+SharedChatMessageCache &SharedChatMessageCache::instance()
+{
+    static SharedChatMessageCache cache;
+    return cache;
+}
+
+std::optional<SharedChatMessageCache::Entry> SharedChatMessageCache::find(
+    const QString &messageID, const QString &sourceRoomID)
+{
+    auto key = makeKey(messageID, sourceRoomID);
+
+    std::lock_guard lock(this->mutex_);
+    if (!this->entries_.exists(key))
+    {
+        return std::nullopt;
+    }
+
+    const auto &timed = this->entries_.get(key);
+    if (timed.expiresAt < std::chrono::steady_clock::now())
+    {
+        return std::nullopt;
+    }
+    return timed.entry;
+}
+
+void SharedChatMessageCache::insert(const QString &messageID,
+                                    const QString &sourceRoomID, Entry entry)
+{
+    auto key = makeKey(messageID, sourceRoomID);
+
+    std::lock_guard lock(this->mutex_);
+    this->entries_.put(key, {
+                                .entry = std::move(entry),
+                                .expiresAt =
+                                    std::chrono::steady_clock::now() + TTL,
+                            });
+}
+
+size_t SharedChatMessageCache::size() const
+{
+    std::lock_guard lock(this->mutex_);
+    return this->entries_.size();
+}
+
+}  // namespace chatterino
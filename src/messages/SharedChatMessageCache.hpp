@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "util/QStringHash.hpp"
+
+#include <lrucache/lrucache.hpp>
+#include <QString>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace chatterino {
+
+struct Message;
+struct PipelineSettings;
+
+/// Remembers the text of recently built shared chat messages
+///
+/// In a shared chat session, a message arrives in every channel of the
+/// session that we joined. If the source channel is joined, every copy is
+/// built against it, so the elements of the text only have to be built once.
+/// The other copies clone them and only build the parts that depend on the
+/// channel they're shown in (see MessageBuilder::makeIrcMessage).
+///
+/// Entries only hold weak references to the messages and expire after #TTL.
+/// This can be used from any thread.
+class SharedChatMessageCache
+{
+public:
+    struct Entry {
+        std::weak_ptr<const Message> message;
+        /// The elements in [begin, end) make up the text of the message
+        size_t begin = 0;
+        size_t end = 0;
+        /// The text after ignored phrases were replaced
+        QString content;
+        /// The settings the message was built with
+        std::shared_ptr<const PipelineSettings> settings;
+    };
+
+    static constexpr std::chrono::seconds TTL{10};
+    static constexpr size_t CAPACITY = 256;
+
+    SharedChatMessageCache();
+
+    static SharedChatMessageCache &instance();
+
+    /// Returns the entry for the message with `messageID` from `sourceRoomID`
+    /// if it hasn't expired yet
+    std::optional<Entry> find(const QString &messageID,
+                              const QString &sourceRoomID);
+
+    void insert(const QString &messageID, const QString &sourceRoomID,
+                Entry entry);
+
+    size_t size() const;
+
+private:
+    struct TimedEntry {
+        Entry entry;
+        std::chrono::steady_clock::time_point expiresAt;
+    };
+
+    mutable std::mutex mutex_;
+    /// "<message-id>:<source-room-id>" -> entry
+    cache::lru_cache<QString, TimedEntry> entries_;
+};
+
+}  // namespace chatterino
@@ -5,6 +5,7 @@
 #include "messages/layouts/MessageLayout.hpp"
 
 #include "Application.hpp"
+#include "messages/layouts/MessageLayoutCache.hpp"
 #include "messages/layouts/MessageLayoutContainer.hpp"
 #include "messages/layouts/MessageLayoutContext.hpp"
 #include "messages/layouts/MessageLayoutElement.hpp"
@@ -36,10 +37,28 @@ QColor blendColors(const QColor &base, const QColor &apply)
                    base.blueF() * (1 - alpha) + apply.blueF() * alpha);
     return result;
 }
+
+/// Used until a message is laid out for the first time
+const std::shared_ptr<const MessageLayoutContainer> &emptyContainer()
+{
+    static const auto empty = std::make_shared<const MessageLayoutContainer>();
+    return empty;
+}
+
+/// Reasons for MessageLayout::actuallyLayout to skip all elements
+enum HiddenBy : uint8_t {
+    HiddenByModeration = 1 << 0,
+    HiddenByAutomodBlockedTerm = 1 << 1,
+    HiddenByRestrictedUsers = 1 << 2,
+    HiddenByModerationActions = 1 << 3,
+    HiddenBySimilar = 1 << 4,
+};
+
 }  // namespace
 
 MessageLayout::MessageLayout(MessagePtr message)
     : message_(std::move(message))
+    , container_(emptyContainer())
 {
     DebugCount::increase(DebugObject::MessageLayout);
 }
@@ -62,12 +81,12 @@ const MessagePtr &MessageLayout::getMessagePtr() const
 // Height
 int MessageLayout::getHeight() const
 {
-    return static_cast<int>(this->container_.getHeight());
+    return static_cast<int>(this->container_->getHeight());
 }
 
 int MessageLayout::getWidth() const
 {
-    return static_cast<int>(this->container_.getWidth());
+    return static_cast<int>(this->container_->getWidth());
 }
 
 // Layout
@@ -117,9 +136,9 @@ bool MessageLayout::layout(const MessageLayoutContext &ctx,
         return false;
     }
 
-    qreal oldHeight = this->container_.getHeight();
+    qreal oldHeight = this->container_->getHeight();
     this->actuallyLayout(ctx);
-    if (widthChanged || this->container_.getHeight() != oldHeight)
+    if (widthChanged || this->container_->getHeight() != oldHeight)
     {
         this->deleteBuffer();
     }
@@ -143,80 +162,102 @@ void MessageLayout::actuallyLayout(const MessageLayoutContext &ctx)
         messageFlags.unset(MessageFlag::Collapsed);
     }
 
-    bool hideModerated = getSettings()->hideModerated;
-    bool hideModerationActions = getSettings()->hideModerationActions;
-    bool hideBlockedTermAutomodMessages =
-        getSettings()->showBlockedTermAutomodMessages.getEnum() ==
-        ShowModerationState::Never;
-    bool hideSimilar = getSettings()->hideSimilar;
     bool hideReplies = !ctx.flags.has(MessageElementFlag::RepliedMessage);
 
-    this->container_.beginLayout(ctx.width, this->scale_, this->imageScale_,
-                                 messageFlags);
-
-    for (const auto &element : this->message_->elements)
+    uint8_t hidden = 0;
+    if (getSettings()->hideModerated &&
+        this->message_->flags.has(MessageFlag::Disabled))
     {
-        if (hideModerated && this->message_->flags.has(MessageFlag::Disabled))
-        {
-            continue;
-        }
+        hidden |= HiddenByModeration;
+    }
+    if (getSettings()->showBlockedTermAutomodMessages.getEnum() ==
+            ShowModerationState::Never &&
+        this->message_->flags.has(MessageFlag::AutoModBlockedTerm))
+    {
+        // NOTE: This hides the message but it will make the message re-appear if moderation message hiding is no longer active, and the layout is re-laid-out.
+        // This is only the case for the moderation messages that don't get filtered during creation.
+        // We should decide which is the correct method & apply that everywhere
+        hidden |= HiddenByAutomodBlockedTerm;
+    }
+    if (this->message_->flags.has(MessageFlag::RestrictedMessage) &&
+        getApp()->getStreamerMode()->shouldHideRestrictedUsers())
+    {
+        // Message is being hidden because the source is a
+        // restricted user
+        hidden |= HiddenByRestrictedUsers;
+    }
+    if (this->message_->flags.has(MessageFlag::ModerationAction) &&
+        (getSettings()->hideModerationActions ||
+         getApp()->getStreamerMode()->shouldHideModActions()))
+    {
+        // Message is being hidden because we consider the message
+        // a moderation action (something a streamer is unlikely to
+        // want to share if they briefly show their chat on stream)
+        hidden |= HiddenByModerationActions;
+    }
+    if (getSettings()->hideSimilar &&
+        this->message_->flags.has(MessageFlag::Similar))
+    {
+        hidden |= HiddenBySimilar;
+    }
 
-        if (hideBlockedTermAutomodMessages &&
-            this->message_->flags.has(MessageFlag::AutoModBlockedTerm))
-        {
-            // NOTE: This hides the message but it will make the message re-appear if moderation message hiding is no longer active, and the layout is re-laid-out.
-            // This is only the case for the moderation messages that don't get filtered during creation.
-            // We should decide which is the correct method & apply that everywhere
-            continue;
-        }
+    MessageLayoutCache::Key key{
+        .message = this->message_.get(),
+        .messageFlags = static_cast<int64_t>(messageFlags.value()),
+        .elementFlags = static_cast<int64_t>(ctx.flags.value()),
+        .width = ctx.width,
+        .scale = this->scale_,
+        .imageScale = this->imageScale_,
+        .generation = this->layoutState_,
+        .hidden = hidden,
+        .expanded = this->flags.has(MessageLayoutFlag::Expanded),
+        .regularText = ctx.messageColors.regularText.rgba(),
+        .systemText = ctx.messageColors.systemText.rgba(),
+        .linkText = ctx.messageColors.linkText.rgba(),
+    };
+
+    auto &cache = MessageLayoutCache::instance();
+    auto container = cache.find(key);
+    if (!container)
+    {
+        // Views sharing the current container keep it, so we always lay out
+        // into a new one
+        auto fresh = std::make_shared<MessageLayoutContainer>();
+        fresh->beginLayout(ctx.width, this->scale_, this->imageScale_,
+                           messageFlags);
 
-        if (this->message_->flags.has(MessageFlag::RestrictedMessage))
+        for (const auto &element : this->message_->elements)
         {
-            if (getApp()->getStreamerMode()->shouldHideRestrictedUsers())
+            if (hidden != 0)
             {
-                // Message is being hidden because the source is a
-                // restricted user
-                continue;
+                // The message is laid out without any elements
+                break;
             }
-        }
 
-        if (this->message_->flags.has(MessageFlag::ModerationAction))
-        {
-            if (hideModerationActions ||
-                getApp()->getStreamerMode()->shouldHideModActions())
+            if (hideReplies &&
+                element->getFlags().has(MessageElementFlag::RepliedMessage))
             {
-                // Message is being hidden because we consider the message
-                // a moderation action (something a streamer is unlikely to
-                // want to share if they briefly show their chat on stream)
                 continue;
             }
-        }
 
-        if (hideSimilar && this->message_->flags.has(MessageFlag::Similar))
-        {
-            continue;
+            element->addToContainer(*fresh, ctx);
         }
 
-        if (hideReplies &&
-            element->getFlags().has(MessageElementFlag::RepliedMessage))
-        {
-            continue;
-        }
-
-        element->addToContainer(this->container_, ctx);
+        fresh->endLayout();
+        container = std::move(fresh);
+        cache.insert(key, container);
     }
 
-    if (this->height_ != this->container_.getHeight())
+    this->container_ = std::move(container);
+    if (this->height_ != this->container_->getHeight())
     {
         this->deleteBuffer();
     }
-
-    this->container_.endLayout();
-    this->height_ = this->container_.getHeight();
+    this->height_ = this->container_->getHeight();
 
     // collapsed state
     this->flags.unset(MessageLayoutFlag::Collapsed);
-    if (this->container_.isCollapsed())
+    if (this->container_->isCollapsed())
     {
         this->flags.set(MessageLayoutFlag::Collapsed);
     }
@@ -244,7 +285,7 @@ MessagePaintResult MessageLayout::paint(const MessagePaintContext &ctx)
 
     // draw gif emotes
     result.hasAnimatedElements =
-        this->container_.paintAnimatedElements(ctx.painter, ctx.y);
+        this->container_->paintAnimatedElements(ctx.painter, ctx.y);
 
     // draw disabled
     if (this->message_->flags.has(MessageFlag::Disabled))
@@ -290,7 +331,7 @@ MessagePaintResult MessageLayout::paint(const MessagePaintContext &ctx)
     // draw selection
     if (!ctx.selection.isEmpty())
     {
-        this->container_.paintSelection(ctx.painter, ctx.messageIndex,
+        this->container_->paintSelection(ctx.painter, ctx.messageIndex,
                                         ctx.selection, ctx.y);
     }
 
@@ -301,7 +342,7 @@ MessagePaintResult MessageLayout::paint(const MessagePaintContext &ctx)
             QRectF{
                 0.0,
                 static_cast<qreal>(ctx.y),
-                this->container_.getWidth() + 64,
+                this->container_->getWidth() + 64,
                 1.0,
             },
             ctx.messageColors.messageSeperator);
@@ -327,7 +368,7 @@ MessagePaintResult MessageLayout::paint(const MessagePaintContext &ctx)
         ctx.painter.fillRect(
             QRectF{
                 0,
-                ctx.y + this->container_.getHeight() - 1,
+                ctx.y + this->container_->getHeight() - 1,
                 static_cast<qreal>(pixmap->width()),
                 1,
             },
@@ -349,7 +390,7 @@ QPixmap *MessageLayout::ensureBuffer(QPainter &painter, qreal width, bool clear)
     // Create new buffer
     this->buffer_ = std::make_unique<QPixmap>(
         static_cast<int>(width * painter.device()->devicePixelRatioF()),
-        static_cast<int>(this->container_.getHeight() *
+        static_cast<int>(this->container_->getHeight() *
                          painter.device()->devicePixelRatioF()));
     this->buffer_->setDevicePixelRatio(painter.device()->devicePixelRatioF());
 
@@ -460,7 +501,7 @@ void MessageLayout::updateBuffer(QPixmap *buffer,
     painter.fillRect(buffer->rect(), backgroundColor);
 
     // draw message
-    this->container_.paintElements(painter, ctx);
+    this->container_->paintElements(painter, ctx);
 
 #ifdef FOURTF
     // debug
@@ -471,7 +512,7 @@ void MessageLayout::updateBuffer(QPixmap *buffer,
     QTextOption option;
     option.setAlignment(Qt::AlignRight | Qt::AlignTop);
 
-    painter.drawText(QRectF(1, 1, this->container_.getWidth() - 3, 1000),
+    painter.drawText(QRectF(1, 1, this->container_->getWidth() - 3, 1000),
                      QString::number(this->layoutCount_) + ", " +
                          QString::number(++this->bufferUpdatedCount_),
                      option);
@@ -498,7 +539,7 @@ void MessageLayout::deleteCache()
     this->deleteBuffer();
 
 #ifdef XD
-    this->container_.clear();
+    this->container_ = emptyContainer();
 #endif
 }
 
@@ -511,7 +552,7 @@ void MessageLayout::deleteCache()
 const MessageLayoutElement *MessageLayout::getElementAt(QPointF point) const
 {
     // go through all words and return the first one that contains the point.
-    return this->container_.getElementAt(point);
+    return this->container_->getElementAt(point);
 }
 
 std::pair<int, int> MessageLayout::getWordBounds(
@@ -521,7 +562,7 @@ std::pair<int, int> MessageLayout::getWordBounds(
     // elements in the container
     if (hoveredElement->getWordId() != -1)
     {
-        return this->container_.getWordBounds(hoveredElement);
+        return this->container_->getWordBounds(hoveredElement);
     }
 
     const auto wordStart = this->getSelectionIndex(relativePos) -
@@ -535,23 +576,23 @@ std::pair<int, int> MessageLayout::getWordBounds(
 
 size_t MessageLayout::getLastCharacterIndex() const
 {
-    return this->container_.getLastCharacterIndex();
+    return this->container_->getLastCharacterIndex();
 }
 
 size_t MessageLayout::getFirstMessageCharacterIndex() const
 {
-    return this->container_.getFirstMessageCharacterIndex();
+    return this->container_->getFirstMessageCharacterIndex();
 }
 
 size_t MessageLayout::getSelectionIndex(QPointF position) const
 {
-    return this->container_.getSelectionIndex(position);
+    return this->container_->getSelectionIndex(position);
 }
 
 void MessageLayout::addSelectionText(QString &str, uint32_t from, uint32_t to,
                                      CopyMode copymode)
 {
-    this->container_.addSelectionText(str, from, to, copymode);
+    this->container_->addSelectionText(str, from, to, copymode);
 }
 
 }  // namespace chatterino
@@ -125,7 +125,9 @@ private:
 
     // variables
     const MessagePtr message_;
-    MessageLayoutContainer container_;
+    /// Shared with other views showing this message with the same layout
+    /// (see MessageLayoutCache). Never changed after it was laid out.
+    std::shared_ptr<const MessageLayoutContainer> container_;
     std::unique_ptr<QPixmap> buffer_;
     bool bufferValid_ = false;
 
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/layouts/MessageLayoutCache.hpp"
+
+#include "debug/AssertInGuiThread.hpp"
+#include "messages/layouts/MessageLayoutContainer.hpp"
+
+#include <QHash>
+
+#include <algorithm>
+
+namespace chatterino {
+
+size_t MessageLayoutCache::KeyHash::operator()(const Key &key) const
+{
+    return qHashMulti(0, key.message, key.messageFlags, key.elementFlags,
+                      key.width, key.scale, key.imageScale, key.generation,
+                      key.hidden, key.expanded, key.regularText,
+                      key.systemText, key.linkText);
+}
+
+MessageLayoutCache &MessageLayoutCache::instance()
+{
+    static MessageLayoutCache cache;
+    return cache;
+}
+
+std::shared_ptr<const MessageLayoutContainer> MessageLayoutCache::find(
+    const Key &key) const
+{
+    assertInGuiThread();
+
+    auto it = this->entries_.find(key);
+    if (it == this->entries_.end())
+    {
+        return nullptr;
+    }
+    return it->second.lock();
+}
+
+void MessageLayoutCache::insert(
+    const Key &key,
+    const std::shared_ptr<const MessageLayoutContainer> &container)
+{
+    assertInGuiThread();
+
+    if (this->entries_.size() >= this->pruneAt_)
+    {
+        this->prune();
+    }
+    this->entries_.insert_or_assign(key, container);
+}
+
+size_t MessageLayoutCache::size() const
+{
+    return this->entries_.size();
+}
+
+void MessageLayoutCache::prune()
+{
+    std::erase_if(this->entries_, [](const auto &entry) {
+        return entry.second.expired();
+    });
+
+    // Layouts that are still alive stay in the cache, so only prune again
+    // once it grew significantly. Otherwise, we'd prune on every insert if
+    // there are many messages in views.
+    this->pruneAt_ = std::max<size_t>(1024, this->entries_.size() * 2);
+}
+
+}  // namespace chatterino
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QColor>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+namespace chatterino {
+
+struct Message;
+struct MessageLayoutContainer;
+
+/// Shares laid out messages between views
+///
+/// A message is often shown in multiple views at once: several splits with
+/// /mentions, /live or /automod, or a split and a reply thread or user info
+/// popup. Views that show the message with the same parameters (width,
+/// scale, element flags, ...) share the same MessageLayoutContainer instead
+/// of laying the message out once per view. Only the containers are shared,
+/// every view keeps its own paint buffers.
+///
+/// Containers aren't changed after they were laid out. If a view needs a
+/// different layout, it creates a new container, the other views keep the
+/// old one until they're laid out again.
+///
+/// The cache only holds weak references, containers are owned by the
+/// MessageLayouts using them. It must only be used from the GUI thread.
+class MessageLayoutCache
+{
+public:
+    /// Everything a layout depends on
+    struct Key {
+        /// The container keeps the message alive through its layout, so the
+        /// address can't be reused while an entry is alive.
+        const Message *message = nullptr;
+        int64_t messageFlags = 0;
+        int64_t elementFlags = 0;
+        int width = 0;
+        float scale = 0;
+        float imageScale = 0;
+        /// WindowManager::getGeneration()
+        int generation = 0;
+        /// Settings & states hiding the message (see MessageLayout)
+        uint8_t hidden = 0;
+        bool expanded = false;
+        QRgb regularText = 0;
+        QRgb systemText = 0;
+        QRgb linkText = 0;
+
+        bool operator==(const Key &other) const = default;
+    };
+
+    static MessageLayoutCache &instance();
+
+    /// Returns the container laid out with `key` if a view still uses it
+    std::shared_ptr<const MessageLayoutContainer> find(const Key &key) const;
+
+    void insert(const Key &key,
+                const std::shared_ptr<const MessageLayoutContainer> &container);
+
+    /// The number of entries, including ones that expired but weren't
+    /// removed yet
+    size_t size() const;
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key &key) const;
+    };
+
+    /// Removes entries whose containers aren't used anymore
+    void prune();
+
+    std::unordered_map<Key, std::weak_ptr<const MessageLayoutContainer>,
+                       KeyHash>
+        entries_;
+    /// Size after which expired entries are removed on the next insert
+    size_t pruneAt_ = 1024;
+};
+
+}  // namespace chatterino
@@ -42,6 +42,7 @@ void MessageLayoutContainer::beginLayout(qreal width, float scale,
                                          float imageScale, MessageFlags flags)
 {
     this->elements_.clear();
+    this->arena_.reset();
     this->lines_.clear();
 
     this->line_ = 0;
@@ -76,7 +77,7 @@ void MessageLayoutContainer::endLayout()
                                      MessageColor::Link);
         static QString dotdotdotText("...");
 
-        auto *element = new TextLayoutElement(
+        auto *element = new (this->arena_) TextLayoutElement(
             dotdotdot, dotdotdotText,
             QSizeF(this->dotdotdotWidth_, this->textLineHeight_),
             QColor("#00D80A"), FontStyle::ChatMediumBold, this->scale_);
@@ -130,6 +131,11 @@ void MessageLayoutContainer::endLayout()
     }
 }
 
+MessageArena &MessageLayoutContainer::arena()
+{
+    return this->arena_;
+}
+
 void MessageLayoutContainer::addElement(MessageLayoutElement *element)
 {
     if (!this->fitsInLine(element->getRect().width()))
@@ -6,6 +6,7 @@
 
 #include "common/Common.hpp"
 #include "common/FlagsEnum.hpp"
+#include "messages/MessageArena.hpp"
 #include "messages/MessageFlag.hpp"
 
 #include <QPoint>
@@ -63,6 +64,14 @@ struct MessageLayoutContainer {
      */
     void addElementNoLineBreak(MessageLayoutElement *element);
 
+    /**
+     * Arena for the layout elements of this message
+     *
+     * Elements should be created with `new (container.arena())`. The arena is
+     * rewound in `beginLayout` once the previous elements are gone.
+     */
+    MessageArena &arena();
+
     /**
      * Break the current line
      */
@@ -241,7 +250,8 @@ private:
     ///    indicate no predecessor.
     ///
     /// @param element[in] The element to add. This must be non-null and
-    ///                    allocated with `new`. Ownership is transferred
+    ///                    allocated with `new` (usually in `arena()`).
+    ///                    Ownership is transferred
     ///                    into this container.
     /// @param forceAdd When enabled, @a element will be added regardless of
     ///                 `canAddElements`. If @a element won't be added it will
@@ -375,6 +385,8 @@ private:
     /// either LTR or RTL (afterwards this remains constant).
     TextDirection textDirection_ = TextDirection::Neutral;
 
+    // Declared before `elements_`, so the elements are freed first
+    MessageArena arena_;
     std::vector<std::unique_ptr<MessageLayoutElement>> elements_;
 
     /**
@@ -8,6 +8,7 @@
 #include "messages/Emote.hpp"
 #include "messages/Image.hpp"
 #include "messages/layouts/MessageLayoutContext.hpp"
+#include "messages/MessageArena.hpp"
 #include "messages/MessageElement.hpp"
 #include "providers/twitch/TwitchEmotes.hpp"
 #include "util/DebugCount.hpp"
@@ -48,6 +49,27 @@ MessageLayoutElement::~MessageLayoutElement()
     DebugCount::decrease(DebugObject::MessageLayoutElement);
 }
 
+void *MessageLayoutElement::operator new(size_t size)
+{
+    return MessageArena::allocateHeap(size);
+}
+
+void *MessageLayoutElement::operator new(size_t size, MessageArena &arena)
+{
+    return arena.allocate(size);
+}
+
+void MessageLayoutElement::operator delete(void *ptr) noexcept
+{
+    MessageArena::deallocate(ptr);
+}
+
+void MessageLayoutElement::operator delete(void *ptr,
+                                           MessageArena & /*arena*/) noexcept
+{
+    MessageArena::deallocate(ptr);
+}
+
 MessageElement &MessageLayoutElement::getCreator() const
 {
     return this->creator_;
@@ -19,6 +19,7 @@
 class QPainter;
 
 namespace chatterino {
+class MessageArena;
 class MessageElement;
 class Image;
 using ImagePtr = std::shared_ptr<Image>;
@@ -38,6 +39,13 @@ public:
     MessageLayoutElement(MessageLayoutElement &&) = delete;
     MessageLayoutElement &operator=(MessageLayoutElement &&) = delete;
 
+    // Layout elements are usually allocated in the arena of the container
+    // they're added to (see MessageLayoutContainer::arena)
+    static void *operator new(size_t size);
+    static void *operator new(size_t size, MessageArena &arena);
+    static void operator delete(void *ptr) noexcept;
+    static void operator delete(void *ptr, MessageArena &arena) noexcept;
+
     bool reversedNeutral = false;
 
     const QRectF &getRect() const;
@@ -8,6 +8,7 @@
 #include "common/network/NetworkResult.hpp"
 #include "common/Outcome.hpp"
 #include "common/QLogging.hpp"
+#include "controllers/emotes/EmoteSnapshot.hpp"
 #include "messages/Emote.hpp"
 #include "messages/Image.hpp"
 #include "messages/ImageSet.hpp"
@@ -238,25 +239,25 @@ void BttvEmotes::loadEmotes()
         return;
     }
 
-    readProviderEmotesCache("global", "betterttv", [this](const auto &jsonDoc) {
-        auto emotes = this->global_.get();
-        auto pair = parseGlobalEmotes(jsonDoc.array(), *emotes);
-        if (pair.first)
-        {
-            this->setEmotes(std::make_shared<EmoteMap>(std::move(pair.second)));
-        }
-    });
+    if (auto snapshot = readEmoteSnapshot("global", "betterttv"))
+    {
+        this->setEmotes(std::move(snapshot));
+    }
 
     NetworkRequest(QString(globalEmoteApiUrl))
         .timeout(30000)
         .onSuccess([this](auto result) {
-            writeProviderEmotesCache("global", "betterttv", result.getData());
             auto emotes = this->global_.get();
             auto pair = parseGlobalEmotes(result.parseJsonArray(), *emotes);
-            if (pair.first)
+            if (!pair.first)
+            {
+                return;
+            }
+            if (auto changed =
+                    reconcileEmoteMap(emotes, std::move(pair.second)))
             {
-                this->setEmotes(
-                    std::make_shared<EmoteMap>(std::move(pair.second)));
+                writeEmoteSnapshot("global", "betterttv", changed);
+                this->setEmotes(std::move(changed));
             }
         })
         .onError([](auto result) {
@@ -284,7 +285,6 @@ void BttvEmotes::loadChannel(std::weak_ptr<Channel> channel,
             auto emotes =
                 parseChannelEmotes(result.parseJson(), channelDisplayName);
             bool hasEmotes = !emotes.empty();
-            writeProviderEmotesCache(channelId, "betterttv", result.getData());
             callback(std::move(emotes));
 
             if (auto shared = channel.lock(); manualRefresh)
@@ -23,12 +23,12 @@ ChatterinoBadges::ChatterinoBadges()
 
 std::optional<EmotePtr> ChatterinoBadges::getBadge(const UserId &id)
 {
-    std::shared_lock lock(this->mutex_);
+    auto badges = this->badges_.get();
 
-    auto it = this->badgeMap.find(id.string);
-    if (it != this->badgeMap.end())
+    auto it = badges->badgeMap.find(id.string);
+    if (it != badges->badgeMap.end())
     {
-        return this->emotes[it->second];
+        return badges->emotes[it->second];
     }
     return std::nullopt;
 }
@@ -41,8 +41,7 @@ void ChatterinoBadges::loadChatterinoBadges()
         .concurrent()
         .onSuccess([this](auto result) {
             auto jsonRoot = result.parseJson();
-
-            std::unique_lock lock(this->mutex_);
+            auto badges = std::make_shared<Badges>();
 
             int index = 0;
             for (const auto &jsonBadgeValue :
@@ -71,15 +70,17 @@ void ChatterinoBadges::loadChatterinoBadges()
                     .homePage = Url{},
                 };
 
-                this->emotes.push_back(
+                badges->emotes.push_back(
                     std::make_shared<const Emote>(std::move(emote)));
 
                 for (const auto &user : jsonBadge.value("users").toArray())
                 {
-                    this->badgeMap[user.toString()] = index;
+                    badges->badgeMap[user.toString()] = index;
                 }
                 ++index;
             }
+
+            this->badges_.set(std::move(badges));
         })
         .execute();
 }
@@ -5,10 +5,10 @@
 #pragma once
 
 #include "common/Aliases.hpp"
+#include "common/Atomic.hpp"
 
 #include <memory>
 #include <optional>
-#include <shared_mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -47,19 +47,25 @@ public:
 private:
     void loadChatterinoBadges();
 
-    std::shared_mutex mutex_;
+    struct Badges {
+        /**
+         * Maps Twitch user IDs to their badge index
+         */
+        std::unordered_map<QString, int> badgeMap;
 
-    /**
-     * Maps Twitch user IDs to their badge index
-     * Guarded by mutex_
-     */
-    std::unordered_map<QString, int> badgeMap;
+        /**
+         * Keeps a list of badges.
+         * Indexes in here are referred to by badgeMap
+         */
+        std::vector<EmotePtr> emotes;
+    };
 
     /**
-     * Keeps a list of badges.
-     * Indexes in here are referred to by badgeMap
+     * The loaded badges. These are replaced as a whole once they're loaded,
+     * so lookups don't need any locks.
      */
-    std::vector<EmotePtr> emotes;
+    Atomic<std::shared_ptr<const Badges>> badges_{
+        std::make_shared<const Badges>()};
 };
 
 }  // namespace chatterino
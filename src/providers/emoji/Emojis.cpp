@@ -167,11 +167,22 @@ void Emojis::load()
     }
     this->loaded_ = true;
 
+    this->loadData();
+
+    this->loadEmojiSet();
+}
+
+void Emojis::loadData()
+{
+    if (this->dataLoaded_)
+    {
+        return;
+    }
+    this->dataLoaded_ = true;
+
     this->loadEmojis();
 
     this->sortEmojis();
-
-    this->loadEmojiSet();
 }
 
 void Emojis::loadEmojis()
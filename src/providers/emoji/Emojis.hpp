@@ -65,6 +65,14 @@ class Emojis : public IEmojis
 {
 public:
     void load();
+
+    /// @brief Parses the bundled emoji data
+    ///
+    /// This doesn't use the settings or create any images, so it can run in
+    /// any thread before #load() is called. #load() calls it if it hasn't
+    /// run yet.
+    void loadData();
+
     std::vector<std::variant<EmotePtr, QStringView>> parse(
         QStringView text) const override;
 
@@ -92,6 +100,7 @@ private:
     QMap<QChar, QVector<std::shared_ptr<EmojiData>>> emojiFirstByte_;
 
     bool loaded_ = false;
+    bool dataLoaded_ = false;
 };
 
 }  // namespace chatterino
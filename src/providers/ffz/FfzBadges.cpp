@@ -23,16 +23,17 @@ std::vector<FfzBadges::Badge> FfzBadges::getUserBadges(const UserId &id)
 {
     std::vector<Badge> badges;
 
-    std::shared_lock lock(this->mutex_);
+    auto snapshot = this->snapshot_.get();
 
-    auto it = this->userBadges.find(id.string);
-    if (it != this->userBadges.end())
+    auto it = snapshot->userBadges.find(id.string);
+    if (it != snapshot->userBadges.end())
     {
         for (const auto &badgeID : it->second)
         {
-            if (auto badge = this->getBadge(badgeID); badge)
+            auto badge = snapshot->badges.find(badgeID);
+            if (badge != snapshot->badges.end())
             {
-                badges.emplace_back(*badge);
+                badges.emplace_back(badge->second);
             }
         }
     }
@@ -42,9 +43,9 @@ std::vector<FfzBadges::Badge> FfzBadges::getUserBadges(const UserId &id)
 
 std::optional<FfzBadges::Badge> FfzBadges::getBadge(const int badgeID) const
 {
-    this->tgBadges.guard();
-    auto it = this->badges.find(badgeID);
-    if (it != this->badges.end())
+    auto snapshot = this->snapshot_.get();
+    auto it = snapshot->badges.find(badgeID);
+    if (it != snapshot->badges.end())
     {
         return it->second;
     }
@@ -58,10 +59,11 @@ void FfzBadges::load()
 
     NetworkRequest(url)
         .onSuccess([this](auto result) {
-            std::unique_lock lock(this->mutex_);
-
             auto jsonRoot = result.parseJson();
-            this->tgBadges.guard();
+
+            std::lock_guard lock(this->writeMutex_);
+            auto snapshot =
+                std::make_shared<Snapshot>(*this->snapshot_.get());
             for (const auto &jsonBadge_ : jsonRoot.value("badges").toArray())
             {
                 auto jsonBadge = jsonBadge_.toObject();
@@ -92,7 +94,7 @@ void FfzBadges::load()
 
                 int badgeID = jsonBadge.value("id").toInt();
 
-                this->badges[badgeID] = Badge{
+                snapshot->badges[badgeID] = Badge{
                     .emote = std::make_shared<const Emote>(std::move(emote)),
                     .color = QColor(jsonBadge.value("color").toString()),
                 };
@@ -106,7 +108,7 @@ void FfzBadges::load()
                 {
                     auto userIDString = QString::number(user.toInt());
 
-                    auto [userBadges, created] = this->userBadges.emplace(
+                    auto [userBadges, created] = snapshot->userBadges.emplace(
                         std::make_pair<QString, std::set<int>>(
                             std::move(userIDString), {badgeID}));
                     if (!created)
@@ -116,6 +118,7 @@ void FfzBadges::load()
                     }
                 }
             }
+            this->snapshot_.set(std::move(snapshot));
         })
         .execute();
 }
@@ -124,26 +127,30 @@ void FfzBadges::registerBadge(int badgeID, Badge badge)
 {
     assert(getApp()->isTest());
 
-    std::unique_lock lock(this->mutex_);
+    std::lock_guard lock(this->writeMutex_);
 
-    this->badges.emplace(badgeID, std::move(badge));
+    auto snapshot = std::make_shared<Snapshot>(*this->snapshot_.get());
+    snapshot->badges.emplace(badgeID, std::move(badge));
+    this->snapshot_.set(std::move(snapshot));
 }
 
 void FfzBadges::assignBadgeToUser(const UserId &userID, int badgeID)
 {
     assert(getApp()->isTest());
 
-    std::unique_lock lock(this->mutex_);
+    std::lock_guard lock(this->writeMutex_);
 
-    auto it = this->userBadges.find(userID.string);
-    if (it != this->userBadges.end())
+    auto snapshot = std::make_shared<Snapshot>(*this->snapshot_.get());
+    auto it = snapshot->userBadges.find(userID.string);
+    if (it != snapshot->userBadges.end())
     {
         it->second.emplace(badgeID);
     }
     else
     {
-        this->userBadges.emplace(userID.string, std::set{badgeID});
+        snapshot->userBadges.emplace(userID.string, std::set{badgeID});
     }
+    this->snapshot_.set(std::move(snapshot));
 }
 
 }  // namespace chatterino
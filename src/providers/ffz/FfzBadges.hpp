@@ -5,15 +5,15 @@
 #pragma once
 
 #include "common/Aliases.hpp"
-#include "util/ThreadGuard.hpp"
+#include "common/Atomic.hpp"
 
 #include <QColor>
 #include <QString>
 
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
-#include <shared_mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -41,14 +41,20 @@ public:
     void load();
 
 private:
-    std::shared_mutex mutex_;
+    struct Snapshot {
+        // userBadges points a user ID to the list of badges they have
+        std::unordered_map<QString, std::set<int>> userBadges;
 
-    // userBadges points a user ID to the list of badges they have
-    std::unordered_map<QString, std::set<int>> userBadges;
+        // badges points a badge ID to the information about the badge
+        std::unordered_map<int, Badge> badges;
+    };
 
-    // badges points a badge ID to the information about the badge
-    std::unordered_map<int, Badge> badges;
-    ThreadGuard tgBadges;
+    /// Updates copy the current snapshot and publish the copy, so lookups
+    /// don't need any locks.
+    Atomic<std::shared_ptr<const Snapshot>> snapshot_{
+        std::make_shared<const Snapshot>()};
+    /// Serializes updates of `snapshot_`
+    std::mutex writeMutex_;
 };
 
 }  // namespace chatterino
@@ -7,6 +7,7 @@
 #include "common/network/NetworkRequest.hpp"
 #include "common/network/NetworkResult.hpp"
 #include "common/QLogging.hpp"
+#include "controllers/emotes/EmoteSnapshot.hpp"
 #include "messages/Emote.hpp"
 #include "messages/Image.hpp"
 #include "messages/MessageBuilder.hpp"
@@ -242,20 +243,23 @@ void FfzEmotes::loadEmotes()
         return;
     }
 
-    readProviderEmotesCache("global", "frankerfacez", [this](auto jsonDoc) {
-        auto parsedSet = parseGlobalEmotes(jsonDoc.object());
-        this->setEmotes(std::make_shared<EmoteMap>(std::move(parsedSet)));
-    });
+    if (auto snapshot = readEmoteSnapshot("global", "frankerfacez"))
+    {
+        this->setEmotes(std::move(snapshot));
+    }
 
     QString url("https://api.frankerfacez.com/v1/set/global");
 
     NetworkRequest(url)
         .timeout(30000)
         .onSuccess([this](auto result) {
-            writeProviderEmotesCache("global", "frankerfacez",
-                                     result.getData());
             auto parsedSet = parseGlobalEmotes(result.parseJson());
-            this->setEmotes(std::make_shared<EmoteMap>(std::move(parsedSet)));
+            if (auto changed = reconcileEmoteMap(this->global_.get(),
+                                                 std::move(parsedSet)))
+            {
+                writeEmoteSnapshot("global", "frankerfacez", changed);
+                this->setEmotes(std::move(changed));
+            }
         })
         .onError([](auto result) {
             qCWarning(chatterinoFfzemotes)
@@ -288,8 +292,6 @@ void FfzEmotes::loadChannel(
                     vipBadgeCallback = std::move(vipBadgeCallback),
                     channelBadgesCallback = std::move(channelBadgesCallback),
                     channel, channelID, manualRefresh](const auto &result) {
-            writeProviderEmotesCache(channelID, "frankerfacez",
-                                     result.getData());
             const auto json = result.parseJson();
 
             auto emoteMap = parseChannelEmotes(json);
@@ -7,18 +7,158 @@
 #include "common/Env.hpp"
 #include "common/network/NetworkRequest.hpp"
 #include "common/network/NetworkResult.hpp"
+#include "debug/AssertInGuiThread.hpp"
 #include "providers/links/LinkInfo.hpp"
 #include "singletons/Settings.hpp"
+#include "util/QStringHash.hpp"
 
+#include <lrucache/lrucache.hpp>
+#include <QPointer>
 #include <QStringBuilder>
+#include <QUrl>
+
+#include <unordered_map>
+#include <vector>
 
 namespace chatterino {
 
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+void fetchFromApi(const QString &url, std::function<void(LinkResolution)> done)
+{
+    NetworkRequest(Env::get().linkResolverUrl.arg(QString::fromUtf8(
+                       QUrl::toPercentEncoding(url, {}, "/:"))))
+        .timeout(30000)
+        .onSuccess([done](const NetworkResult &result) {
+            const auto root = result.parseJson();
+            LinkResolution resolution;
+            QString response;
+            if (root["status"].toInt() == 200)
+            {
+                response = root["tooltip"].toString();
+                resolution.thumbnail = root["thumbnail"].toString();
+                resolution.resolvedUrl = root["link"].toString();
+            }
+            else
+            {
+                response = root["message"].toString();
+                resolution.negative = true;
+            }
+
+            resolution.tooltip = QUrl::fromPercentEncoding(response.toUtf8());
+            done(std::move(resolution));
+        })
+        .onError([done](const auto &result) {
+            done({
+                .tooltip = u"No link info found (" % result.formatError() %
+                           u')',
+                .errored = true,
+                .negative = true,
+            });
+        })
+        .execute();
+}
+
+void applyResolution(LinkInfo *info, const LinkResolution &resolution)
+{
+    if (!resolution.thumbnail.isEmpty())
+    {
+        info->setThumbnail(Image::fromUrl({resolution.thumbnail}));
+    }
+    if (getSettings()->unshortLinks && !resolution.resolvedUrl.isEmpty())
+    {
+        info->setResolvedUrl(resolution.resolvedUrl);
+    }
+
+    info->setTooltip(resolution.tooltip);
+    info->setState(resolution.errored ? LinkInfo::State::Errored
+                                      : LinkInfo::State::Resolved);
+}
+
+}  // namespace
+
+struct LinkResolver::State {
+    State(Fetch fetch, Options options)
+        : fetch(std::move(fetch))
+        , options(options)
+        , results(options.capacity)
+    {
+    }
+
+    struct Entry {
+        LinkResolution resolution;
+        Clock::time_point expiresAt;
+    };
+
+    Fetch fetch;
+    Options options;
+
+    /// normalized URL -> result
+    cache::lru_cache<QString, Entry> results;
+    /// normalized URL -> infos waiting for the request
+    std::unordered_map<QString, std::vector<QPointer<LinkInfo>>> inFlight;
+
+    const Entry *cached(const QString &key)
+    {
+        if (!this->results.exists(key))
+        {
+            return nullptr;
+        }
+        const auto &entry = this->results.get(key);
+        if (entry.expiresAt < Clock::now())
+        {
+            return nullptr;
+        }
+        return &entry;
+    }
+
+    void finish(const QString &key, const LinkResolution &resolution)
+    {
+        auto ttl = resolution.negative ? this->options.negativeTtl
+                                       : this->options.ttl;
+        this->results.put(key, {
+                                   .resolution = resolution,
+                                   .expiresAt = Clock::now() + ttl,
+                               });
+
+        auto it = this->inFlight.find(key);
+        if (it == this->inFlight.end())
+        {
+            return;
+        }
+        auto waiters = std::move(it->second);
+        this->inFlight.erase(it);
+
+        for (const auto &info : waiters)
+        {
+            if (info)
+            {
+                applyResolution(info.data(), resolution);
+            }
+        }
+    }
+};
+
+LinkResolver::LinkResolver()
+    : LinkResolver(fetchFromApi, Options{})
+{
+}
+
+LinkResolver::LinkResolver(Fetch fetch, Options options)
+    : state_(std::make_shared<State>(std::move(fetch), options))
+{
+}
+
+LinkResolver::~LinkResolver() = default;
+
 void LinkResolver::resolve(LinkInfo *info)
 {
     using State = LinkInfo::State;
 
     assert(info);
+    assertInGuiThread();
 
     if (info->state() != State::Created)
     {
@@ -31,46 +171,48 @@ void LinkResolver::resolve(LinkInfo *info)
         return;
     }
 
+    auto key = LinkResolver::normalizeUrl(info->originalUrl());
+    if (const auto *entry = this->state_->cached(key))
+    {
+        applyResolution(info, entry->resolution);
+        return;
+    }
+
     info->setTooltip("Loading...");
     info->setState(State::Loading);
 
-    NetworkRequest(Env::get().linkResolverUrl.arg(QString::fromUtf8(
-                       QUrl::toPercentEncoding(info->originalUrl(), {}, "/:"))))
-        .caller(info)
-        .timeout(30000)
-        .onSuccess([info](const NetworkResult &result) {
-            const auto root = result.parseJson();
-            QString response;
-            QString url;
-            ImagePtr thumbnail = nullptr;
-            if (root["status"].toInt() == 200)
-            {
-                response = root["tooltip"].toString();
+    auto &waiters = this->state_->inFlight[key];
+    waiters.emplace_back(info);
+    if (waiters.size() > 1)
+    {
+        // Another info with the same URL already started the request
+        return;
+    }
 
-                if (root.contains("thumbnail"))
-                {
-                    info->setThumbnail(
-                        Image::fromUrl({root["thumbnail"].toString()}));
-                }
-                if (getSettings()->unshortLinks && root.contains("link"))
-                {
-                    info->setResolvedUrl(root["link"].toString());
-                }
-            }
-            else
+    this->state_->fetch(
+        info->originalUrl(),
+        [weak = std::weak_ptr(this->state_),
+         key](const LinkResolution &resolution) {
+            if (auto state = weak.lock())
             {
-                response = root["message"].toString();
+                state->finish(key, resolution);
             }
+        });
+}
 
-            info->setTooltip(QUrl::fromPercentEncoding(response.toUtf8()));
-            info->setState(State::Resolved);
-        })
-        .onError([info](const auto &result) {
-            info->setTooltip(u"No link info found (" % result.formatError() %
-                             u')');
-            info->setState(State::Errored);
-        })
-        .execute();
+QString LinkResolver::normalizeUrl(const QString &url)
+{
+    QUrl parsed(url);
+    if (!parsed.isValid())
+    {
+        return url;
+    }
+
+    // QUrl already lowercases the scheme and host
+    return parsed
+        .adjusted(QUrl::RemoveFragment | QUrl::NormalizePathSegments |
+                  QUrl::StripTrailingSlash)
+        .toString(QUrl::FullyEncoded);
 }
 
 }  // namespace chatterino
@@ -4,6 +4,13 @@
 
 #pragma once
 
+#include <QString>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
 namespace chatterino {
 
 class LinkInfo;
@@ -21,10 +28,46 @@ public:
     virtual void resolve(LinkInfo *info) = 0;
 };
 
+/// The info the resolver API returned for a link
+struct LinkResolution {
+    /// The tooltip without any percent encoding
+    QString tooltip;
+    /// URL of the thumbnail (empty if there's none)
+    QString thumbnail;
+    /// The unshortened URL (empty if the resolver didn't return one)
+    QString resolvedUrl;
+    /// The request failed (the link info will be "Errored")
+    bool errored = false;
+    /// The resolver didn't find any info (e.g. a 404). These results are
+    /// cached for a shorter time.
+    bool negative = false;
+};
+
 class LinkResolver : public ILinkResolver
 {
 public:
-    LinkResolver() = default;
+    /// Loads the info for `url` and calls `done` with the result in the GUI
+    /// thread
+    using Fetch = std::function<void(
+        const QString &url, std::function<void(LinkResolution)> done)>;
+
+    struct Options {
+        /// Maximum number of results to keep
+        size_t capacity = 1024;
+        std::chrono::milliseconds ttl{std::chrono::minutes(10)};
+        /// Time to keep errors and links without info
+        std::chrono::milliseconds negativeTtl{std::chrono::minutes(1)};
+    };
+
+    /// Creates a resolver that loads links through Env::linkResolverUrl
+    LinkResolver();
+    LinkResolver(Fetch fetch, Options options);
+    ~LinkResolver() override;
+
+    LinkResolver(const LinkResolver &) = delete;
+    LinkResolver(LinkResolver &&) = delete;
+    LinkResolver &operator=(const LinkResolver &) = delete;
+    LinkResolver &operator=(LinkResolver &&) = delete;
 
     /// @brief Loads and updates the link info
     ///
@@ -33,8 +76,23 @@ public:
     /// setting. URLs will be unshortened if the "unshortLinks" setting is
     /// enabled. The resolver is set through Env::linkResolverUrl.
     ///
+    /// Results are cached by their normalized URL (see #normalizeUrl()).
+    /// While a link is loading, infos for the same URL wait for that request
+    /// instead of starting their own.
+    ///
     /// @pre @a info must not be nullptr
+    /// @pre The caller must be in the GUI thread.
     void resolve(LinkInfo *info) override;
+
+    /// @brief Returns the key a URL is cached by
+    ///
+    /// The scheme and host are lowercased, the fragment and a trailing slash
+    /// are removed.
+    static QString normalizeUrl(const QString &url);
+
+private:
+    struct State;
+    std::shared_ptr<State> state_;
 };
 
 }  // namespace chatterino
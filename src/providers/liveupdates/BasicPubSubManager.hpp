@@ -68,8 +68,11 @@ public:
     using Subscription = ClientT::Subscription;
     using Client = ClientT;
 
-    BasicPubSubManager(QString host, QString shortName)
-        : pool_(std::make_optional<WebSocketPool>(shortName))
+    /// @param nThreads The number of IO-threads for the connections (see
+    ///                 WebSocketPool). With more than one, `Client::onMessage`
+    ///                 of different clients may run concurrently.
+    BasicPubSubManager(QString host, QString shortName, size_t nThreads = 1)
+        : pool_(std::make_optional<WebSocketPool>(shortName, nThreads))
         , host_(std::move(host))
     {
         // We do this here, because `Derived` needs to be a complete type. If we
@@ -44,6 +44,7 @@ void load(
         }
 
         NetworkRequest(url)
+            .priority(NetworkRequestPriority::History)
             .onSuccess([channelPtr, onLoaded](const auto &result) {
                 assert(!isAppAboutToQuit());
 
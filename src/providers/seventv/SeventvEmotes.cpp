@@ -8,11 +8,13 @@
 #include "common/Literals.hpp"
 #include "common/network/NetworkResult.hpp"
 #include "common/QLogging.hpp"
+#include "controllers/emotes/EmoteSnapshot.hpp"
 #include "messages/Emote.hpp"
 #include "messages/Image.hpp"
 #include "messages/ImageSet.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "providers/seventv/eventapi/Dispatch.hpp"
+#include "providers/seventv/eventapi/EmoteSetCoalescer.hpp"
 #include "providers/seventv/SeventvAPI.hpp"
 #include "providers/twitch/TwitchChannel.hpp"
 #include "singletons/Settings.hpp"
@@ -133,18 +135,17 @@ bool checkEmoteVisibility(const QJsonObject &emoteData)
     return !flags.has(SeventvEmoteFlag::ContentTwitchDisallowed);
 }
 
-EmotePtr createUpdatedEmote(const EmotePtr &oldEmote,
-                            const EmoteUpdateDispatch &dispatch)
+EmotePtr createRenamedEmote(const EmotePtr &oldEmote, const QString &newName)
 {
     bool toNonAliased = oldEmote->baseName.has_value() &&
-                        dispatch.emoteName == oldEmote->baseName->string;
+                        newName == oldEmote->baseName->string;
 
     auto baseName = oldEmote->baseName.value_or(oldEmote->name);
     auto emote = std::make_shared<const Emote>(Emote(
-        {EmoteName{dispatch.emoteName}, oldEmote->images,
+        {EmoteName{newName}, oldEmote->images,
          toNonAliased
-             ? createTooltip(dispatch.emoteName, oldEmote->author.string, false)
-             : createAliasedTooltip(dispatch.emoteName, baseName.string,
+             ? createTooltip(newName, oldEmote->author.string, false)
+             : createAliasedTooltip(newName, baseName.string,
                                     oldEmote->author.string, false),
          oldEmote->homePage, oldEmote->zeroWidth, oldEmote->id,
          oldEmote->author, makeConditionedOptional(!toNonAliased, baseName)}));
@@ -225,25 +226,27 @@ void SeventvEmotes::loadGlobalEmotes()
         return;
     }
 
-    readProviderEmotesCache("global", "seventv", [this](auto jsonDoc) {
-        auto emoteMap = parseEmotes(jsonDoc.object()["emotes"].toArray(), true);
-        this->setGlobalEmotes(std::make_shared<EmoteMap>(std::move(emoteMap)));
-    });
+    if (auto snapshot = readEmoteSnapshot("global", "seventv"))
+    {
+        this->setGlobalEmotes(std::move(snapshot));
+    }
 
     qCDebug(chatterinoSeventv) << "Loading 7TV Global Emotes";
 
     getApp()->getSeventvAPI()->getEmoteSet(
         u"global"_s,
         [this](const auto &json) {
-            writeProviderEmotesCache("global", "seventv",
-                                     QJsonDocument(json).toJson());
             QJsonArray parsedEmotes = json["emotes"].toArray();
 
             auto emoteMap = parseEmotes(parsedEmotes, true);
             qCDebug(chatterinoSeventv)
                 << "Loaded" << emoteMap.size() << "7TV Global Emotes";
-            this->setGlobalEmotes(
-                std::make_shared<EmoteMap>(std::move(emoteMap)));
+            if (auto changed = reconcileEmoteMap(this->global_.get(),
+                                                 std::move(emoteMap)))
+            {
+                writeEmoteSnapshot("global", "seventv", changed);
+                this->setGlobalEmotes(std::move(changed));
+            }
         },
         [](const auto &result) {
             qCWarning(chatterinoSeventv)
@@ -268,8 +271,6 @@ void SeventvEmotes::loadChannelEmotes(
         channelId,
         [callback = std::move(callback), channel, channelId,
          manualRefresh](const auto &json) {
-            writeProviderEmotesCache(channelId, "seventv",
-                                     QJsonDocument(json).toJson());
             const auto emoteSet = json["emote_set"].toObject();
             const auto parsedEmotes = emoteSet["emotes"].toArray();
 
@@ -353,74 +354,94 @@ void SeventvEmotes::loadChannelEmotes(
         });
 }
 
-std::optional<EmotePtr> SeventvEmotes::addEmote(
-    Atomic<std::shared_ptr<const EmoteMap>> &map,
-    const EmoteAddDispatch &dispatch)
+EmotePtr SeventvEmotes::createAddedEmote(const EmoteAddDispatch &dispatch)
 {
-    // Check for visibility first, so we don't copy the map.
     auto emoteData = dispatch.emoteJson["data"].toObject();
     if (emoteData.empty() || !checkEmoteVisibility(emoteData))
     {
-        return std::nullopt;
+        return nullptr;
     }
 
-    // This copies the map.
-    EmoteMap updatedMap = *map.get();
     auto result = createEmote(dispatch.emoteJson, emoteData, false);
     if (!result.hasImages)
     {
         // Incoming emote didn't contain any images, abort
         qCDebug(chatterinoSeventv)
             << "Emote without images:" << dispatch.emoteJson;
-        return std::nullopt;
+        return nullptr;
     }
-    auto emote = std::make_shared<const Emote>(std::move(result.emote));
-    updatedMap[result.name] = emote;
-    map.set(std::make_shared<EmoteMap>(std::move(updatedMap)));
-
-    return emote;
+    return std::make_shared<const Emote>(std::move(result.emote));
 }
 
-std::optional<EmotePtr> SeventvEmotes::updateEmote(
+std::vector<EmoteSetChange> SeventvEmotes::applyChanges(
     Atomic<std::shared_ptr<const EmoteMap>> &map,
-    const EmoteUpdateDispatch &dispatch)
+    const std::vector<EmoteSetChange> &changes)
 {
+    std::vector<EmoteSetChange> applied;
+    std::optional<EmoteMap> updatedMap;
     auto oldMap = map.get();
-    auto oldEmote = oldMap->findEmote(dispatch.emoteName, dispatch.emoteID);
-    if (oldEmote == oldMap->end())
+
+    for (const auto &change : changes)
     {
-        return std::nullopt;
-    }
+        EmotePtr oldEmote;
+        if (!change.oldName.isEmpty())
+        {
+            auto it = oldMap->findEmote(change.oldName, change.emoteID);
+            if (it != oldMap->end())
+            {
+                oldEmote = it->second;
+            }
+        }
+
+        EmotePtr newEmote;
+        if (change.addedEmote)
+        {
+            newEmote = change.addedEmote;
+            if (newEmote->name.string != change.newName)
+            {
+                // renamed after it was added
+                newEmote = createRenamedEmote(newEmote, change.newName);
+            }
+        }
+        else if (!change.newName.isEmpty() && oldEmote)
+        {
+            newEmote = createRenamedEmote(oldEmote, change.newName);
+        }
 
-    // This copies the map.
-    EmoteMap updatedMap = *map.get();
-    updatedMap.erase(oldEmote->second->name);
+        if (!oldEmote && !newEmote)
+        {
+            // removed or renamed an emote we don't know about
+            continue;
+        }
 
-    auto emote = createUpdatedEmote(oldEmote->second, dispatch);
-    updatedMap[emote->name] = emote;
-    map.set(std::make_shared<EmoteMap>(std::move(updatedMap)));
+        if (!updatedMap)
+        {
+            // This copies the map.
+            updatedMap = *oldMap;
+        }
+        if (oldEmote)
+        {
+            updatedMap->erase(oldEmote->name);
+        }
+        if (newEmote)
+        {
+            (*updatedMap)[newEmote->name] = newEmote;
+        }
 
-    return emote;
-}
+        auto &result = applied.emplace_back(change);
+        if (!oldEmote)
+        {
+            // it was already removed
+            result.oldName.clear();
+        }
+    }
 
-std::optional<EmotePtr> SeventvEmotes::removeEmote(
-    Atomic<std::shared_ptr<const EmoteMap>> &map,
-    const EmoteRemoveDispatch &dispatch)
-{
-    // This copies the map.
-    EmoteMap updatedMap = *map.get();
-    auto it = updatedMap.findEmote(dispatch.emoteName, dispatch.emoteID);
-    if (it == updatedMap.end())
+    if (updatedMap)
     {
-        // We already copied the map at this point and are now discarding the copy.
-        // This is fine, because this case should be really rare.
-        return std::nullopt;
+        map.set(std::make_shared<EmoteMap>(std::move(*updatedMap)));
     }
-    auto emote = it->second;
-    updatedMap.erase(it);
-    map.set(std::make_shared<EmoteMap>(std::move(updatedMap)));
 
-    return emote;
+    return applied;
 }
 
 void SeventvEmotes::getEmoteSet(
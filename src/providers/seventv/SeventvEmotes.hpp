@@ -26,8 +26,7 @@ class ImageSet;
 class Channel;
 namespace seventv::eventapi {
 struct EmoteAddDispatch;
-struct EmoteUpdateDispatch;
-struct EmoteRemoveDispatch;
+struct EmoteSetChange;
 }  // namespace seventv::eventapi
 
 // https://github.com/SevenTV/API/blob/a84e884b5590dbb5d91a5c6b3548afabb228f385/data/model/emote-set.model.go#L29-L36
@@ -115,37 +114,24 @@ public:
         bool manualRefresh, bool cacheHit);
 
     /**
-     * Adds an emote to the `map` if it's valid.
-     * This will _copy_ the emote map and
-     * update the `Atomic`.
+     * Creates the emote added in `dispatch` if it's valid and visible.
+     * This can be called from any thread.
      *
-     * @return The added emote if an emote was added.
+     * @return The emote or nullptr if it shouldn't be added.
      */
-    static std::optional<EmotePtr> addEmote(
-        Atomic<std::shared_ptr<const EmoteMap>> &map,
+    static EmotePtr createAddedEmote(
         const seventv::eventapi::EmoteAddDispatch &dispatch);
 
     /**
-     * Updates an emote in this `map`.
-     * This will _copy_ the emote map and
-     * update the `Atomic`.
-     *
-     * @return The updated emote if any emote was updated.
-     */
-    static std::optional<EmotePtr> updateEmote(
-        Atomic<std::shared_ptr<const EmoteMap>> &map,
-        const seventv::eventapi::EmoteUpdateDispatch &dispatch);
-
-    /**
-     * Removes an emote from this `map`.
-     * This will _copy_ the emote map and
+     * Applies all `changes` to the `map`.
+     * This will _copy_ the emote map at most once and
      * update the `Atomic`.
      *
-     * @return The removed emote if any emote was removed.
+     * @return The changes that had an effect on the map.
      */
-    static std::optional<EmotePtr> removeEmote(
+    static std::vector<seventv::eventapi::EmoteSetChange> applyChanges(
         Atomic<std::shared_ptr<const EmoteMap>> &map,
-        const seventv::eventapi::EmoteRemoveDispatch &dispatch);
+        const std::vector<seventv::eventapi::EmoteSetChange> &changes);
 
     /** Fetches an emote-set by its id */
     static void getEmoteSet(
@@ -7,6 +7,7 @@
 #include "Application.hpp"
 #include "providers/liveupdates/BasicPubSubManager.hpp"
 #include "providers/seventv/eventapi/Client.hpp"
+#include "providers/seventv/eventapi/EmoteSetCoalescer.hpp"
 
 #include <QJsonArray>
 
@@ -53,7 +54,9 @@ public:
 SeventvEventAPIPrivate::SeventvEventAPIPrivate(
     SeventvEventAPI &parent, QString host,
     std::chrono::milliseconds defaultHeartbeatInterval)
-    : BasicPubSubManager(std::move(host), u"7TV"_s)
+    // Many emote-sets need several connections. Their clients only touch
+    // thread-safe state, so spread them over two threads.
+    : BasicPubSubManager(std::move(host), u"7TV"_s, 2)
     , heartbeatInterval(defaultHeartbeatInterval)
     , parent(parent)
 {
@@ -91,7 +94,15 @@ void SeventvEventAPIPrivate::checkHeartbeats()
 
 SeventvEventAPI::SeventvEventAPI(
     QString host, std::chrono::milliseconds defaultHeartbeatInterval)
-    : private_(std::make_unique<SeventvEventAPIPrivate>(
+    : emoteSetCoalescer_(std::make_shared<EmoteSetCoalescer>(
+          EMOTE_SET_UPDATE_WINDOW,
+          [this](auto updates) {
+              for (const auto &update : updates)
+              {
+                  this->signals_.emoteSetUpdated.invoke(update);
+              }
+          }))
+    , private_(std::make_unique<SeventvEventAPIPrivate>(
           *this, std::move(host), defaultHeartbeatInterval))
 {
 }
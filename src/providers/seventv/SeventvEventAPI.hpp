@@ -7,6 +7,7 @@
 #include <pajlada/signals/signal.hpp>
 #include <QString>
 
+#include <chrono>
 #include <memory>
 
 namespace chatterino {
@@ -16,6 +17,9 @@ struct Diag;
 }  // namespace liveupdates
 
 namespace seventv::eventapi {
+class Client;
+class EmoteSetCoalescer;
+struct EmoteSetUpdate;
 struct EmoteAddDispatch;
 struct EmoteUpdateDispatch;
 struct EmoteRemoveDispatch;
@@ -36,11 +40,20 @@ public:
                         std::chrono::milliseconds(25000));
     ~SeventvEventAPI();
 
+    /// How long emote-set dispatches are collected before they're sent to
+    /// the GUI thread
+    static constexpr std::chrono::milliseconds EMOTE_SET_UPDATE_WINDOW{100};
+
     struct {
+        // These are invoked from the websocket thread for every dispatch
         Signal<seventv::eventapi::EmoteAddDispatch> emoteAdded;
         Signal<seventv::eventapi::EmoteUpdateDispatch> emoteUpdated;
         Signal<seventv::eventapi::EmoteRemoveDispatch> emoteRemoved;
         Signal<seventv::eventapi::UserConnectionUpdateDispatch> userUpdated;
+
+        /// Invoked from the GUI thread with the combined changes of an
+        /// emote-set within EMOTE_SET_UPDATE_WINDOW
+        Signal<seventv::eventapi::EmoteSetUpdate> emoteSetUpdated;
     } signals_;  // NOLINT(readability-identifier-naming)
 
     /**
@@ -78,7 +91,11 @@ public:
     const liveupdates::Diag &diag() const;
 
 private:
+    // Declared first, so it outlives the connections using it
+    std::shared_ptr<seventv::eventapi::EmoteSetCoalescer> emoteSetCoalescer_;
     std::unique_ptr<SeventvEventAPIPrivate> private_;
+
+    friend seventv::eventapi::Client;
 };
 
 }  // namespace chatterino
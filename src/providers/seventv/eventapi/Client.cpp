@@ -6,9 +6,11 @@
 
 #include "Application.hpp"
 #include "providers/seventv/eventapi/Dispatch.hpp"
+#include "providers/seventv/eventapi/EmoteSetCoalescer.hpp"
 #include "providers/seventv/eventapi/Message.hpp"
 #include "providers/seventv/eventapi/Subscription.hpp"
 #include "providers/seventv/SeventvBadges.hpp"
+#include "providers/seventv/SeventvEmotes.hpp"
 #include "providers/seventv/SeventvEventAPI.hpp"
 #include "util/QMagicEnum.hpp"
 
@@ -189,6 +191,11 @@ void Client::onEmoteSetUpdate(const Dispatch &dispatch)
         if (added.validate())
         {
             this->manager_.signals_.emoteAdded.invoke(added);
+            if (auto emote = SeventvEmotes::createAddedEmote(added))
+            {
+                this->manager_.emoteSetCoalescer_->add(added,
+                                                       std::move(emote));
+            }
         }
         else
         {
@@ -211,6 +218,7 @@ void Client::onEmoteSetUpdate(const Dispatch &dispatch)
         if (update.validate())
         {
             this->manager_.signals_.emoteUpdated.invoke(update);
+            this->manager_.emoteSetCoalescer_->update(update);
         }
         else
         {
@@ -232,6 +240,7 @@ void Client::onEmoteSetUpdate(const Dispatch &dispatch)
         if (removed.validate())
         {
             this->manager_.signals_.emoteRemoved.invoke(removed);
+            this->manager_.emoteSetCoalescer_->remove(removed);
         }
         else
         {
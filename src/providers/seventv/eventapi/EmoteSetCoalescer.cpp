@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "providers/seventv/eventapi/EmoteSetCoalescer.hpp"
+
+#include "debug/AssertInGuiThread.hpp"
+#include "providers/seventv/eventapi/Dispatch.hpp"
+#include "util/PostToThread.hpp"
+
+#include <QTimer>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace chatterino::seventv::eventapi {
+
+EmoteSetCoalescer::EmoteSetCoalescer(std::chrono::milliseconds window,
+                                     Callback onFlush)
+    : window_(window)
+    , onFlush_(std::move(onFlush))
+{
+}
+
+void EmoteSetCoalescer::add(const EmoteAddDispatch &dispatch, EmotePtr emote)
+{
+    this->merge(dispatch.emoteSetID,
+                {
+                    .emoteID = dispatch.emoteID,
+                    .oldName = {},
+                    .newName = dispatch.emoteJson["name"].toString(),
+                    .addedEmote = std::move(emote),
+                    .actorName = dispatch.actorName,
+                },
+                false);
+}
+
+void EmoteSetCoalescer::update(const EmoteUpdateDispatch &dispatch)
+{
+    this->merge(dispatch.emoteSetID,
+                {
+                    .emoteID = dispatch.emoteID,
+                    .oldName = dispatch.oldEmoteName,
+                    .newName = dispatch.emoteName,
+                    .addedEmote = nullptr,
+                    .actorName = dispatch.actorName,
+                },
+                false);
+}
+
+void EmoteSetCoalescer::remove(const EmoteRemoveDispatch &dispatch)
+{
+    this->merge(dispatch.emoteSetID,
+                {
+                    .emoteID = dispatch.emoteID,
+                    .oldName = dispatch.emoteName,
+                    .newName = {},
+                    .addedEmote = nullptr,
+                    .actorName = dispatch.actorName,
+                },
+                true);
+}
+
+void EmoteSetCoalescer::merge(const QString &emoteSetID, EmoteSetChange change,
+                              bool isRemoval)
+{
+    std::unique_lock lock(this->mutex_);
+
+    auto set = std::ranges::find(this->pending_, emoteSetID,
+                                 &EmoteSetUpdate::emoteSetID);
+    if (set == this->pending_.end())
+    {
+        this->pending_.push_back({.emoteSetID = emoteSetID, .changes = {}});
+        set = std::prev(this->pending_.end());
+    }
+
+    auto existing = std::ranges::find(set->changes, change.emoteID,
+                                      &EmoteSetChange::emoteID);
+    if (existing == set->changes.end())
+    {
+        set->changes.push_back(std::move(change));
+    }
+    else
+    {
+        // Keep the name from before the window and take everything else
+        // from the latest dispatch. A rename keeps an emote added in this
+        // window, a removal drops it.
+        existing->newName = std::move(change.newName);
+        existing->actorName = std::move(change.actorName);
+        if (change.addedEmote || isRemoval)
+        {
+            existing->addedEmote = std::move(change.addedEmote);
+        }
+
+        if (existing->oldName.isEmpty() && existing->newName.isEmpty())
+        {
+            // added and removed again
+            set->changes.erase(existing);
+        }
+    }
+
+    if (this->flushScheduled_)
+    {
+        return;
+    }
+    this->flushScheduled_ = true;
+    lock.unlock();
+
+    runInGuiThread([weak = this->weak_from_this(), window = this->window_] {
+        QTimer::singleShot(window, [weak] {
+            if (auto self = weak.lock())
+            {
+                self->flush();
+            }
+        });
+    });
+}
+
+void EmoteSetCoalescer::flush()
+{
+    assertInGuiThread();
+
+    std::vector<EmoteSetUpdate> updates;
+    {
+        std::lock_guard lock(this->mutex_);
+        updates = std::exchange(this->pending_, {});
+        this->flushScheduled_ = false;
+    }
+
+    std::erase_if(updates, [](const auto &update) {
+        return update.changes.empty();
+    });
+    if (!updates.empty())
+    {
+        this->onFlush_(std::move(updates));
+    }
+}
+
+}  // namespace chatterino::seventv::eventapi
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <QString>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace chatterino {
+
+struct Emote;
+using EmotePtr = std::shared_ptr<const Emote>;
+
+}  // namespace chatterino
+
+namespace chatterino::seventv::eventapi {
+
+struct EmoteAddDispatch;
+struct EmoteUpdateDispatch;
+struct EmoteRemoveDispatch;
+
+/// The combined effect of all dispatches for one emote in a window
+struct EmoteSetChange {
+    QString emoteID;
+    /// Name before the first dispatch (empty if the emote was added)
+    QString oldName;
+    /// Name after the last dispatch (empty if the emote was removed)
+    QString newName;
+    /// The emote if it was (re-)added, created on the websocket thread
+    EmotePtr addedEmote;
+    /// Actor of the last dispatch
+    QString actorName;
+};
+
+struct EmoteSetUpdate {
+    QString emoteSetID;
+    /// In the order the emotes were first changed
+    std::vector<EmoteSetChange> changes;
+};
+
+/// Collects the emote dispatches of all emote-sets and delivers them to the
+/// GUI thread in batches
+///
+/// Dispatches are added from the websocket thread. The first one in a
+/// window schedules a flush on the GUI thread. Changes to the same emote
+/// within a window are combined, so an emote that's added and removed again
+/// is never seen by the GUI thread.
+class EmoteSetCoalescer
+    : public std::enable_shared_from_this<EmoteSetCoalescer>
+{
+public:
+    using Callback = std::function<void(std::vector<EmoteSetUpdate>)>;
+
+    /// @param onFlush Called in the GUI thread with all updates of a window
+    EmoteSetCoalescer(std::chrono::milliseconds window, Callback onFlush);
+
+    /// @param emote The emote created from the dispatch
+    void add(const EmoteAddDispatch &dispatch, EmotePtr emote);
+    void update(const EmoteUpdateDispatch &dispatch);
+    void remove(const EmoteRemoveDispatch &dispatch);
+
+    /// Delivers all pending updates now
+    ///
+    /// Must be called from the GUI thread.
+    void flush();
+
+private:
+    /// Merges `change` into the pending changes of `emoteSetID`
+    void merge(const QString &emoteSetID, EmoteSetChange change,
+               bool isRemoval);
+
+    const std::chrono::milliseconds window_;
+    const Callback onFlush_;
+
+    std::mutex mutex_;
+    std::vector<EmoteSetUpdate> pending_;
+    bool flushScheduled_ = false;
+};
+
+}  // namespace chatterino::seventv::eventapi
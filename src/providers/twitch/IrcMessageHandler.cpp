@@ -18,6 +18,7 @@
 #include "messages/MessageElement.hpp"
 #include "messages/MessageSink.hpp"
 #include "messages/MessageThread.hpp"
+#include "messages/PipelineSettings.hpp"
 #include "providers/twitch/TwitchAccount.hpp"
 #include "providers/twitch/TwitchAccountManager.hpp"
 #include "providers/twitch/TwitchChannel.hpp"
@@ -30,6 +31,7 @@
 #include "util/FormatTime.hpp"
 #include "util/Helpers.hpp"
 #include "util/IrcHelpers.hpp"
+#include "util/VectorMessageSink.hpp"
 
 #include <IrcMessage>
 #include <QLocale>
@@ -89,13 +91,14 @@ MessagePtr generateBannedMessage(bool confirmedBan)
     return builder.release();
 }
 
-int stripLeadingReplyMention(const QVariantMap &tags, QString &content)
+int stripLeadingReplyMention(const QVariantMap &tags, QString &content,
+                             const PipelineSettings &settings)
 {
-    if (!getSettings()->stripReplyMention)
+    if (!settings.stripReplyMention)
     {
         return 0;
     }
-    if (getSettings()->hideReplyContext)
+    if (settings.hideReplyContext)
     {
         // Never strip reply mentions if reply contexts are hidden
         return 0;
@@ -126,14 +129,15 @@ int stripLeadingReplyMention(const QVariantMap &tags, QString &content)
 
 void checkThreadSubscription(const QVariantMap &tags,
                              const QString &senderLogin,
-                             std::shared_ptr<MessageThread> &thread)
+                             std::shared_ptr<MessageThread> &thread,
+                             const PipelineSettings &settings)
 {
     if (thread->subscribed() || thread->unsubscribed())
     {
         return;
     }
 
-    if (getSettings()->autoSubToParticipatedThreads)
+    if (settings.autoSubToParticipatedThreads)
     {
         const auto &currentLogin =
             getApp()->getAccounts()->twitch.getCurrent()->getUserName();
@@ -1103,15 +1107,62 @@ void IrcMessageHandler::handlePartMessage(Communi::IrcMessage *message)
     }
 }
 
+MessagePtrMut IrcMessageHandler::rebuildPrivMessage(
+    Communi::IrcPrivateMessage *message, TwitchChannel *channel)
+{
+    VectorMessageSink sink;
+    return buildMessage(message, sink, channel,
+                        unescapeZeroWidthJoiner(message->content()),
+                        PipelineSettings::current(), false,
+                        message->isAction())
+        .first;
+}
+
 void IrcMessageHandler::addMessage(Communi::IrcMessage *message,
                                    MessageSink &sink, TwitchChannel *chan,
                                    const QString &originalContent,
                                    ITwitchIrcServer &twitch, bool isSub,
                                    bool isAction, const QString &msgType)
+{
+    auto settings = PipelineSettings::current();
+    auto [msg, alert] = buildMessage(message, sink, chan, originalContent,
+                                     settings, isSub, isAction, msgType);
+    if (!msg)
+    {
+        return;
+    }
+
+    sink.applySimilarityFilters(msg);
+
+    if (!msg->flags.has(MessageFlag::Similar) ||
+        (!settings->hideSimilar && settings->shownSimilarTriggerHighlights))
+    {
+        MessageBuilder::triggerHighlights(chan, alert);
+    }
+
+    const auto highlighted = msg->flags.has(MessageFlag::Highlighted);
+    const auto showInMentions = msg->flags.has(MessageFlag::ShowInMentions);
+
+    if (highlighted && showInMentions &&
+        sink.sinkTraits().has(MessageSinkTrait::AddMentionsToGlobalChannel))
+    {
+        twitch.getMentionsChannel()->addMessage(msg, MessageContext::Original);
+    }
+
+    sink.addMessage(msg, MessageContext::Original);
+    chan->addRecentChatter(msg->displayName);
+}
+
+std::pair<MessagePtrMut, HighlightAlert> IrcMessageHandler::buildMessage(
+    Communi::IrcMessage *message, MessageSink &sink, TwitchChannel *chan,
+    const QString &originalContent,
+    std::shared_ptr<const PipelineSettings> settings, bool isSub,
+    bool isAction, const QString &msgType)
 {
     assert(chan);
 
     MessageParseArgs args;
+    args.settings = std::move(settings);
     if (isSub)
     {
         args.isSubscriptionMessage = true;
@@ -1153,7 +1204,8 @@ void IrcMessageHandler::addMessage(Communi::IrcMessage *message,
     args.channelPointRewardId = rewardId;
 
     QString content = originalContent;
-    int messageOffset = stripLeadingReplyMention(tags, content);
+    int messageOffset =
+        stripLeadingReplyMention(tags, content, *args.settings);
 
     ReplyContext replyCtx;
 
@@ -1167,7 +1219,8 @@ void IrcMessageHandler::addMessage(Communi::IrcMessage *message,
         {
             // Thread already exists (has a reply)
             auto thread = threadIt->second.lock();
-            checkThreadSubscription(tags, message->nick(), thread);
+            checkThreadSubscription(tags, message->nick(), thread,
+                                    *args.settings);
             replyCtx.thread = thread;
             rootThread = thread;
         }
@@ -1179,7 +1232,8 @@ void IrcMessageHandler::addMessage(Communi::IrcMessage *message,
             {
                 // Found root reply message
                 auto newThread = std::make_shared<MessageThread>(root);
-                checkThreadSubscription(tags, message->nick(), newThread);
+                checkThreadSubscription(tags, message->nick(), newThread,
+                                        *args.settings);
 
                 replyCtx.thread = newThread;
                 rootThread = newThread;
@@ -1247,29 +1301,15 @@ void IrcMessageHandler::addMessage(Communi::IrcMessage *message,
                 msg->flags.unset(MessageFlag::Highlighted);
             }
         }
-
-        sink.applySimilarityFilters(msg);
-
-        if (!msg->flags.has(MessageFlag::Similar) ||
-            (!getSettings()->hideSimilar &&
-             getSettings()->shownSimilarTriggerHighlights))
-        {
-            MessageBuilder::triggerHighlights(chan, alert);
-        }
-
-        const auto highlighted = msg->flags.has(MessageFlag::Highlighted);
-        const auto showInMentions = msg->flags.has(MessageFlag::ShowInMentions);
-
-        if (highlighted && showInMentions &&
-            sink.sinkTraits().has(MessageSinkTrait::AddMentionsToGlobalChannel))
+        else
         {
-            twitch.getMentionsChannel()->addMessage(msg,
-                                                    MessageContext::Original);
+            // Kept so the message can be rebuilt after it was compacted
+            // (see ColdMessageStore)
+            msg->ircData = message->toData();
         }
-
-        sink.addMessage(msg, MessageContext::Original);
-        chan->addRecentChatter(msg->displayName);
     }
+
+    return {msg, alert};
 }
 
 }  // namespace chatterino
@@ -6,7 +6,9 @@
 
 #include <IrcMessage>
 
+#include <memory>
 #include <optional>
+#include <utility>
 #include <vector>
 
 namespace chatterino {
@@ -16,6 +18,9 @@ class Channel;
 using ChannelPtr = std::shared_ptr<Channel>;
 struct Message;
 using MessagePtr = std::shared_ptr<const Message>;
+using MessagePtrMut = std::shared_ptr<Message>;
+struct HighlightAlert;
+struct PipelineSettings;
 class TwitchChannel;
 class TwitchMessageBuilder;
 class MessageSink;
@@ -67,7 +72,22 @@ public:
                            ITwitchIrcServer &twitch, bool isSub, bool isAction,
                            const QString &msgType = "");
 
+    /// Builds the message for a PRIVMSG again (see Message::ircData)
+    ///
+    /// Unlike #parsePrivMessageInto(), this doesn't trigger highlights and
+    /// doesn't add the message anywhere. Returns nullptr if the message is
+    /// ignored.
+    static MessagePtrMut rebuildPrivMessage(Communi::IrcPrivateMessage *message,
+                                            TwitchChannel *channel);
+
 private:
+    /// Builds the message for #addMessage() without adding it to `sink`
+    static std::pair<MessagePtrMut, HighlightAlert> buildMessage(
+        Communi::IrcMessage *message, MessageSink &sink, TwitchChannel *chan,
+        const QString &originalContent,
+        std::shared_ptr<const PipelineSettings> settings, bool isSub,
+        bool isAction, const QString &msgType = "");
+
     static float similarity(const MessagePtr &msg,
                             const std::vector<MessagePtr> &messages);
     static void setSimilarityFlags(const MessagePtr &message,
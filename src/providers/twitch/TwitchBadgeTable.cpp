@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "providers/twitch/TwitchBadgeTable.hpp"
+
+namespace chatterino {
+
+std::optional<EmotePtr> TwitchBadgeTable::find(QStringView set,
+                                               QStringView version) const
+{
+    auto it = this->badges_.find(KeyView{set, version});
+    if (it != this->badges_.end())
+    {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+std::optional<EmotePtr> TwitchBadgeTable::findAny(const QString &set) const
+{
+    auto it = this->anyOfSet_.find(set);
+    if (it != this->anyOfSet_.end())
+    {
+        return it->second;
+    }
+    return std::nullopt;
+}
+
+void TwitchBadgeTable::insert(const QString &set, const QString &version,
+                              EmotePtr badge)
+{
+    this->anyOfSet_.try_emplace(set, badge);
+    this->badges_.insert_or_assign(Key{set, version}, std::move(badge));
+}
+
+size_t TwitchBadgeTable::size() const
+{
+    return this->badges_.size();
+}
+
+}  // namespace chatterino
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "util/QStringHash.hpp"
+
+#include <QString>
+#include <QStringView>
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+namespace chatterino {
+
+struct Emote;
+using EmotePtr = std::shared_ptr<const Emote>;
+
+/// A flat table of Twitch badges keyed by (set, version)
+///
+/// Tables are published as immutable snapshots (see TwitchBadges and
+/// TwitchChannel), so message building can look up badges without taking any
+/// locks. To add badges, copy the current table, insert into the copy and
+/// publish it.
+class TwitchBadgeTable
+{
+public:
+    /// Returns the badge with @a version from @a set
+    std::optional<EmotePtr> find(QStringView set, QStringView version) const;
+
+    /// Returns any badge from @a set, regardless of its version
+    std::optional<EmotePtr> findAny(const QString &set) const;
+
+    void insert(const QString &set, const QString &version, EmotePtr badge);
+
+    size_t size() const;
+
+private:
+    struct KeyView {
+        QStringView set;
+        QStringView version;
+    };
+
+    struct Key {
+        QString set;
+        QString version;
+
+        operator KeyView() const
+        {
+            return {this->set, this->version};
+        }
+    };
+
+    struct KeyHash {
+        using is_transparent = void;
+
+        size_t operator()(KeyView key) const
+        {
+            return qHash(key.version, qHash(key.set));
+        }
+    };
+
+    struct KeyEqual {
+        using is_transparent = void;
+
+        bool operator()(KeyView a, KeyView b) const
+        {
+            return a.set == b.set && a.version == b.version;
+        }
+    };
+
+    std::unordered_map<Key, EmotePtr, KeyHash, KeyEqual> badges_;
+    /// set -> a badge of that set
+    std::unordered_map<QString, EmotePtr> anyOfSet_;
+};
+
+}  // namespace chatterino
@@ -10,6 +10,7 @@
 #include "messages/Emote.hpp"
 #include "messages/Image.hpp"
 #include "providers/twitch/api/Helix.hpp"
+#include "providers/twitch/TwitchBadgeTable.hpp"
 #include "util/DisplayBadge.hpp"
 #include "util/LoadPixmap.hpp"
 
@@ -32,13 +33,21 @@ constexpr QSize BADGE_BASE_SIZE(18, 18);
 
 namespace chatterino {
 
+TwitchBadges::TwitchBadges()
+    : badgeSets_(std::make_shared<const TwitchBadgeTable>())
+{
+}
+
+TwitchBadges::~TwitchBadges() = default;
+
 void TwitchBadges::loadTwitchBadges()
 {
     assert(this->loaded_ == false);
 
     getHelix()->getGlobalBadges(
         [this](auto globalBadges) {
-            auto badgeSets = this->badgeSets_.access();
+            auto badgeSets =
+                std::make_shared<TwitchBadgeTable>(*this->badgeSets_.get());
 
             for (const auto &badgeSet : globalBadges.badgeSets)
             {
@@ -59,10 +68,11 @@ void TwitchBadges::loadTwitchBadges()
                         .tooltip = Tooltip{version.title},
                         .homePage = version.clickURL,
                     };
-                    (*badgeSets)[setID][version.id] =
-                        std::make_shared<Emote>(emote);
+                    badgeSets->insert(setID, version.id,
+                                      std::make_shared<Emote>(emote));
                 }
             }
+            this->badgeSets_.set(std::move(badgeSets));
 
             this->loaded();
         },
@@ -104,7 +114,8 @@ void TwitchBadges::loadLocalBadges()
 
     {
         const auto &root = doc.object();
-        auto badgeSets = this->badgeSets_.access();
+        auto badgeSets =
+            std::make_shared<TwitchBadgeTable>(*this->badgeSets_.get());
 
         for (auto setIt = root.begin(); setIt != root.end(); setIt++)
         {
@@ -130,9 +141,10 @@ void TwitchBadges::loadLocalBadges()
                     .homePage = Url{versionObj["url"].toString()},
                 };
 
-                (*badgeSets)[key][id] = std::make_shared<Emote>(emote);
+                badgeSets->insert(key, id, std::make_shared<Emote>(emote));
             }
         }
+        this->badgeSets_.set(std::move(badgeSets));
     }
 
     this->loaded();
@@ -163,32 +175,12 @@ void TwitchBadges::loaded()
 std::optional<EmotePtr> TwitchBadges::badge(const QString &set,
                                             const QString &version) const
 {
-    auto badgeSets = this->badgeSets_.access();
-    auto it = badgeSets->find(set);
-    if (it != badgeSets->end())
-    {
-        auto it2 = it->second.find(version);
-        if (it2 != it->second.end())
-        {
-            return it2->second;
-        }
-    }
-    return std::nullopt;
+    return this->badgeSets_.get()->find(set, version);
 }
 
 std::optional<EmotePtr> TwitchBadges::badge(const QString &set) const
 {
-    auto badgeSets = this->badgeSets_.access();
-    auto it = badgeSets->find(set);
-    if (it != badgeSets->end())
-    {
-        const auto &badges = it->second;
-        if (!badges.empty())
-        {
-            return badges.begin()->second;
-        }
-    }
-    return std::nullopt;
+    return this->badgeSets_.get()->findAny(set);
 }
 
 void TwitchBadges::getBadgeIcon(const QString &name, BadgeIconCallback callback)
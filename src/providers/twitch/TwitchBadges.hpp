@@ -4,7 +4,7 @@
 
 #pragma once
 
-#include "common/UniqueAccess.hpp"
+#include "common/Atomic.hpp"
 #include "util/QStringHash.hpp"
 
 #include <pajlada/signals/signal.hpp>
@@ -28,6 +28,7 @@ class Settings;
 class Paths;
 class Image;
 class DisplayBadge;
+class TwitchBadgeTable;
 
 class TwitchBadges
 {
@@ -36,6 +37,14 @@ class TwitchBadges
     using BadgeIconCallback = std::function<void(QString, const QIconPtr)>;
 
 public:
+    TwitchBadges();
+    ~TwitchBadges();
+
+    TwitchBadges(const TwitchBadges &) = delete;
+    TwitchBadges(TwitchBadges &&) = delete;
+    TwitchBadges &operator=(const TwitchBadges &) = delete;
+    TwitchBadges &operator=(TwitchBadges &&) = delete;
+
     // Get badge from name and version
     std::optional<EmotePtr> badge(const QString &set,
                                   const QString &version) const;
@@ -66,9 +75,9 @@ private:
     std::shared_mutex loadedMutex_;
     bool loaded_ = false;
 
-    UniqueAccess<
-        std::unordered_map<QString, std::unordered_map<QString, EmotePtr>>>
-        badgeSets_;  // "bits": { "100": ... "500": ...
+    /// All global badges. This is replaced as a whole once the badges are
+    /// loaded, so lookups don't need any locks.
+    Atomic<std::shared_ptr<const TwitchBadgeTable>> badgeSets_;
 };
 
 }  // namespace chatterino
@@ -13,6 +13,7 @@
 #include "common/QLogging.hpp"
 #include "controllers/accounts/AccountController.hpp"
 #include "controllers/emotes/EmoteController.hpp"
+#include "controllers/emotes/EmoteSnapshot.hpp"
 #include "controllers/notifications/NotificationController.hpp"
 #include "controllers/twitch/LiveController.hpp"
 #include "messages/Emote.hpp"
@@ -30,6 +31,7 @@
 #include "providers/ffz/FfzEmotes.hpp"
 #include "providers/recentmessages/Api.hpp"
 #include "providers/seventv/eventapi/Dispatch.hpp"
+#include "providers/seventv/eventapi/EmoteSetCoalescer.hpp"
 #include "providers/seventv/SeventvAPI.hpp"
 #include "providers/seventv/SeventvEmotes.hpp"
 #include "providers/seventv/SeventvEventAPI.hpp"
@@ -39,6 +41,7 @@
 #include "providers/twitch/IrcMessageHandler.hpp"
 #include "providers/twitch/PubSubManager.hpp"
 #include "providers/twitch/TwitchAccount.hpp"
+#include "providers/twitch/TwitchBadgeTable.hpp"
 #include "providers/twitch/TwitchCommon.hpp"
 #include "providers/twitch/TwitchIrcServer.hpp"
 #include "providers/twitch/TwitchUsers.hpp"
@@ -125,6 +128,7 @@ TwitchChannel::TwitchChannel(const QString &name)
     , bttvEmotes_(std::make_shared<EmoteMap>())
     , ffzEmotes_(std::make_shared<EmoteMap>())
     , seventvEmotes_(std::make_shared<EmoteMap>())
+    , badgeSets_(std::make_shared<const TwitchBadgeTable>())
 {
     qCDebug(chatterinoTwitch) << "[TwitchChannel" << name << "] Opened";
 
@@ -371,23 +375,24 @@ void TwitchChannel::refreshBTTVChannelEmotes(bool manualRefresh)
         return;
     }
 
-    bool cacheHit = readProviderEmotesCache(
-        this->roomId(), "betterttv",
-        [this, weak = weakOf<Channel>(this)](auto jsonDoc) {
-            if (auto shared = weak.lock())
-            {
-                auto emoteMap = bttv::detail::parseChannelEmotes(
-                    jsonDoc.object(), this->getLocalizedName());
-                this->setBttvEmotes(std::make_shared<const EmoteMap>(emoteMap));
-            }
-        });
+    auto snapshot = readEmoteSnapshot(this->roomId(), "betterttv");
+    bool cacheHit = snapshot != nullptr;
+    if (snapshot)
+    {
+        this->setBttvEmotes(std::move(snapshot));
+    }
 
     BttvEmotes::loadChannel(
         weakOf<Channel>(this), this->roomId(), this->getLocalizedName(),
         [this, weak = weakOf<Channel>(this)](auto &&emoteMap) {
             if (auto shared = weak.lock())
             {
-                this->setBttvEmotes(std::make_shared<const EmoteMap>(emoteMap));
+                if (auto changed = reconcileEmoteMap(this->bttvEmotes(),
+                                                     std::move(emoteMap)))
+                {
+                    writeEmoteSnapshot(this->roomId(), "betterttv", changed);
+                    this->setBttvEmotes(std::move(changed));
+                }
             }
         },
         manualRefresh, cacheHit);
@@ -401,18 +406,25 @@ void TwitchChannel::refreshFFZChannelEmotes(bool manualRefresh)
         return;
     }
 
-    bool cacheHit = readProviderEmotesCache(
-        this->roomId(), "frankerfacez", [this](const auto &jsonDoc) {
-            auto emoteMap = ffz::detail::parseChannelEmotes(jsonDoc.object());
-            this->setFfzEmotes(std::make_shared<const EmoteMap>(emoteMap));
-        });
+    auto snapshot = readEmoteSnapshot(this->roomId(), "frankerfacez");
+    bool cacheHit = snapshot != nullptr;
+    if (snapshot)
+    {
+        this->setFfzEmotes(std::move(snapshot));
+    }
 
     FfzEmotes::loadChannel(
         weakOf<Channel>(this), this->roomId(),
         [this, weak = weakOf<Channel>(this)](auto &&emoteMap) {
             if (auto shared = weak.lock())
             {
-                this->setFfzEmotes(std::make_shared<const EmoteMap>(emoteMap));
+                if (auto changed = reconcileEmoteMap(this->ffzEmotes(),
+                                                     std::move(emoteMap)))
+                {
+                    writeEmoteSnapshot(this->roomId(), "frankerfacez",
+                                       changed);
+                    this->setFfzEmotes(std::move(changed));
+                }
             }
         },
         [this, weak = weakOf<Channel>(this)](auto &&modBadge) {
@@ -448,14 +460,12 @@ void TwitchChannel::refreshSevenTVChannelEmotes(bool manualRefresh)
         return;
     }
 
-    bool cacheHit = readProviderEmotesCache(
-        this->roomId(), "seventv", [this](auto jsonDoc) {
-            const auto json = jsonDoc.object();
-            const auto emoteSet = json["emote_set"].toObject();
-            const auto parsedEmotes = emoteSet["emotes"].toArray();
-            auto emoteMap = seventv::detail::parseEmotes(parsedEmotes, false);
-            this->setSeventvEmotes(std::make_shared<const EmoteMap>(emoteMap));
-        });
+    auto snapshot = readEmoteSnapshot(this->roomId(), "seventv");
+    bool cacheHit = snapshot != nullptr;
+    if (snapshot)
+    {
+        this->setSeventvEmotes(std::move(snapshot));
+    }
 
     SeventvEmotes::loadChannelEmotes(
         weakOf<Channel>(this), this->roomId(),
@@ -463,8 +473,12 @@ void TwitchChannel::refreshSevenTVChannelEmotes(bool manualRefresh)
                                              auto channelInfo) {
             if (auto shared = weak.lock())
             {
-                this->setSeventvEmotes(
-                    std::make_shared<const EmoteMap>(emoteMap));
+                if (auto changed = reconcileEmoteMap(this->seventvEmotes(),
+                                                     std::move(emoteMap)))
+                {
+                    writeEmoteSnapshot(this->roomId(), "seventv", changed);
+                    this->setSeventvEmotes(std::move(changed));
+                }
                 this->updateSeventvData(channelInfo.userID,
                                         channelInfo.emoteSetID);
                 this->seventvUserTwitchConnectionIndex_ =
@@ -1166,43 +1180,34 @@ void TwitchChannel::removeBttvEmote(
                                            (*removed)->name.string);
 }
 
-void TwitchChannel::addSeventvEmote(
-    const seventv::eventapi::EmoteAddDispatch &dispatch)
+void TwitchChannel::applySeventvEmoteChanges(
+    const seventv::eventapi::EmoteSetUpdate &update)
 {
-    if (!SeventvEmotes::addEmote(this->seventvEmotes_, dispatch))
-    {
-        return;
-    }
+    auto applied =
+        SeventvEmotes::applyChanges(this->seventvEmotes_, update.changes);
 
-    this->addOrReplaceLiveUpdatesAddRemove(
-        true, "7TV", dispatch.actorName, dispatch.emoteJson["name"].toString());
-}
-
-void TwitchChannel::updateSeventvEmote(
-    const seventv::eventapi::EmoteUpdateDispatch &dispatch)
-{
-    if (!SeventvEmotes::updateEmote(this->seventvEmotes_, dispatch))
+    for (const auto &change : applied)
     {
-        return;
-    }
-
-    auto builder =
-        MessageBuilder(liveUpdatesUpdateEmoteMessage, "7TV", dispatch.actorName,
-                       dispatch.emoteName, dispatch.oldEmoteName);
-    this->addMessage(builder.release(), MessageContext::Original);
-}
-
-void TwitchChannel::removeSeventvEmote(
-    const seventv::eventapi::EmoteRemoveDispatch &dispatch)
-{
-    auto removed = SeventvEmotes::removeEmote(this->seventvEmotes_, dispatch);
-    if (!removed)
-    {
-        return;
+        if (change.oldName.isEmpty())
+        {
+            this->addOrReplaceLiveUpdatesAddRemove(true, "7TV",
+                                                   change.actorName,
+                                                   change.newName);
+        }
+        else if (change.newName.isEmpty())
+        {
+            this->addOrReplaceLiveUpdatesAddRemove(false, "7TV",
+                                                   change.actorName,
+                                                   change.oldName);
+        }
+        else if (change.oldName != change.newName)
+        {
+            auto builder = MessageBuilder(liveUpdatesUpdateEmoteMessage, "7TV",
+                                          change.actorName, change.newName,
+                                          change.oldName);
+            this->addMessage(builder.release(), MessageContext::Original);
+        }
     }
-
-    this->addOrReplaceLiveUpdatesAddRemove(false, "7TV", dispatch.actorName,
-                                           (*removed)->name.string);
 }
 
 void TwitchChannel::updateSeventvUser(
@@ -1374,6 +1379,19 @@ void TwitchChannel::messageRemovedFromStart(const MessagePtr &msg)
     }
 }
 
+MessagePtr TwitchChannel::rebuildMessage(const QByteArray &ircData)
+{
+    std::unique_ptr<Communi::IrcMessage> message(
+        Communi::IrcMessage::fromData(ircData, nullptr));
+    auto *privMessage =
+        dynamic_cast<Communi::IrcPrivateMessage *>(message.get());
+    if (!privMessage)
+    {
+        return nullptr;
+    }
+    return IrcMessageHandler::rebuildPrivMessage(privMessage, this);
+}
+
 const QString &TwitchChannel::subscriptionUrl()
 {
     return this->subscriptionUrl_;
@@ -1868,7 +1886,8 @@ void TwitchChannel::refreshBadges()
 
 void TwitchChannel::addTwitchBadgeSets(const HelixChannelBadges &channelBadges)
 {
-    auto badgeSets = this->badgeSets_.access();
+    auto badgeSets =
+        std::make_shared<TwitchBadgeTable>(*this->badgeSets_.get());
 
     for (const auto &badgeSet : channelBadges.badgeSets)
     {
@@ -1888,9 +1907,11 @@ void TwitchChannel::addTwitchBadgeSets(const HelixChannelBadges &channelBadges)
                 .tooltip = Tooltip{version.title},
                 .homePage = version.clickURL,
             };
-            (*badgeSets)[setID][version.id] = std::make_shared<Emote>(emote);
+            badgeSets->insert(setID, version.id,
+                              std::make_shared<Emote>(emote));
         }
     }
+    this->badgeSets_.set(std::move(badgeSets));
 }
 
 void TwitchChannel::refreshCheerEmotes()
@@ -2181,17 +2202,7 @@ void TwitchChannel::deleteMessagesAs(const QString &messageID,
 std::optional<EmotePtr> TwitchChannel::twitchBadge(const QString &set,
                                                    const QString &version) const
 {
-    auto badgeSets = this->badgeSets_.access();
-    auto it = badgeSets->find(set);
-    if (it != badgeSets->end())
-    {
-        auto it2 = it->second.find(version);
-        if (it2 != it->second.end())
-        {
-            return it2->second;
-        }
-    }
-    return std::nullopt;
+    return this->badgeSets_.get()->find(set, version);
 }
 
 std::vector<FfzBadges::Badge> TwitchChannel::ffzChannelBadges(
@@ -42,6 +42,7 @@ using EmotePtr = std::shared_ptr<const Emote>;
 class EmoteMap;
 
 class TwitchBadges;
+class TwitchBadgeTable;
 class FfzEmotes;
 class BttvEmotes;
 struct BttvLiveUpdateEmoteUpdateAddMessage;
@@ -49,9 +50,7 @@ struct BttvLiveUpdateEmoteRemoveMessage;
 
 class SeventvEmotes;
 namespace seventv::eventapi {
-struct EmoteAddDispatch;
-struct EmoteUpdateDispatch;
-struct EmoteRemoveDispatch;
+struct EmoteSetUpdate;
 struct UserConnectionUpdateDispatch;
 }  // namespace seventv::eventapi
 
@@ -245,14 +244,9 @@ public:
     /** Removes a BTTV channel emote from this channel. */
     void removeBttvEmote(const BttvLiveUpdateEmoteRemoveMessage &message);
 
-    /** Adds a 7TV channel emote to this channel. */
-    void addSeventvEmote(const seventv::eventapi::EmoteAddDispatch &dispatch);
-    /** Updates a 7TV channel emote's name in this channel */
-    void updateSeventvEmote(
-        const seventv::eventapi::EmoteUpdateDispatch &dispatch);
-    /** Removes a 7TV channel emote from this channel */
-    void removeSeventvEmote(
-        const seventv::eventapi::EmoteRemoveDispatch &dispatch);
+    /** Adds, renames and removes 7TV channel emotes in this channel. */
+    void applySeventvEmoteChanges(
+        const seventv::eventapi::EmoteSetUpdate &update);
     /** Updates the current 7TV user. Currently, only the emote-set is updated. */
     void updateSeventvUser(
         const seventv::eventapi::UserConnectionUpdateDispatch &dispatch);
@@ -504,6 +498,7 @@ private:
 
 protected:
     void messageRemovedFromStart(const MessagePtr &msg) override;
+    MessagePtr rebuildMessage(const QByteArray &ircData) override;
 
     Atomic<std::shared_ptr<const EmoteMap>> localTwitchEmotes_;
     Atomic<QString> localTwitchEmoteSetID_;
@@ -518,8 +513,9 @@ protected:
 
 private:
     // Badges
-    UniqueAccess<std::map<QString, std::map<QString, EmotePtr>>>
-        badgeSets_;  // "subscribers": { "0": ... "3": ... "6": ...
+    /// Channel badges ("subscribers": { "0": ... "3": ... "6": ... }).
+    /// Updates publish a new table, so lookups don't need any locks.
+    Atomic<std::shared_ptr<const TwitchBadgeTable>> badgeSets_;
     UniqueAccess<std::vector<CheerEmoteSet>> cheerEmoteSets_;
     UniqueAccess<std::map<QString, ChannelPointReward>> channelPointRewards_;
     boost::circular_buffer_space_optimized<QueuedRedemption>
@@ -19,6 +19,7 @@
 #include "providers/ffz/FfzEmotes.hpp"
 #include "providers/irc/IrcConnection2.hpp"
 #include "providers/seventv/eventapi/Dispatch.hpp"  // IWYU pragma: keep
+#include "providers/seventv/eventapi/EmoteSetCoalescer.hpp"
 #include "providers/seventv/SeventvEmotes.hpp"
 #include "providers/seventv/SeventvEventAPI.hpp"
 #include "providers/twitch/api/Helix.hpp"
@@ -892,46 +893,25 @@ void TwitchIrcServer::initEventAPIs(BttvLiveUpdates *bttvLiveUpdates,
     if (seventvEventAPI != nullptr)
     {
         this->signalHolder.managedConnect(
-            seventvEventAPI->signals_.emoteAdded, [this](const auto &data) {
-                postToThread(
-                    [this, data] {
-                        this->forEachSeventvEmoteSet(
-                            data.emoteSetID, [data](TwitchChannel &chan) {
-                                chan.addSeventvEmote(data);
-                            });
-                    },
-                    this);
-            });
-        this->signalHolder.managedConnect(
-            seventvEventAPI->signals_.emoteUpdated, [this](const auto &data) {
-                postToThread(
-                    [this, data] {
-                        this->forEachSeventvEmoteSet(
-                            data.emoteSetID, [data](TwitchChannel &chan) {
-                                chan.updateSeventvEmote(data);
-                            });
-                    },
-                    this);
+            seventvEventAPI->signals_.emoteSetUpdated,
+            [this](const auto &update) {
+                this->forEachSeventvEmoteSet(
+                    update.emoteSetID, [&update](TwitchChannel &chan) {
+                        chan.applySeventvEmoteChanges(update);
+                    });
             });
         this->signalHolder.managedConnect(
-            seventvEventAPI->signals_.emoteRemoved, [this](const auto &data) {
+            seventvEventAPI->signals_.userUpdated, [this](const auto &data) {
+                // The 7TV connections run on multiple threads
                 postToThread(
                     [this, data] {
-                        this->forEachSeventvEmoteSet(
-                            data.emoteSetID, [data](TwitchChannel &chan) {
-                                chan.removeSeventvEmote(data);
+                        this->forEachSeventvUser(
+                            data.userID, [data](TwitchChannel &chan) {
+                                chan.updateSeventvUser(data);
                             });
                     },
                     this);
             });
-        this->signalHolder.managedConnect(
-            seventvEventAPI->signals_.userUpdated, [this](const auto &data) {
-                // TODO: is it fine if this is called in non-gui-thread?
-                this->forEachSeventvUser(data.userID,
-                                         [data](TwitchChannel &chan) {
-                                             chan.updateSeventvUser(data);
-                                         });
-            });
     }
     else
     {
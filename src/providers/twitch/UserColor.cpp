@@ -16,14 +16,11 @@ std::optional<MessageColor> getUserColor(const GetUserColorParams &params)
     {
         if (!params.userID.isEmpty())
         {
-            if (const auto &oUser =
-                    params.userDataController->getUser(params.userID))
+            if (auto color =
+                    params.userDataController->getUserColor(params.userID);
+                color && color->isValid())
             {
-                const auto &user = *oUser;
-                if (user.color && user.color->isValid())
-                {
-                    return {*user.color};
-                }
+                return {*color};
             }
         }
     }
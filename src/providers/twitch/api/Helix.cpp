@@ -12,6 +12,7 @@
 #include "common/QLogging.hpp"
 #include "util/CancellationToken.hpp"
 #include "util/QMagicEnum.hpp"
+#include "util/Twitch.hpp"
 
 #include <magic_enum/magic_enum.hpp>
 #include <QJsonDocument>
@@ -46,6 +47,57 @@ HelixChatters::HelixChatters(const QJsonObject &jsonObject)
     }
 }
 
+Helix::Helix()
+    : usersByLogin(
+          [this](QStringList logins, auto onSuccess, auto onFailure) {
+              this->fetchUsers(
+                  {}, std::move(logins),
+                  [this, onSuccess](const std::vector<HelixUser> &users) {
+                      for (const auto &user : users)
+                      {
+                          this->usersById.prime(user);
+                      }
+                      onSuccess(users);
+                  },
+                  std::move(onFailure));
+          },
+          [](const HelixUser &user) {
+              return user.login;
+          },
+          {
+              .caseInsensitive = true,
+              .isValidKey =
+                  [](const QString &login) {
+                      return twitchUserNameRegexp().match(login).hasMatch();
+                  },
+          })
+    , usersById(
+          [this](QStringList ids, auto onSuccess, auto onFailure) {
+              this->fetchUsers(
+                  std::move(ids), {},
+                  [this, onSuccess](const std::vector<HelixUser> &users) {
+                      for (const auto &user : users)
+                      {
+                          this->usersByLogin.prime(user);
+                      }
+                      onSuccess(users);
+                  },
+                  std::move(onFailure));
+          },
+          [](const HelixUser &user) {
+              return user.id;
+          },
+          {
+              .isValidKey =
+                  [](const QString &id) {
+                      bool ok = false;
+                      id.toULongLong(&ok);
+                      return ok;
+                  },
+          })
+{
+}
+
 void Helix::fetchUsers(QStringList userIds, QStringList userLogins,
                        ResultCallback<std::vector<HelixUser>> successCallback,
                        HelixFailureCallback failureCallback)
@@ -94,41 +146,16 @@ void Helix::getUserByName(QString userName,
                           ResultCallback<HelixUser> successCallback,
                           HelixFailureCallback failureCallback)
 {
-    QStringList userIds;
-    QStringList userLogins{std::move(userName)};
-
-    this->fetchUsers(
-        userIds, userLogins,
-        [successCallback,
-         failureCallback](const std::vector<HelixUser> &users) {
-            if (users.empty())
-            {
-                failureCallback();
-                return;
-            }
-            successCallback(users[0]);
-        },
-        failureCallback);
+    this->usersByLogin.get(userName, std::move(successCallback),
+                           std::move(failureCallback));
 }
 
 void Helix::getUserById(QString userId,
                         ResultCallback<HelixUser> successCallback,
                         HelixFailureCallback failureCallback)
 {
-    QStringList userIds{std::move(userId)};
-    QStringList userLogins;
-
-    this->fetchUsers(
-        userIds, userLogins,
-        [successCallback, failureCallback](const auto &users) {
-            if (users.empty())
-            {
-                failureCallback();
-                return;
-            }
-            successCallback(users[0]);
-        },
-        failureCallback);
+    this->usersById.get(userId, std::move(successCallback),
+                        std::move(failureCallback));
 }
 
 void Helix::getChannelFollowers(
@@ -6,6 +6,7 @@
 
 #include "common/Aliases.hpp"
 #include "common/network/NetworkRequest.hpp"
+#include "providers/twitch/api/HelixBatcher.hpp"
 #include "providers/twitch/eventsub/SubscriptionRequest.hpp"
 #include "providers/twitch/TwitchEmotes.hpp"
 #include "util/Helpers.hpp"
@@ -1400,6 +1401,8 @@ protected:
 class Helix final : public IHelix
 {
 public:
+    Helix();
+
     // https://dev.twitch.tv/docs/api/reference#get-users
     void fetchUsers(QStringList userIds, QStringList userLogins,
                     ResultCallback<std::vector<HelixUser>> successCallback,
@@ -1851,6 +1854,11 @@ private:
 
     QString clientId;
     QString oauthToken;
+
+    /// Single user lookups, batched and cached. Results of either batcher
+    /// are added to the cache of the other one.
+    HelixBatcher<HelixUser> usersByLogin;
+    HelixBatcher<HelixUser> usersById;
 };
 
 // initializeHelix sets the helix instance to _instance
@@ -0,0 +1,278 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "util/QStringHash.hpp"
+
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace chatterino {
+
+/// Collects single-key Helix lookups into batched requests
+///
+/// Lookups made within `window` of each other are sent as one request with
+/// up to `MAX_BATCH_SIZE` keys. Results are cached for `ttl` and shared by all
+/// callers. Callbacks are never called from within #get(), even if the
+/// result is cached.
+///
+/// Keys rejected by `isValidKey` fail on their own without being sent, since
+/// Twitch rejects the whole request if a single key is malformed. A failed
+/// batch is retried once after `retryDelay`. If that fails as well, all of its
+/// lookups fail.
+///
+/// This must only be used from the GUI thread.
+template <typename T>
+class HelixBatcher
+{
+public:
+    using SuccessCallback = std::function<void(const T &)>;
+    using FailureCallback = std::function<void()>;
+    /// Requests all `keys` at once. The results may be in any order and
+    /// don't have to contain every key.
+    using Fetch = std::function<void(QStringList keys,
+                                     std::function<void(std::vector<T>)>,
+                                     FailureCallback)>;
+    /// Returns the key a result is found by
+    using KeyOf = std::function<QString(const T &)>;
+
+    static constexpr qsizetype MAX_BATCH_SIZE = 100;
+    /// Expired entries are only dropped once the cache grows this large
+    static constexpr size_t MAX_CACHE_SIZE = 4096;
+
+    struct Options {
+        std::chrono::milliseconds window{50};
+        std::chrono::milliseconds ttl{std::chrono::minutes(5)};
+        std::chrono::milliseconds retryDelay{std::chrono::seconds(1)};
+        /// Compare keys case-insensitively (e.g. for logins)
+        bool caseInsensitive = false;
+        /// Returns false for keys Twitch would reject (e.g. malformed logins)
+        std::function<bool(const QString &)> isValidKey;
+    };
+
+    HelixBatcher(Fetch fetch, KeyOf keyOf, Options options)
+        : state_(std::make_shared<State>())
+    {
+        this->state_->fetch = std::move(fetch);
+        this->state_->keyOf = std::move(keyOf);
+        this->state_->options = options;
+    }
+
+    HelixBatcher(Fetch fetch, KeyOf keyOf)
+        : HelixBatcher(std::move(fetch), std::move(keyOf), Options{})
+    {
+    }
+
+    /// Looks up `key` and calls exactly one of the callbacks with the result
+    void get(const QString &key, SuccessCallback onSuccess,
+             FailureCallback onFailure)
+    {
+        auto &state = *this->state_;
+        if (key.isEmpty() ||
+            (state.options.isValidKey && !state.options.isValidKey(key)))
+        {
+            QTimer::singleShot(0, std::move(onFailure));
+            return;
+        }
+
+        auto normalized = state.normalize(key);
+
+        if (const auto *cached = state.cached(normalized))
+        {
+            QTimer::singleShot(0, [onSuccess = std::move(onSuccess),
+                                   value = *cached] {
+                onSuccess(value);
+            });
+            return;
+        }
+
+        auto &waiters = state.pending[normalized];
+        if (waiters.empty())
+        {
+            state.order.push_back(normalized);
+        }
+        waiters.push_back({std::move(onSuccess), std::move(onFailure)});
+
+        if (!state.flushScheduled)
+        {
+            state.flushScheduled = true;
+            QTimer::singleShot(state.options.window,
+                               [weak = std::weak_ptr(this->state_)] {
+                                   if (auto state = weak.lock())
+                                   {
+                                       State::flush(state);
+                                   }
+                               });
+        }
+    }
+
+    /// Sends all pending lookups now instead of waiting for the window to end
+    void flush()
+    {
+        State::flush(this->state_);
+    }
+
+    /// Adds a result that was loaded elsewhere to the cache
+    void prime(const T &value)
+    {
+        auto &state = *this->state_;
+        state.store(state.normalize(state.keyOf(value)), value);
+    }
+
+    /// Number of keys waiting to be sent
+    size_t pendingCount() const
+    {
+        return this->state_->order.size();
+    }
+
+private:
+    struct Waiter {
+        SuccessCallback onSuccess;
+        FailureCallback onFailure;
+    };
+
+    struct CacheEntry {
+        T value;
+        std::chrono::steady_clock::time_point expiresAt;
+    };
+
+    struct State {
+        Fetch fetch;
+        KeyOf keyOf;
+        Options options;
+
+        /// Keys waiting to be sent, in the order they were requested
+        QStringList order;
+        std::unordered_map<QString, std::vector<Waiter>> pending;
+        std::unordered_map<QString, CacheEntry> cache;
+        bool flushScheduled = false;
+
+        QString normalize(const QString &key) const
+        {
+            return this->options.caseInsensitive ? key.toLower() : key;
+        }
+
+        const T *cached(const QString &key)
+        {
+            auto it = this->cache.find(key);
+            if (it == this->cache.end())
+            {
+                return nullptr;
+            }
+            if (it->second.expiresAt <= std::chrono::steady_clock::now())
+            {
+                this->cache.erase(it);
+                return nullptr;
+            }
+            return &it->second.value;
+        }
+
+        void store(const QString &key, const T &value)
+        {
+            if (this->options.ttl.count() <= 0)
+            {
+                return;
+            }
+            auto now = std::chrono::steady_clock::now();
+            if (this->cache.size() >= MAX_CACHE_SIZE)
+            {
+                std::erase_if(this->cache, [&](const auto &entry) {
+                    return entry.second.expiresAt <= now;
+                });
+            }
+            this->cache.insert_or_assign(
+                key, CacheEntry{value, now + this->options.ttl});
+        }
+
+        using Batch = std::unordered_map<QString, std::vector<Waiter>>;
+
+        static void flush(const std::shared_ptr<State> &self)
+        {
+            self->flushScheduled = false;
+            while (!self->order.isEmpty())
+            {
+                auto keys = self->order.mid(0, MAX_BATCH_SIZE);
+                self->order = self->order.mid(keys.size());
+
+                auto batch = std::make_shared<Batch>();
+                for (const auto &key : keys)
+                {
+                    auto it = self->pending.find(key);
+                    batch->emplace(key, std::move(it->second));
+                    self->pending.erase(it);
+                }
+                send(self, std::move(keys), std::move(batch), false);
+            }
+        }
+
+        static void failAll(Batch &batch)
+        {
+            for (const auto &[key, waiters] : batch)
+            {
+                for (const auto &waiter : waiters)
+                {
+                    waiter.onFailure();
+                }
+            }
+            batch.clear();
+        }
+
+        static void send(const std::shared_ptr<State> &self, QStringList keys,
+                         std::shared_ptr<Batch> batch, bool isRetry)
+        {
+            self->fetch(
+                keys,
+                [self, batch](std::vector<T> results) {
+                    for (const auto &result : results)
+                    {
+                        auto key = self->normalize(self->keyOf(result));
+                        self->store(key, result);
+
+                        auto it = batch->find(key);
+                        if (it == batch->end())
+                        {
+                            continue;
+                        }
+                        for (const auto &waiter : it->second)
+                        {
+                            waiter.onSuccess(result);
+                        }
+                        batch->erase(it);
+                    }
+
+                    // Twitch omits keys it doesn't know
+                    failAll(*batch);
+                },
+                [self, batch, keys, isRetry] {
+                    if (isRetry)
+                    {
+                        failAll(*batch);
+                        return;
+                    }
+
+                    QTimer::singleShot(
+                        self->options.retryDelay,
+                        [weak = std::weak_ptr(self), keys, batch] {
+                            if (auto self = weak.lock())
+                            {
+                                send(self, keys, batch, true);
+                            }
+                        });
+                });
+        }
+    };
+
+    std::shared_ptr<State> state_;
+};
+
+}  // namespace chatterino
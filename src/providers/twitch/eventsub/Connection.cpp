@@ -74,6 +74,11 @@ void Connection::onNotification(const lib::messages::Metadata &metadata,
                                 const boost::json::value &jv)
 {
     (void)metadata;
+    if (!LOG().isDebugEnabled())
+    {
+        // don't serialize the payload just to throw it away
+        return;
+    }
     auto jsonString = boost::json::serialize(jv);
     qCDebug(LOG) << "on notification: " << jsonString.c_str();
 }
@@ -14,6 +14,7 @@
 #include "controllers/moderationactions/ModerationAction.hpp"
 #include "controllers/nicknames/Nickname.hpp"
 #include "debug/Benchmark.hpp"
+#include "messages/PipelineSettings.hpp"
 #include "pajlada/settings/signalargs.hpp"
 #include "util/WindowsHelper.hpp"
 
@@ -189,6 +190,38 @@ Settings::Settings(const Args &args, const QString &settingsDirectory)
     initializeSignalVector(this->signalHolder, this->loggedChannelsSetting,
                            this->loggedChannels);
 
+    this->pipelineListener_.addSetting(this->usernameDisplayMode);
+    this->pipelineListener_.addSetting(this->colorizeNicknames);
+    this->pipelineListener_.addSetting(this->useCustomFfzModeratorBadges);
+    this->pipelineListener_.addSetting(this->useCustomFfzVipBadges);
+    this->pipelineListener_.addSetting(this->findAllUsernames);
+    this->pipelineListener_.addSetting(this->enableZeroWidthEmotes);
+    this->pipelineListener_.addSetting(this->stackBits);
+    this->pipelineListener_.addSetting(this->highlightInlineWhispers);
+
+    this->pipelineListener_.addSetting(this->stripReplyMention);
+    this->pipelineListener_.addSetting(this->hideReplyContext);
+    this->pipelineListener_.addSetting(this->autoSubToParticipatedThreads);
+
+    this->pipelineListener_.addSetting(this->similarityEnabled);
+    this->pipelineListener_.addSetting(this->colorSimilarDisabled);
+    this->pipelineListener_.addSetting(this->hideSimilar);
+    this->pipelineListener_.addSetting(this->hideSimilarBySameUser);
+    this->pipelineListener_.addSetting(this->hideSimilarMyself);
+    this->pipelineListener_.addSetting(this->shownSimilarTriggerHighlights);
+    this->pipelineListener_.addSetting(this->similarityPercentage);
+    this->pipelineListener_.addSetting(this->hideSimilarMaxDelay);
+    this->pipelineListener_.addSetting(this->hideSimilarMaxMessagesToCheck);
+
+    this->pipelineListener_.addSetting(this->logTimestampFormat);
+    this->pipelineListener_.addSetting(this->tryUseTwitchTimestamps);
+    this->pipelineListener_.addSetting(this->separatelyStoreStreamLogs);
+
+    this->pipelineListener_.setCB([this] {
+        this->publishPipelineSettings();
+    });
+    this->publishPipelineSettings();
+
     instance_ = this;
 
 #ifdef USEWINSDK
@@ -306,6 +339,17 @@ bool Settings::shouldSendHelixChat() const
     }
 }
 
+std::shared_ptr<const PipelineSettings> Settings::pipelineSettings() const
+{
+    return this->pipelineSettings_.get();
+}
+
+void Settings::publishPipelineSettings()
+{
+    this->pipelineSettings_.set(std::make_shared<const PipelineSettings>(
+        PipelineSettings::fromSettings(*this)));
+}
+
 float Settings::getClampedUiScale() const
 {
     return std::clamp(this->uiScale.getValue(), 0.2F, 10.F);
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "common/Atomic.hpp"
 #include "common/ChatterinoSetting.hpp"
 #include "common/enums/MessageOverflow.hpp"
 #include "common/LastMessageLineStyle.hpp"
@@ -39,6 +40,7 @@ using TimeoutButton = std::pair<QString, int>;
 namespace chatterino {
 
 class Args;
+struct PipelineSettings;
 
 #ifdef Q_OS_WIN32
 #    define DEFAULT_FONT_FAMILY "Segoe UI"
@@ -147,6 +149,11 @@ public:
     /// Returns true if chat messages should be sent over Helix
     bool shouldSendHelixChat() const;
 
+    /// Returns the current snapshot of the message pipeline's settings
+    ///
+    /// This can be called from any thread.
+    std::shared_ptr<const PipelineSettings> pipelineSettings() const;
+
     FloatSetting uiScale = {"/appearance/uiScale2", 1};
     BoolSetting windowTopMost = {"/appearance/windowAlwaysOnTop", false};
 
@@ -436,6 +443,8 @@ public:
     /// Links
     BoolSetting linksDoubleClickOnly = {"/links/doubleClickToOpen", false};
     BoolSetting linkInfoTooltip = {"/links/linkInfoTooltip", false};
+    /// Only load the link info once a link is hovered
+    BoolSetting linkInfoOnHover = {"/links/linkInfoOnHover", false};
     IntSetting thumbnailSize = {"/appearance/thumbnailSize", 0};
     IntSetting thumbnailSizeStream = {"/appearance/thumbnailSizeStream", 2};
     BoolSetting unshortLinks = {"/links/unshortLinks", false};
@@ -718,6 +727,13 @@ public:
         "/misc/scrollback/usercardLimit",
         1000,
     };
+    /// Number of messages kept in compressed form after they were removed
+    /// from a channel's buffer. They're shown when scrolling to the top of a
+    /// split and can be found through the search.
+    IntSetting scrollbackColdLimit = {
+        "/misc/scrollback/coldLimit",
+        0,
+    };
 
     EnumStringSetting<ChatSendProtocol> chatSendProtocol = {
         "/misc/chatSendProtocol", ChatSendProtocol::Default};
@@ -842,10 +858,14 @@ public:
 
 private:
     void updateModerationActions();
+    void publishPipelineSettings();
 
     std::unique_ptr<rapidjson::Document> snapshot_;
 
     pajlada::Signals::SignalHolder signalHolder;
+
+    Atomic<std::shared_ptr<const PipelineSettings>> pipelineSettings_;
+    pajlada::SettingListener pipelineListener_;
 };
 
 Settings *getSettings();
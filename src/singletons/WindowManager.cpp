@@ -8,6 +8,7 @@
 #include "common/Args.hpp"
 #include "common/QLogging.hpp"
 #include "debug/AssertInGuiThread.hpp"
+#include "debug/StartupProfiler.hpp"
 #include "messages/MessageElement.hpp"
 #include "providers/twitch/TwitchIrcServer.hpp"
 #include "singletons/Paths.hpp"
@@ -15,6 +16,7 @@
 #include "singletons/Theme.hpp"
 #include "util/CombinePath.hpp"
 #include "util/FilesystemHelpers.hpp"
+#include "util/QMagicEnum.hpp"
 #include "util/SignalListener.hpp"
 #include "widgets/AccountSwitchPopup.hpp"
 #include "widgets/dialogs/SettingsDialog.hpp"
@@ -34,6 +36,7 @@
 #include <QMessageBox>
 #include <QSaveFile>
 #include <QScreen>
+#include <QStringBuilder>
 
 #include <chrono>
 #include <optional>
@@ -851,6 +854,8 @@ void WindowManager::applyWindowLayout(const WindowLayout &layout)
     for (const auto &windowData : layout.windows_)
     {
         auto type = windowData.type_;
+        StartupProfiler::Phase phase(u"window (" %
+                                     qmagicenum::enumNameString(type) % u')');
 
         Window &window = this->createWindow(type, false);
 
@@ -8,6 +8,7 @@
 #include "common/QLogging.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageThread.hpp"
+#include "messages/PipelineSettings.hpp"
 #include "singletons/Paths.hpp"
 #include "singletons/Settings.hpp"
 
@@ -182,8 +183,10 @@ void LoggingChannel::openStreamLogFile(const QString &streamID)
 void LoggingChannel::addMessage(const MessagePtr &message,
                                 const QString &streamID)
 {
+    auto settings = PipelineSettings::current();
+
     QDateTime messageTimestamp;
-    if (getSettings()->tryUseTwitchTimestamps &&
+    if (settings->tryUseTwitchTimestamps &&
         !message->serverReceivedTime.isNull())
     {
         messageTimestamp = message->serverReceivedTime;
@@ -207,7 +210,7 @@ void LoggingChannel::addMessage(const MessagePtr &message,
         str.append("#" + message->channelName + " ");
     }
 
-    QString logTimestampFormat = getSettings()->logTimestampFormat;
+    const auto &logTimestampFormat = settings->logTimestampFormat;
     if (logTimestampFormat != "Disable")
     {
         str.append('[');
@@ -236,8 +239,8 @@ void LoggingChannel::addMessage(const MessagePtr &message,
     }
 
     if ((message->flags.has(MessageFlag::ReplyMessage) &&
-         getSettings()->stripReplyMention) &&
-        !getSettings()->hideReplyContext)
+         settings->stripReplyMention) &&
+        !settings->hideReplyContext)
     {
         qsizetype colonIndex = messageText.indexOf(':');
         if (colonIndex != -1)
@@ -261,7 +264,7 @@ void LoggingChannel::addMessage(const MessagePtr &message,
 
     appendLine(this->fileHandle, str);
 
-    if (!streamID.isEmpty() && getSettings()->separatelyStoreStreamLogs)
+    if (!streamID.isEmpty() && settings->separatelyStoreStreamLogs)
     {
         if (this->currentStreamID != streamID)
         {
@@ -14,10 +14,11 @@ namespace chatterino {
 
 std::optional<EmotePtr> BadgeRegistry::getBadge(const UserId &id) const
 {
-    std::shared_lock lock(this->mutex_);
+    const auto &shard = this->shardFor(id);
+    std::shared_lock lock(shard.mutex);
 
-    auto it = this->badgeMap_.find(id.string);
-    if (it != this->badgeMap_.end())
+    auto it = shard.badges.find(id.string);
+    if (it != shard.badges.end())
     {
         return it->second;
     }
@@ -27,24 +28,32 @@ std::optional<EmotePtr> BadgeRegistry::getBadge(const UserId &id) const
 void BadgeRegistry::assignBadgeToUser(const QString &badgeID,
                                       const UserId &userID)
 {
-    const std::unique_lock lock(this->mutex_);
-
-    const auto badgeIt = this->knownBadges_.find(badgeID);
-    if (badgeIt != this->knownBadges_.end())
+    EmotePtr badge;
     {
-        this->badgeMap_[userID.string] = badgeIt->second;
+        std::shared_lock lock(this->knownBadgesMutex_);
+        const auto badgeIt = this->knownBadges_.find(badgeID);
+        if (badgeIt == this->knownBadges_.end())
+        {
+            return;
+        }
+        badge = badgeIt->second;
     }
+
+    auto &shard = this->shardFor(userID);
+    const std::unique_lock lock(shard.mutex);
+    shard.badges[userID.string] = std::move(badge);
 }
 
 void BadgeRegistry::clearBadgeFromUser(const QString &badgeID,
                                        const UserId &userID)
 {
-    const std::unique_lock lock(this->mutex_);
+    auto &shard = this->shardFor(userID);
+    const std::unique_lock lock(shard.mutex);
 
-    const auto it = this->badgeMap_.find(userID.string);
-    if (it != this->badgeMap_.end() && it->second->id.string == badgeID)
+    const auto it = shard.badges.find(userID.string);
+    if (it != shard.badges.end() && it->second->id.string == badgeID)
     {
-        this->badgeMap_.erase(userID.string);
+        shard.badges.erase(it);
     }
 }
 
@@ -52,7 +61,7 @@ QString BadgeRegistry::registerBadge(const QJsonObject &badgeJson)
 {
     const auto badgeID = this->idForBadge(badgeJson);
 
-    const std::unique_lock lock(this->mutex_);
+    const std::unique_lock lock(this->knownBadgesMutex_);
 
     if (this->knownBadges_.contains(badgeID))
     {
@@ -69,4 +78,19 @@ QString BadgeRegistry::registerBadge(const QJsonObject &badgeJson)
     return badgeID;
 }
 
+size_t BadgeRegistry::shardIndex(const QString &userID)
+{
+    return qHash(userID) % SHARD_COUNT;
+}
+
+const BadgeRegistry::Shard &BadgeRegistry::shardFor(const UserId &userID) const
+{
+    return this->shards_[shardIndex(userID.string)];
+}
+
+BadgeRegistry::Shard &BadgeRegistry::shardFor(const UserId &userID)
+{
+    return this->shards_[shardIndex(userID.string)];
+}
+
 }  // namespace chatterino
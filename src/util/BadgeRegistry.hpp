@@ -8,7 +8,11 @@
 
 #include <QJsonObject>
 
+#include <array>
+#include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 
 namespace chatterino {
 
@@ -21,6 +25,8 @@ public:
     virtual ~BadgeRegistry() = default;
 
     /// Return the badge, if any, that is assigned to the user
+    ///
+    /// This only locks the shard of the user for reading.
     std::optional<EmotePtr> getBadge(const UserId &id) const;
 
     /// Assign the given badge to the user
@@ -42,13 +48,31 @@ protected:
                                  const QJsonObject &badgeJson) const = 0;
 
 private:
-    /// Mutex for both `badgeMap_` and `knownBadges_`
-    mutable std::shared_mutex mutex_;
+    using BadgeMap = std::unordered_map<QString, EmotePtr>;
 
-    /// user-id => badge
-    std::unordered_map<QString, EmotePtr> badgeMap_;
+    static constexpr size_t SHARD_COUNT = 32;
+
+    /// user-id => badge for some of the users
+    ///
+    /// Updates come in bursts (e.g. 7TV entitlements when joining a channel),
+    /// so they're applied in place. Splitting the users into shards keeps
+    /// lookups from waiting for updates of unrelated users.
+    struct Shard {
+        mutable std::shared_mutex mutex;
+        BadgeMap badges;
+    };
+
+    static size_t shardIndex(const QString &userID);
+
+    const Shard &shardFor(const UserId &userID) const;
+    Shard &shardFor(const UserId &userID);
+
+    std::array<Shard, SHARD_COUNT> shards_;
+
+    /// Mutex for `knownBadges_`
+    mutable std::shared_mutex knownBadgesMutex_;
     /// badge-id => badge
-    std::unordered_map<QString, EmotePtr> knownBadges_;
+    BadgeMap knownBadges_;
 };
 
 }  // namespace chatterino
@@ -13,6 +13,24 @@
 
 namespace chatterino {
 
+/// Number of recent messages checked when stacking timeouts and clears
+inline constexpr size_t TIMEOUT_STACK_WINDOW = 20;
+
+/// Disables `message` if it was sent by `timeoutUser`
+inline void disableTimedOutMessage(const MessagePtr &message,
+                                   const QString &timeoutUser)
+{
+    if (message->loginName == timeoutUser &&
+        message->flags.hasNone(
+            {MessageFlag::ModerationAction, MessageFlag::Whisper}))
+    {
+        // FOURTF: disabled for now
+        // PAJLADA: Shitty solution described in Message.hpp
+        message->flags.set(MessageFlag::Disabled);
+        message->flags.set(MessageFlag::InvalidReplyTarget);
+    }
+}
+
 /// Adds a timeout or replaces a previous one sent in the last 20 messages and in the last 5s.
 /// This function accepts any buffer to store the messsages in.
 /// @param replaceMessage A function of type `void (int index, MessagePtr toReplace, MessagePtr replacement)`
@@ -32,7 +50,8 @@ void addOrReplaceChannelTimeout(const Buf &buffer, MessagePtr message,
 
     auto snapshotLength = static_cast<qsizetype>(buffer.size());
 
-    auto end = std::max<qsizetype>(0, snapshotLength - 20);
+    auto end = std::max<qsizetype>(
+        0, snapshotLength - static_cast<qsizetype>(TIMEOUT_STACK_WINDOW));
 
     bool shouldAddMessage = true;
 
@@ -116,16 +135,7 @@ void addOrReplaceChannelTimeout(const Buf &buffer, MessagePtr message,
     {
         for (qsizetype i = 0; i < snapshotLength; i++)
         {
-            auto &s = buffer[i];
-            if (s->loginName == message->timeoutUser &&
-                s->flags.hasNone(
-                    {MessageFlag::ModerationAction, MessageFlag::Whisper}))
-            {
-                // FOURTF: disabled for now
-                // PAJLADA: Shitty solution described in Message.hpp
-                s->flags.set(MessageFlag::Disabled);
-                s->flags.set(MessageFlag::InvalidReplyTarget);
-            }
+            disableTimedOutMessage(buffer[i], message->timeoutUser);
         }
     }
 
@@ -151,7 +161,8 @@ void addOrReplaceChannelClear(const Buffer &buffer, MessagePtr message,
     // This has never worked before, but would be nice in the future.
     // For this to work, we need to make sure *all* messages have a "server received time".
     auto snapshotLength = static_cast<qsizetype>(buffer.size());
-    auto end = std::max<qsizetype>(0, snapshotLength - 20);
+    auto end = std::max<qsizetype>(
+        0, snapshotLength - static_cast<qsizetype>(TIMEOUT_STACK_WINDOW));
     bool shouldAddMessage = true;
     QDateTime minimumTime = now.addSecs(-5);
     auto timeoutStackStyle = static_cast<TimeoutStackStyle>(
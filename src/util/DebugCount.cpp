@@ -66,6 +66,13 @@ void DebugCount::decrease(DebugObject target, int64_t amount)
     it.value -= amount;
 }
 
+int64_t DebugCount::get(DebugObject target)
+{
+    auto counts = COUNTS.access();
+
+    return counts->at(static_cast<size_t>(target)).value;
+}
+
 QString DebugCount::getDebugText()
 {
     static const QLocale locale(QLocale::English);
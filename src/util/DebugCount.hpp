@@ -26,6 +26,9 @@ enum class DebugObject : size_t {
     // http/other networking
     HTTPRequestStarted,
     HTTPRequestSuccess,
+    HTTPRequestQueued,
+    HTTPRequestInFlight,
+    HTTPRequestCoalesced,
     NetworkData,
 
     // images
@@ -45,6 +48,7 @@ enum class DebugObject : size_t {
     LuaHTTPRequest,
 
     // Messages
+    MessageArenaBlock,
     MessageDrawingBuffer,
     MessageElement,
     MessageLayout,
@@ -72,6 +76,8 @@ public:
         DebugCount::decrease(target, 1);
     }
 
+    static int64_t get(DebugObject target);
+
     static QString getDebugText();
 };
 
@@ -109,6 +115,12 @@ constexpr magic_enum::customize::customize_t
             return "http requests started";
         case chatterino::DebugObject::HTTPRequestSuccess:
             return "http requests succeeded";
+        case chatterino::DebugObject::HTTPRequestQueued:
+            return "http requests queued";
+        case chatterino::DebugObject::HTTPRequestInFlight:
+            return "http requests in flight";
+        case chatterino::DebugObject::HTTPRequestCoalesced:
+            return "http requests coalesced";
         case chatterino::DebugObject::Image:
             return "images";
         case chatterino::DebugObject::LoadedImage:
@@ -129,6 +141,8 @@ constexpr magic_enum::customize::customize_t
             return "lua::api::HTTPResponse";
         case chatterino::DebugObject::LuaHTTPRequest:
             return "lua::api::HTTPRequest";
+        case chatterino::DebugObject::MessageArenaBlock:
+            return "message arena blocks";
         case chatterino::DebugObject::MessageDrawingBuffer:
             return "message drawing buffers";
     }
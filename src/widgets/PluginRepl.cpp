@@ -537,6 +537,14 @@ void PluginRepl::tryRun(QString code)
 
     this->log({}, u"> "_s + code);
 
+    if (code == u":stats")
+    {
+        this->log(lua::api::LogLevel::Info,
+                  u"Message handlers: "_s +
+                      this->plugin->messageHandlerStats.toString());
+        return;
+    }
+
     bool addedReturn = false;
     size_t maxItems = 10;
 
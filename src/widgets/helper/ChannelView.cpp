@@ -73,6 +73,7 @@
 #include <chrono>
 #include <cmath>
 #include <functional>
+#include <iterator>
 #include <memory>
 
 namespace {
@@ -83,6 +84,11 @@ using namespace chatterino;
 
 constexpr int SCROLLBAR_PADDING = 8;
 
+/// How long a view has to be hidden before it drops its message layouts
+constexpr std::chrono::seconds DORMANCY_DELAY{30};
+/// Number of older messages laid out at once when leaving dormancy
+constexpr size_t MATERIALIZE_CHUNK_SIZE = 100;
+
 void addEmoteContextMenuItems(QMenu *menu, const Emote &emote, QStringView kind)
 {
     auto *openAction = menu->addAction("&Open");
@@ -353,6 +359,12 @@ ChannelView::ChannelView(InternalCtor /*tag*/, QWidget *parent, Split *split,
         this->scrollUpdateRequested();
     });
 
+    this->dormancyTimer_.setSingleShot(true);
+    this->dormancyTimer_.setInterval(DORMANCY_DELAY);
+    QObject::connect(&this->dormancyTimer_, &QTimer::timeout, this, [this] {
+        this->enterDormancy();
+    });
+
     this->grabGesture(Qt::PanGesture);
 
     // TODO: Figure out if we need this, and if so, why
@@ -387,6 +399,10 @@ void ChannelView::initializeLayout()
 
     QObject::connect(this->goToBottom_, &Button::leftClicked, this, [this] {
         QTimer::singleShot(180, this, [this] {
+            if (!this->history_.empty())
+            {
+                this->leaveHistory();
+            }
             this->scrollBar_->scrollToBottom(
                 getSettings()->enableSmoothScrollingNewMessages.getValue());
         });
@@ -400,8 +416,10 @@ void ChannelView::initializeScrollbar()
     std::ignore = this->scrollBar_->getCurrentValueChanged().connect([this] {
         if (this->isVisible())
         {
+            // performLayout marks the parts of the view that changed
             this->performLayout(true);
-            this->queueUpdate();
+            this->update();
+            this->queueHistoryUpdate();
         }
         else
         {
@@ -415,12 +433,12 @@ void ChannelView::initializeSignals()
     this->signalHolder_.managedConnect(getApp()->getWindows()->wordFlagsChanged,
                                        [this] {
                                            this->queueLayout();
-                                           this->update();
+                                           this->queueUpdate();
                                        });
 
     getSettings()->showLastMessageIndicator.connect(
         [this](auto, auto) {
-            this->update();
+            this->queueUpdate();
         },
         this->signalHolder_);
 
@@ -439,6 +457,7 @@ void ChannelView::initializeSignals()
                  this->underlyingChannel_.get() == channel))
             {
                 this->queueLayout();
+                this->queueUpdate();
             }
         });
 
@@ -517,7 +536,7 @@ void ChannelView::pause(PauseReason reason, std::optional<uint> msecs)
 
     if (wasUnpaused)
     {
-        this->update();
+        this->queueUpdate();
     }
 }
 
@@ -548,7 +567,7 @@ void ChannelView::updatePauses()
 
         this->queueLayout();
         // make sure we re-render
-        this->update();
+        this->queueUpdate();
     }
     else if (std::any_of(this->pauses_.begin(), this->pauses_.end(),
                          [](auto &&value) {
@@ -622,6 +641,8 @@ void ChannelView::scaleChangedEvent(float scale)
 {
     BaseWidget::scaleChangedEvent(scale);
 
+    this->backing_ = {};
+
     if (this->goToBottom_)
     {
         auto factor = this->scale();
@@ -637,11 +658,13 @@ void ChannelView::scaleChangedEvent(float scale)
 
 void ChannelView::queueUpdate()
 {
+    this->backingDirty_ = this->rect();
     this->update();
 }
 
 void ChannelView::queueUpdate(const QRect &area)
 {
+    this->backingDirty_ += area;
     this->update(area);
 }
 
@@ -649,7 +672,7 @@ void ChannelView::invalidateBuffers()
 {
     this->bufferInvalidationQueued_ = true;
     this->queueLayout();
-    this->update();
+    this->queueUpdate();
 }
 
 void ChannelView::queueLayout()
@@ -666,6 +689,12 @@ void ChannelView::queueLayout()
 
 void ChannelView::showEvent(QShowEvent * /*event*/)
 {
+    this->dormancyTimer_.stop();
+    if (this->dormant_)
+    {
+        this->leaveDormancy(false);
+    }
+
     if (this->layoutQueued_)
     {
         this->performLayout(false, true);
@@ -702,7 +731,7 @@ void ChannelView::layoutVisibleMessages(
     const auto start = size_t(this->scrollBar_->getRelativeCurrentValue());
     const auto layoutWidth = this->getLayoutWidth();
     const auto flags = this->getFlags();
-    auto redrawRequired = false;
+    QRegion redrawArea;
 
     if (messages.size() > start)
     {
@@ -712,8 +741,9 @@ void ChannelView::layoutVisibleMessages(
         for (auto i = start; i < messages.size() && y <= this->height(); i++)
         {
             const auto &message = messages[i];
+            const auto oldHeight = message->getHeight();
 
-            redrawRequired |= message->layout(
+            bool changed = message->layout(
                 {
                     .messageColors = this->messageColors_,
                     .flags = flags,
@@ -724,14 +754,111 @@ void ChannelView::layoutVisibleMessages(
                 },
                 this->bufferInvalidationQueued_);
 
+            if (changed)
+            {
+                // Messages below this one move if its height changed
+                auto top = static_cast<int>(std::floor(y));
+                auto bottom = message->getHeight() == oldHeight
+                                  ? static_cast<int>(std::ceil(
+                                        y + message->getHeight()))
+                                  : this->height();
+                redrawArea += QRect(0, top, this->width(), bottom - top);
+            }
+
             y += message->getHeight();
         }
         this->bufferInvalidationQueued_ = false;
     }
 
-    if (redrawRequired)
+    this->scrollBacking(messages);
+
+    if (!redrawArea.isEmpty())
+    {
+        this->queueUpdate(redrawArea.boundingRect());
+    }
+}
+
+void ChannelView::scrollBacking(const std::vector<MessageLayoutPtr> &messages)
+{
+    auto oldPositions = std::exchange(this->backingPositions_, {});
+
+    const auto start = size_t(this->scrollBar_->getRelativeCurrentValue());
+    if (start >= messages.size())
+    {
+        return;
+    }
+
+    auto y = -static_cast<int>(
+        messages[start]->getHeight() *
+        (fmod(this->scrollBar_->getRelativeCurrentValue(), 1)));
+    for (auto i = start; i < messages.size() && y <= this->height(); i++)
+    {
+        this->backingPositions_.emplace_back(messages[i], y);
+        y += messages[i]->getHeight();
+    }
+
+    if (this->backing_.isNull())
+    {
+        return;
+    }
+
+    // Messages keep their order, so the old positions are searched from
+    // the last match onwards. The first message that was visible before
+    // determines how far the backing is scrolled.
+    std::optional<int> dy;
+    std::optional<int> firstMoved;
+    auto oldIt = oldPositions.begin();
+    for (const auto &[layout, newY] : this->backingPositions_)
+    {
+        auto it = std::find_if(oldIt, oldPositions.end(), [&](const auto &p) {
+            return p.first == layout;
+        });
+        if (it != oldPositions.end())
+        {
+            oldIt = std::next(it);
+            if (!dy)
+            {
+                dy = newY - it->second;
+            }
+            if (newY - it->second == *dy)
+            {
+                continue;
+            }
+        }
+        if (!firstMoved)
+        {
+            firstMoved = newY;
+        }
+    }
+
+    const auto dpr = this->backing_.devicePixelRatioF();
+    if (!dy || std::abs(*dy) >= this->height() ||
+        std::fmod(*dy * dpr, 1.0) != 0)
     {
         this->queueUpdate();
+        return;
+    }
+
+    if (*dy != 0)
+    {
+        this->backing_.scroll(0, static_cast<int>(*dy * dpr),
+                              this->backing_.rect());
+        this->backingDirty_.translate(0, *dy);
+        this->backingDirty_ +=
+            *dy < 0 ? QRect(0, this->height() + *dy, this->width(), -*dy)
+                    : QRect(0, 0, this->width(), *dy);
+        this->animationArea_ =
+            this->animationArea_.translated(0, *dy).intersected(this->rect());
+        this->update();
+    }
+
+    if (firstMoved)
+    {
+        // New, replaced or resized messages - everything below them might
+        // have changed
+        auto top = std::max(*firstMoved, 0);
+        this->queueUpdate(
+            QRect(0, top, this->width(), this->height() - top));
     }
 }
 
@@ -803,12 +930,17 @@ void ChannelView::clearMessages()
 {
     // Clear all stored messages in this chat widget
     this->messages_.clear();
+    this->pendingMaterialization_.clear();
+    this->history_.clear();
+    this->historyStart_ = 0;
+    this->historyExhausted_ = false;
+    this->dormantAnchor_.reset();
     this->scrollBar_->clearHighlights();
     this->scrollBar_->resetBounds();
     this->scrollBar_->setMaximum(0);
     this->scrollBar_->setMinimum(0);
     this->queueLayout();
-    this->update();
+    this->queueUpdate();
 
     this->lastMessageHasAlternateBackground_ = false;
     this->lastMessageHasAlternateBackgroundReverse_ = true;
@@ -905,7 +1037,15 @@ std::vector<MessageLayoutPtr> &ChannelView::getMessagesSnapshot()
     this->snapshotGuard_.guard();
     if (!this->paused() /*|| this->scrollBar_->isVisible()*/)
     {
-        this->snapshot_ = this->messages_.getSnapshot();
+        // Only copy the layouts if they changed since the last snapshot. The
+        // epoch is read first, so a concurrent modification results in
+        // another copy next time rather than a stale snapshot.
+        auto epoch = this->messages_.epoch();
+        if (epoch != this->snapshotEpoch_)
+        {
+            this->snapshot_ = this->messages_.getSnapshot();
+            this->snapshotEpoch_ = epoch;
+        }
     }
 
     return this->snapshot_;
@@ -1008,6 +1148,13 @@ void ChannelView::setChannel(const ChannelPtr &underlyingChannel)
                                                  this->clearMessages();
                                              });
 
+    // The messages are shared with the underlying channel, so they only need
+    // to be painted again
+    this->channelConnections_.managedConnect(
+        underlyingChannel->messagesDisabled, [this] {
+            this->queueUpdate();
+        });
+
     // Copy over messages from the backing channel to the filtered one
     // and the ui.
     auto snapshot = underlyingChannel->getMessageSnapshot();
@@ -1063,6 +1210,13 @@ void ChannelView::setChannel(const ChannelPtr &underlyingChannel)
     this->channelConnections_.managedConnect(
         this->channel_->messagesAddedAtStart,
         [this](std::vector<MessagePtr> &messages) {
+            if (!this->pendingMaterialization_.empty() ||
+                !this->history_.empty())
+            {
+                // These would end up after the pending or older messages
+                this->messagesUpdated();
+                return;
+            }
             this->messageAddedAtStart(messages);
         });
 
@@ -1094,6 +1248,13 @@ void ChannelView::setChannel(const ChannelPtr &underlyingChannel)
     }
     this->queueUpdate();
 
+    // Views in background tabs (e.g. restored from the window layout) are
+    // never shown, so they don't get a hide event either
+    if (!this->isVisible())
+    {
+        this->scheduleDormancy();
+    }
+
     // Notifications
     auto *twitchChannel =
         dynamic_cast<TwitchChannel *>(underlyingChannel.get());
@@ -1169,6 +1330,14 @@ void ChannelView::messageAppended(MessagePtr &message,
         messageFlags = &*overridingFlags;
     }
 
+    if (this->dormant_ || !this->history_.empty())
+    {
+        // The layout is created from channel_ once this view is shown or
+        // scrolled back to the newest messages
+        this->requestTabHighlight(*messageFlags);
+        return;
+    }
+
     auto messageRef = std::make_shared<MessageLayout>(message);
 
     if (this->lastMessageHasAlternateBackground_)
@@ -1210,23 +1379,7 @@ void ChannelView::messageAppended(MessagePtr &message,
         }
     }
 
-    if (!messageFlags->has(MessageFlag::DoNotTriggerNotification))
-    {
-        if ((messageFlags->has(MessageFlag::Highlighted) &&
-             messageFlags->has(MessageFlag::ShowInMentions) &&
-             !messageFlags->has(MessageFlag::Subscription) &&
-             (getSettings()->highlightMentions ||
-              this->channel_->getType() != Channel::Type::TwitchMentions)) ||
-            (this->channel_->getType() == Channel::Type::TwitchAutomod &&
-             getSettings()->enableAutomodHighlight))
-        {
-            this->tabHighlightRequested.invoke(HighlightState::Highlighted);
-        }
-        else
-        {
-            this->tabHighlightRequested.invoke(HighlightState::NewMessage);
-        }
-    }
+    this->requestTabHighlight(*messageFlags);
 
     if (this->showScrollbarHighlights())
     {
@@ -1236,8 +1389,36 @@ void ChannelView::messageAppended(MessagePtr &message,
     this->queueLayout();
 }
 
+void ChannelView::requestTabHighlight(const MessageFlags &flags)
+{
+    if (flags.has(MessageFlag::DoNotTriggerNotification))
+    {
+        return;
+    }
+
+    if ((flags.has(MessageFlag::Highlighted) &&
+         flags.has(MessageFlag::ShowInMentions) &&
+         !flags.has(MessageFlag::Subscription) &&
+         (getSettings()->highlightMentions ||
+          this->channel_->getType() != Channel::Type::TwitchMentions)) ||
+        (this->channel_->getType() == Channel::Type::TwitchAutomod &&
+         getSettings()->enableAutomodHighlight))
+    {
+        this->tabHighlightRequested.invoke(HighlightState::Highlighted);
+    }
+    else
+    {
+        this->tabHighlightRequested.invoke(HighlightState::NewMessage);
+    }
+}
+
 void ChannelView::messageAddedAtStart(std::vector<MessagePtr> &messages)
 {
+    if (this->dormant_)
+    {
+        return;
+    }
+
     std::vector<MessageLayoutPtr> messageRefs;
     messageRefs.resize(messages.size());
 
@@ -1262,7 +1443,11 @@ void ChannelView::messageAddedAtStart(std::vector<MessagePtr> &messages)
     auto addedMessages = this->messages_.pushFront(messageRefs);
     if (!addedMessages.empty())
     {
-        if (this->scrollBar_->isAtBottom())
+        // The maximum has to grow first, the offset would be clamped to the
+        // old one otherwise
+        bool atBottom = this->scrollBar_->isAtBottom();
+        this->scrollBar_->offsetMaximum(qreal(addedMessages.size()));
+        if (atBottom)
         {
             this->scrollBar_->scrollToBottom();
         }
@@ -1270,7 +1455,6 @@ void ChannelView::messageAddedAtStart(std::vector<MessagePtr> &messages)
         {
             this->scrollBar_->offset(qreal(addedMessages.size()));
         }
-        this->scrollBar_->offsetMaximum(qreal(addedMessages.size()));
     }
 
     if (this->showScrollbarHighlights())
@@ -1291,11 +1475,24 @@ void ChannelView::messageAddedAtStart(std::vector<MessagePtr> &messages)
 void ChannelView::messageReplaced(size_t hint, const MessagePtr &prev,
                                   const MessagePtr &replacement)
 {
+    if (this->dormant_)
+    {
+        // The anchor is found by pointer when we leave dormancy
+        if (this->dormantAnchor_ == prev)
+        {
+            this->dormantAnchor_ = replacement;
+        }
+        return;
+    }
+
     auto optItem = this->messages_.find(hint, [&](const auto &it) {
         return it->getMessagePtr() == prev;
     });
     if (!optItem)
     {
+        // The message might not have a layout yet
+        std::ranges::replace(this->pendingMaterialization_, prev, replacement);
+        std::ranges::replace(this->history_, prev, replacement);
         return;
     }
     const auto &[index, oldItem] = *optItem;
@@ -1316,24 +1513,45 @@ void ChannelView::messageReplaced(size_t hint, const MessagePtr &prev,
 
 void ChannelView::messagesUpdated()
 {
+    if (this->dormant_)
+    {
+        return;
+    }
+
     auto snapshot = this->channel_->getMessageSnapshot();
+    this->pendingMaterialization_.clear();
+    this->history_.clear();
+    this->historyStart_ = 0;
+    this->historyExhausted_ = false;
+    this->rebuildMessageLayouts(snapshot);
+}
 
+void ChannelView::rebuildMessageLayouts(std::span<const MessagePtr> messages)
+{
     this->messages_.clear();
     this->scrollBar_->clearHighlights();
     this->scrollBar_->resetBounds();
-    this->scrollBar_->setMaximum(qreal(snapshot.size()));
+    this->scrollBar_->setMaximum(qreal(messages.size()));
     this->scrollBar_->setMinimum(0);
     this->lastMessageHasAlternateBackground_ = false;
     this->lastMessageHasAlternateBackgroundReverse_ = true;
 
-    for (const auto &msg : snapshot)
+    for (const auto &msg : messages)
     {
-        auto messageLayout = std::make_shared<MessageLayout>(msg);
-
-        if (this->lastMessageHasAlternateBackground_)
+        // Keep the layout of the last read message, it's compared by pointer
+        MessageLayoutPtr messageLayout;
+        if (this->lastReadMessage_ &&
+            this->lastReadMessage_->getMessagePtr() == msg)
         {
-            messageLayout->flags.set(MessageLayoutFlag::AlternateBackground);
+            messageLayout = this->lastReadMessage_;
         }
+        else
+        {
+            messageLayout = std::make_shared<MessageLayout>(msg);
+        }
+
+        messageLayout->flags.set(MessageLayoutFlag::AlternateBackground,
+                                 this->lastMessageHasAlternateBackground_);
         this->lastMessageHasAlternateBackground_ =
             !this->lastMessageHasAlternateBackground_;
 
@@ -1352,6 +1570,280 @@ void ChannelView::messagesUpdated()
     this->queueLayout();
 }
 
+void ChannelView::enterDormancy()
+{
+    if (this->dormant_ || this->isVisible() || this->paused())
+    {
+        return;
+    }
+
+    // Remember where we were scrolled to
+    if (!this->showingLatestMessages_)
+    {
+        const auto &snapshot = this->getMessagesSnapshot();
+        auto index = size_t(this->scrollBar_->getRelativeCurrentValue());
+        if (index < snapshot.size())
+        {
+            this->dormantAnchor_ = snapshot[index]->getMessagePtr();
+        }
+    }
+
+    this->clearSelection();
+    this->highlightedMessage_ = nullptr;
+    this->messagesOnScreen_.clear();
+    this->messages_.clear();
+    this->snapshot_.clear();
+    this->pendingMaterialization_.clear();
+    this->history_.clear();
+    this->historyStart_ = 0;
+    this->historyExhausted_ = false;
+    this->scrollBar_->clearHighlights();
+    this->dormant_ = true;
+}
+
+void ChannelView::scheduleDormancy()
+{
+    // Popups and other special views are short-lived anyway
+    if (this->context_ != Context::None || !this->split_)
+    {
+        return;
+    }
+
+    this->dormancyTimer_.start();
+}
+
+void ChannelView::leaveDormancy(bool all)
+{
+    this->dormant_ = false;
+
+    auto snapshot = this->channel_->getMessageSnapshot();
+    auto anchorIt = snapshot.end();
+    if (this->dormantAnchor_)
+    {
+        auto found = std::ranges::find(snapshot.rbegin(), snapshot.rend(),
+                                       this->dormantAnchor_);
+        if (found != snapshot.rend())
+        {
+            anchorIt = std::prev(found.base());
+        }
+    }
+    auto anchor = size_t(anchorIt - snapshot.begin());
+
+    // Only lay out the messages around the anchor now, older ones follow in
+    // chunks once we're visible
+    size_t start = 0;
+    if (!all && anchor > MATERIALIZE_CHUNK_SIZE)
+    {
+        start = anchor - MATERIALIZE_CHUNK_SIZE;
+    }
+    this->pendingMaterialization_.assign(snapshot.begin(),
+                                         snapshot.begin() + start);
+    this->rebuildMessageLayouts(std::span(snapshot).subspan(start));
+
+    if (anchorIt != snapshot.end())
+    {
+        this->scrollBar_->setDesiredValue(qreal(anchor - start));
+    }
+    else
+    {
+        this->scrollBar_->scrollToBottom();
+    }
+    this->dormantAnchor_.reset();
+
+    if (!this->pendingMaterialization_.empty())
+    {
+        QTimer::singleShot(0, this, [this] {
+            this->materializeOlderMessages();
+        });
+    }
+}
+
+void ChannelView::materializeOlderMessages()
+{
+    if (this->dormant_ || this->pendingMaterialization_.empty())
+    {
+        return;
+    }
+
+    auto count =
+        std::min(MATERIALIZE_CHUNK_SIZE, this->pendingMaterialization_.size());
+    auto chunkStart = this->pendingMaterialization_.end() -
+                      static_cast<std::ptrdiff_t>(count);
+    std::vector<MessagePtr> chunk(chunkStart,
+                                  this->pendingMaterialization_.end());
+    this->pendingMaterialization_.erase(chunkStart,
+                                        this->pendingMaterialization_.end());
+    this->messageAddedAtStart(chunk);
+
+    if (!this->pendingMaterialization_.empty())
+    {
+        QTimer::singleShot(0, this, [this] {
+            this->materializeOlderMessages();
+        });
+    }
+}
+
+void ChannelView::queueHistoryUpdate()
+{
+    if (this->historyUpdateQueued_)
+    {
+        return;
+    }
+    this->historyUpdateQueued_ = true;
+
+    // The layouts can't be replaced while the scroll position changes
+    QTimer::singleShot(0, this, [this] {
+        this->historyUpdateQueued_ = false;
+        this->updateHistory();
+    });
+}
+
+void ChannelView::updateHistory()
+{
+    if (this->dormant_ || !this->underlyingChannel_ ||
+        !this->pendingMaterialization_.empty())
+    {
+        return;
+    }
+
+    if (this->scrollBar_->getRelativeCurrentValue() <= 0)
+    {
+        this->showOlderHistory();
+    }
+    else if (!this->history_.empty() && this->scrollBar_->isAtBottom())
+    {
+        this->showNewerHistory();
+    }
+}
+
+void ChannelView::showOlderHistory()
+{
+    bool entering = this->history_.empty();
+    if (entering && !this->underlyingChannel_->hasOlderMessages() &&
+        this->channel_->countMessages() <= this->messages_.size())
+    {
+        // All messages are laid out already
+        return;
+    }
+    if (entering)
+    {
+        // Start with what's laid out right now
+        this->history_ = this->channel_->getMessageSnapshot();
+        this->historyStart_ =
+            this->history_.size() -
+            std::min(this->history_.size(), this->messages_.size());
+        this->historyExhausted_ = false;
+    }
+
+    if (this->historyStart_ == 0 && !this->historyExhausted_)
+    {
+        QDateTime before;
+        for (const auto &message : this->history_)
+        {
+            if (message->serverReceivedTime.isValid())
+            {
+                before = message->serverReceivedTime;
+                break;
+            }
+        }
+
+        std::vector<MessagePtr> older;
+        // Without a time, we'd find the same messages again
+        if (entering || before.isValid())
+        {
+            older = this->underlyingChannel_->findOlderMessages(
+                [this](const MessagePtr &message) {
+                    return this->shouldIncludeMessage(message);
+                },
+                before, this->historyChunkSize());
+        }
+        this->historyExhausted_ = older.empty();
+        this->historyStart_ = older.size();
+        this->history_.insert(this->history_.begin(),
+                              std::make_move_iterator(older.begin()),
+                              std::make_move_iterator(older.end()));
+    }
+
+    if (this->historyStart_ == 0)
+    {
+        if (entering)
+        {
+            this->history_.clear();
+        }
+        return;
+    }
+
+    auto shift = std::min(this->historyChunkSize(), this->historyStart_);
+    this->historyStart_ -= shift;
+    this->showHistoryWindow(this->scrollBar_->getRelativeCurrentValue() +
+                            qreal(shift));
+}
+
+void ChannelView::showNewerHistory()
+{
+    auto end = this->historyStart_ + this->messages_.size();
+    if (end >= this->history_.size())
+    {
+        this->leaveHistory();
+        return;
+    }
+
+    auto shift =
+        std::min(this->historyChunkSize(), this->history_.size() - end);
+    this->historyStart_ += shift;
+    this->showHistoryWindow(std::max<qreal>(
+        0, this->scrollBar_->getRelativeCurrentValue() - qreal(shift)));
+}
+
+size_t ChannelView::historyChunkSize() const
+{
+    // The messages in view have to stay in the window when it moves
+    return std::max<size_t>(
+        1, std::min(MATERIALIZE_CHUNK_SIZE, this->messages_.limit() / 2));
+}
+
+void ChannelView::showHistoryWindow(qreal scrollValue)
+{
+    auto count = std::min(this->messages_.limit(),
+                          this->history_.size() - this->historyStart_);
+
+    // Selections refer to message indices, which changed
+    this->clearSelection();
+    this->rebuildMessageLayouts(
+        std::span(this->history_).subspan(this->historyStart_, count));
+    this->scrollBar_->setDesiredValue(scrollValue);
+}
+
+void ChannelView::leaveHistory()
+{
+    MessagePtr top;
+    auto index = this->historyStart_ +
+                 size_t(this->scrollBar_->getRelativeCurrentValue());
+    if (index < this->history_.size())
+    {
+        top = this->history_[index];
+    }
+    this->history_.clear();
+    this->historyStart_ = 0;
+    this->historyExhausted_ = false;
+
+    auto snapshot = this->channel_->getMessageSnapshot();
+    this->clearSelection();
+    this->rebuildMessageLayouts(snapshot);
+
+    auto it = std::ranges::find(snapshot, top);
+    auto skipped = snapshot.size() - this->messages_.size();
+    if (it != snapshot.end() && size_t(it - snapshot.begin()) >= skipped)
+    {
+        this->scrollBar_->setDesiredValue(
+            qreal(size_t(it - snapshot.begin()) - skipped));
+    }
+    else
+    {
+        this->scrollBar_->scrollToBottom();
+    }
+}
+
 void ChannelView::updateLastReadMessage()
 {
     if (auto lastMessage = this->messages_.last())
@@ -1359,7 +1851,7 @@ void ChannelView::updateLastReadMessage()
         this->lastReadMessage_ = *lastMessage;
     }
 
-    this->update();
+    this->queueUpdate();
 }
 
 void ChannelView::resizeEvent(QResizeEvent * /*event*/)
@@ -1374,7 +1866,7 @@ void ChannelView::resizeEvent(QResizeEvent * /*event*/)
 
     this->queueLayout();
 
-    this->update();
+    this->queueUpdate();
 }
 
 void ChannelView::setSelection(const Selection &newSelection)
@@ -1383,7 +1875,7 @@ void ChannelView::setSelection(const Selection &newSelection)
     {
         this->selection_ = newSelection;
         this->selectionChanged.invoke();
-        this->update();
+        this->queueUpdate();
     }
 }
 
@@ -1462,6 +1954,18 @@ bool ChannelView::scrollToMessage(const MessagePtr &message)
         return false;
     }
 
+    if (this->dormant_)
+    {
+        bool found = this->channel_->visitMessages([&](const auto &messages) {
+            return std::ranges::find(messages, message) != messages.end();
+        });
+        if (!found)
+        {
+            return false;
+        }
+        this->leaveDormancy(true);
+    }
+
     auto &messagesSnapshot = this->getMessagesSnapshot();
     if (messagesSnapshot.size() == 0)
     {
@@ -1498,6 +2002,11 @@ bool ChannelView::scrollToMessage(const MessagePtr &message)
 
 bool ChannelView::scrollToMessageId(const QString &messageId)
 {
+    if (this->dormant_)
+    {
+        this->leaveDormancy(true);
+    }
+
     auto &messagesSnapshot = this->getMessagesSnapshot();
     if (messagesSnapshot.size() == 0)
     {
@@ -1546,12 +2055,42 @@ void ChannelView::paintEvent(QPaintEvent *event)
 {
     //    BenchmarkGuard benchmark("paint");
 
-    QPainter painter(this);
+    const auto dpr = this->devicePixelRatioF();
+    const QSize backingSize(static_cast<int>(this->width() * dpr),
+                            static_cast<int>(this->height() * dpr));
+    if (this->backing_.size() != backingSize ||
+        this->backing_.devicePixelRatioF() != dpr)
+    {
+        this->backing_ = QPixmap(backingSize);
+        this->backing_.setDevicePixelRatio(dpr);
+        this->backingDirty_ = this->rect();
+    }
 
-    painter.fillRect(this->rect(), this->messageColors_.channelBackground);
+    const bool isWindowFocused =
+        this->window() == QApplication::activeWindow();
+    if (isWindowFocused != this->backingWindowFocused_)
+    {
+        this->backingWindowFocused_ = isWindowFocused;
+        this->backingDirty_ = this->rect();
+    }
 
     // draw messages
-    this->drawMessages(painter, event->rect());
+    auto dirty =
+        std::exchange(this->backingDirty_, {}).intersected(this->rect());
+    if (!dirty.isEmpty())
+    {
+        QPainter backingPainter(&this->backing_);
+        backingPainter.setClipRegion(dirty);
+        backingPainter.setCompositionMode(QPainter::CompositionMode_Source);
+        backingPainter.fillRect(this->rect(),
+                                this->messageColors_.channelBackground);
+        backingPainter.setCompositionMode(
+            QPainter::CompositionMode_SourceOver);
+        this->drawMessages(backingPainter, dirty.boundingRect());
+    }
+
+    QPainter painter(this);
+    painter.drawPixmap(0, 0, this->backing_);
 
     // draw paused sign
     if (this->paused())
@@ -1613,7 +2152,7 @@ void ChannelView::drawMessages(QPainter &painter, const QRect &area)
         .preferences = this->messagePreferences_,
 
         .canvasWidth = this->width(),
-        .isWindowFocused = this->window() == QApplication::activeWindow(),
+        .isWindowFocused = this->backingWindowFocused_,
         .isMentions = this->underlyingChannel_ ==
                       getApp()->getTwitch()->getMentionsChannel(),
 
@@ -1696,13 +2235,17 @@ void ChannelView::drawMessages(QPainter &painter, const QRect &area)
         }
     }
 
-    // Only update on a full repaint as some messages with animated elements
-    // might get left out in partial repaints.
-    // This happens for example when hovering over the go-to-bottom button.
+    // Only replace the area on a full repaint as some messages with animated
+    // elements might get left out in partial repaints.
+    // This happens for example when new messages are scrolled into view.
     if (this->height() <= area.height())
     {
         this->animationArea_ = animationArea;
     }
+    else if (!animationArea.isNull())
+    {
+        this->animationArea_ = this->animationArea_.united(animationArea);
+    }
 #ifdef FOURTF
     else
     {
@@ -2263,7 +2806,7 @@ void ChannelView::mousePressEvent(QMouseEvent *event)
         default:;
     }
 
-    this->update();
+    this->queueUpdate();
 }
 
 void ChannelView::mouseReleaseEvent(QMouseEvent *event)
@@ -2419,7 +2962,7 @@ void ChannelView::mouseReleaseEvent(QMouseEvent *event)
     // handle the click
     this->handleMouseClick(event, hoverLayoutElement, layout);
 
-    this->update();
+    this->queueUpdate();
 }
 
 void ChannelView::handleMouseClick(QMouseEvent *event,
@@ -3002,6 +3545,10 @@ void ChannelView::hideEvent(QHideEvent * /*event*/)
     }
 
     this->messagesOnScreen_.clear();
+    this->backing_ = {};
+    this->backingPositions_.clear();
+
+    this->scheduleDormancy();
 }
 
 void ChannelView::showUserInfoPopup(const QString &userName,
@@ -17,15 +17,24 @@
 #include <QGestureEvent>
 #include <QMenu>
 #include <QPaintEvent>
+#include <QPixmap>
 #include <QPointer>
+#include <QRegion>
 #include <QScroller>
 #include <QTimer>
 #include <QVariantAnimation>
 #include <QWheelEvent>
 #include <QWidget>
 
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
+
+#if __has_include(<gtest/gtest_prod.h>)
+#    include <gtest/gtest_prod.h>
+#endif
 
 namespace chatterino {
 enum class HighlightState;
@@ -101,7 +110,9 @@ public:
                          Context context = Context::None,
                          size_t messagesLimit = 1000);
 
+    /// Repaints the whole view
     void queueUpdate();
+    /// Repaints the messages in `area`
     void queueUpdate(const QRect &area);
     Scrollbar &getScrollBar();
 
@@ -287,9 +298,46 @@ private:
                          const MessagePtr &replacement);
     void messagesUpdated();
 
+    /// Replaces all message layouts with new ones for `messages`
+    void rebuildMessageLayouts(std::span<const MessagePtr> messages);
+    void requestTabHighlight(const MessageFlags &flags);
+
+    /// Drops all message layouts of this (hidden) view
+    ///
+    /// While dormant, only the tab highlight is tracked for new messages.
+    void enterDormancy();
+    /// Enters dormancy after a delay unless this view is shown until then
+    void scheduleDormancy();
+    /// Recreates the message layouts from `channel_`
+    ///
+    /// Messages from the restore position onwards are laid out right away.
+    /// Unless `all` is set, older messages are added in chunks afterwards.
+    void leaveDormancy(bool all);
+    void materializeOlderMessages();
+
+    /// Queues #updateHistory() after the scroll position changed
+    void queueHistoryUpdate();
+    /// Shows older messages from the underlying channel when scrolled to
+    /// the top and moves back to the newer ones when scrolled to the bottom
+    void updateHistory();
+    void showOlderHistory();
+    void showNewerHistory();
+    /// Number of messages the history window moves by at once
+    size_t historyChunkSize() const;
+    /// Lays out the part of #history_ starting at #historyStart_
+    void showHistoryWindow(qreal scrollValue);
+    /// Shows the messages of `channel_` again, keeping the message at the top
+    /// in view
+    void leaveHistory();
+
     void performLayout(bool causedByScrollbar = false,
                        bool causedByShow = false);
     void layoutVisibleMessages(const std::vector<MessageLayoutPtr> &messages);
+    /// Moves the contents of `backing_` along with the visible messages
+    ///
+    /// Only the rows that became visible and the messages that didn't move
+    /// with the rest are marked to be painted again.
+    void scrollBacking(const std::vector<MessageLayoutPtr> &messages);
     void updateScrollbar(const std::vector<MessageLayoutPtr> &messages,
                          bool causedByScrollbar, bool causedByShow);
 
@@ -335,6 +383,28 @@ private:
     bool layoutQueued_ = false;
     bool bufferInvalidationQueued_ = false;
 
+    /// True if this view is hidden and doesn't keep any message layouts
+    bool dormant_ = false;
+    /// Started when this view is hidden, makes it dormant once it fires
+    QTimer dormancyTimer_;
+    /// The message at the top of the view when it became dormant, unless it
+    /// was showing the latest messages
+    MessagePtr dormantAnchor_;
+    /// Messages (oldest first) that still need a layout after leaving
+    /// dormancy. They're prepended in chunks.
+    std::vector<MessagePtr> pendingMaterialization_;
+
+    /// While scrolled back past the start of `channel_`: the older messages
+    /// that were rebuilt (see Channel::findOlderMessages) followed by the
+    /// messages of `channel_` when we started scrolling back (oldest first).
+    /// Only up to `messages_.limit()` of them starting at #historyStart_ are
+    /// laid out. New messages aren't added until we're back at the bottom.
+    std::vector<MessagePtr> history_;
+    size_t historyStart_ = 0;
+    /// Set once no more older messages were found
+    bool historyExhausted_ = false;
+    bool historyUpdateQueued_ = false;
+
     bool lastMessageHasAlternateBackground_ = false;
     bool lastMessageHasAlternateBackgroundReverse_ = true;
 
@@ -342,6 +412,19 @@ private:
     /// If this is empty (QRect::isEmpty()), no animated element is shown.
     QRect animationArea_;
 
+    /// The background and messages as of the last paint
+    ///
+    /// Overlays like the paused sign are painted on top of this. When the
+    /// messages move (e.g. because a message was appended), this is
+    /// scrolled instead of painting all visible messages again.
+    QPixmap backing_;
+    /// The area of `backing_` that needs to be painted again
+    QRegion backingDirty_;
+    /// The visible messages and their y-position in `backing_`
+    std::vector<std::pair<MessageLayoutPtr, int>> backingPositions_;
+    /// Whether the window was focused when `backing_` was painted
+    bool backingWindowFocused_ = false;
+
     bool pausable_ = false;
     QTimer pauseTimer_;
     std::unordered_map<PauseReason, std::optional<SteadyClock::time_point>>
@@ -357,6 +440,8 @@ private:
 
     ThreadGuard snapshotGuard_;
     std::vector<MessageLayoutPtr> snapshot_;
+    /// The LimitedQueue::epoch of `messages_` when `snapshot_` was taken
+    uint64_t snapshotEpoch_ = 0;
 
     /// @brief The backing (internal) channel
     ///
@@ -464,6 +549,12 @@ private:
 
     /// Slot for the LinkInfo::stateChanged signal.
     void pendingLinkInfoStateChanged();
+
+#ifdef FRIEND_TEST
+    FRIEND_TEST(ChannelView, EntersDormancyWhenHidden);
+    FRIEND_TEST(ChannelView, TracksMessagesWhileDormant);
+    FRIEND_TEST(ChannelView, RestoresScrollPositionAfterDormancy);
+#endif
 };
 
 }  // namespace chatterino
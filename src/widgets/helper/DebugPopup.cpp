@@ -5,12 +5,14 @@
 #include "widgets/helper/DebugPopup.hpp"
 
 #include "common/Literals.hpp"
+#include "common/network/NetworkScheduler.hpp"
 #include "util/Clipboard.hpp"
 #include "util/DebugCount.hpp"
 
 #include <QFontDatabase>
 #include <QLabel>
 #include <QPushButton>
+#include <QStringBuilder>
 #include <QTimer>
 #include <QVBoxLayout>
 
@@ -18,6 +20,22 @@ namespace chatterino {
 
 using namespace literals;
 
+namespace {
+
+QString debugText()
+{
+    auto text = DebugCount::getDebugText();
+
+    auto networkQueues = network::detail::NetworkScheduler::debugText();
+    if (!networkQueues.isEmpty())
+    {
+        text += u"\nhttp queues:\n"_s % networkQueues;
+    }
+    return text;
+}
+
+}  // namespace
+
 DebugPopup::DebugPopup()
 {
     auto *layout = new QVBoxLayout(this);
@@ -26,10 +44,10 @@ DebugPopup::DebugPopup()
     auto *copyButton = new QPushButton(u"&Copy"_s);
 
     QObject::connect(timer, &QTimer::timeout, [text] {
-        text->setText(DebugCount::getDebugText());
+        text->setText(debugText());
     });
     timer->start(300);
-    text->setText(DebugCount::getDebugText());
+    text->setText(debugText());
 
     text->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
 
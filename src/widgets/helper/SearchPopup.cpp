@@ -27,6 +27,8 @@
 #include <QLineEdit>
 #include <QPushButton>
 
+#include <algorithm>
+
 namespace chatterino {
 
 ChannelPtr SearchPopup::filter(const QString &text, const QString &channelName,
@@ -76,6 +78,11 @@ SearchPopup::SearchPopup(QWidget *parent, Split *split)
           parent)
     , split_(split)
 {
+    this->searchTimer_.setSingleShot(true);
+    this->searchTimer_.setInterval(150);
+    QObject::connect(&this->searchTimer_, &QTimer::timeout, this,
+                     &SearchPopup::search);
+
     this->initLayout();
     if (this->split_ && this->split_->getChannelView().hasSelection())
     {
@@ -200,6 +207,7 @@ void SearchPopup::updateWindowTitle()
 
 void SearchPopup::showEvent(QShowEvent *e)
 {
+    this->searchTimer_.stop();
     this->search();
     BaseWindow::showEvent(e);
 }
@@ -233,8 +241,72 @@ void SearchPopup::search()
         this->snapshot_ = this->buildSnapshot();
     }
 
-    this->channelView_->setChannel(filter(this->searchInput_->text(),
-                                          this->channelName_, this->snapshot_));
+    auto messages = this->findOlderMessages(this->searchInput_->text());
+    if (messages.empty())
+    {
+        this->channelView_->setChannel(filter(
+            this->searchInput_->text(), this->channelName_, this->snapshot_));
+        return;
+    }
+
+    messages.insert(messages.end(), this->snapshot_.begin(),
+                    this->snapshot_.end());
+    this->channelView_->setChannel(
+        filter(this->searchInput_->text(), this->channelName_, messages));
+}
+
+std::vector<MessagePtr> SearchPopup::findOlderMessages(const QString &text)
+{
+    auto predicates = parsePredicates(text);
+    if (predicates.empty())
+    {
+        // Every older message would match, don't rebuild all of them
+        return {};
+    }
+
+    // Don't rebuild more messages than the results view can show
+    auto limit =
+        static_cast<size_t>(getSettings()->scrollbackSplitLimit.getValue());
+
+    std::vector<MessagePtr> older;
+    std::vector<Channel *> searched;
+    for (auto &channel : this->searchChannels_)
+    {
+        ChannelView &sharedView = channel.get();
+        auto underlyingChannel = sharedView.underlyingChannel();
+        if (std::ranges::find(searched, underlyingChannel.get()) !=
+            searched.end())
+        {
+            continue;
+        }
+        searched.push_back(underlyingChannel.get());
+
+        const FilterSetPtr filterSet = sharedView.getFilterSet();
+        auto found = underlyingChannel->findOlderMessages(
+            [&](const MessagePtr &message) {
+                for (const auto &pred : predicates)
+                {
+                    if (!pred->appliesTo(*message))
+                    {
+                        return false;
+                    }
+                }
+                return !filterSet ||
+                       filterSet->filter(message, underlyingChannel);
+            },
+            {}, limit);
+        older.insert(older.end(), std::make_move_iterator(found.begin()),
+                     std::make_move_iterator(found.end()));
+    }
+
+    if (searched.size() > 1)
+    {
+        std::ranges::stable_sort(older, {}, [](const MessagePtr &message) {
+            return message->serverReceivedTime;
+        });
+    }
+
+    return older;
 }
 
 std::vector<MessagePtr> SearchPopup::buildSnapshot()
@@ -252,19 +324,20 @@ std::vector<MessagePtr> SearchPopup::buildSnapshot()
         ChannelView &sharedView = channel.get();
 
         const FilterSetPtr filterSet = sharedView.getFilterSet();
-        std::vector<MessagePtr> snapshot =
-            sharedView.channel()->getMessageSnapshot();
+        auto underlyingChannel = sharedView.underlyingChannel();
 
-        for (const auto &message : snapshot)
-        {
-            if (filterSet &&
-                !filterSet->filter(message, sharedView.underlyingChannel()))
+        // Only the messages passing the filter are copied
+        sharedView.channel()->visitMessages([&](const auto &messages) {
+            for (const auto &message : messages)
             {
-                continue;
-            }
+                if (filterSet && !filterSet->filter(message, underlyingChannel))
+                {
+                    continue;
+                }
 
-            combinedSnapshot.push_back(message);
-        }
+                combinedSnapshot.push_back(message);
+            }
+        });
     }
 
     // remove any duplicate messages from splits containing the same channel
@@ -315,7 +388,9 @@ void SearchPopup::initLayout()
                 this->searchInput_->findChild<QAbstractButton *>()->setIcon(
                     QPixmap(":/buttons/clearSearch.png"));
                 QObject::connect(this->searchInput_, &QLineEdit::textChanged,
-                                 this, &SearchPopup::search);
+                                 this, [this] {
+                                     this->searchTimer_.start();
+                                 });
                 this->searchInput_->installEventFilter(this);
             }
 
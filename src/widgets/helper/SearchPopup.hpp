@@ -7,6 +7,8 @@
 #include "ForwardDecl.hpp"
 #include "widgets/BasePopup.hpp"
 
+#include <QTimer>
+
 #include <memory>
 
 class QLineEdit;
@@ -43,6 +45,14 @@ private:
     void addShortcuts() override;
     std::vector<MessagePtr> buildSnapshot();
 
+    /**
+     * @brief Finds messages matching the search query that were removed from
+     *        the searched channels (see Channel::findOlderMessages).
+     *
+     * @return the matching messages, oldest first
+     */
+    std::vector<MessagePtr> findOlderMessages(const QString &text);
+
     /**
      * @brief Only retains those message from a list of messages that satisfy a
      *        search query.
@@ -69,6 +79,9 @@ private:
         const QString &input);
 
     std::vector<MessagePtr> snapshot_;
+    /// Delays searching while the query is typed, since searching older
+    /// messages has to decompress them
+    QTimer searchTimer_;
     QLineEdit *searchInput_{};
     ChannelView *channelView_{};
     QString channelName_{};
@@ -785,6 +785,11 @@ void GeneralPage::initLayout(GeneralPageView &layout)
         "privacy-policy\">Privacy Policy</a>.");
 
     SettingWidget::checkbox("Enable", s.linkInfoTooltip)->addTo(layout);
+    SettingWidget::checkbox("Only load info when hovering a link",
+                            s.linkInfoOnHover)
+        ->setTooltip("Instead of loading the info for every link in chat, "
+                     "only load it once you hover a link.")
+        ->addTo(layout);
 
     layout.addDropdown<int>(
         "Also show thumbnails if available",
@@ -1535,6 +1540,21 @@ void GeneralPage::initLayout(GeneralPageView &layout)
                             })
         ->addTo(layout);
 
+    SettingWidget::intInput(
+        "Compressed history per channel (requires restart)",
+        s.scrollbackColdLimit,
+        {
+            .min = 0,
+            .max = 200000,
+            .singleStep = 1000,
+        })
+        ->setTooltip("Messages that don't fit into the split scrollback "
+                     "anymore are kept in a compressed form. They're shown "
+                     "when scrolling to the top of a split and can still be "
+                     "found through the search. They're shown without emotes "
+                     "and badges. Set to 0 to disable.")
+        ->addTo(layout);
+
     SettingWidget::dropdown("Show blocked term automod messages",
                             s.showBlockedTermAutomodMessages)
         ->setTooltip("Show messages that are blocked by AutoMod for containing "
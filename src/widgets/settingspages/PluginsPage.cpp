@@ -194,6 +194,18 @@ void PluginsPage::rebuildContent()
         }
         pluginEntry->addRow("Commands",
                             new QLabel(commandsTxt, this->dataFrame_));
+
+        const auto &stats = plugin->messageHandlerStats;
+        if (stats.calls != 0 || stats.droppedBatches != 0)
+        {
+            auto *statsLabel = new QLabel(stats.toString(), this->dataFrame_);
+            statsLabel->setWordWrap(true);
+            if (stats.budgetExceeded != 0)
+            {
+                statsLabel->setStyleSheet("color: #f00");
+            }
+            pluginEntry->addRow("Message handlers", statsLabel);
+        }
         if (!plugin->meta.permissions.empty())
         {
             QString perms = "<ul>";
@@ -9,6 +9,7 @@
 #include "common/QLogging.hpp"
 #include "common/WindowDescriptors.hpp"
 #include "debug/AssertInGuiThread.hpp"
+#include "debug/StartupProfiler.hpp"
 #include "singletons/Fonts.hpp"
 #include "singletons/Theme.hpp"
 #include "singletons/WindowManager.hpp"
@@ -27,6 +28,7 @@
 #include <QMimeData>
 #include <QPainter>
 #include <QPainterPath>
+#include <QStringBuilder>
 
 #include <algorithm>
 
@@ -907,6 +909,7 @@ void SplitContainer::applyFromDescriptorRecursively(
             return;
         }
         const auto &splitNode = *n;
+        StartupProfiler::Phase phase(u"split " % splitNode.channelName_);
 
         auto *split = new Split(this);
         split->setChannel(WindowManager::decodeChannel(splitNode));
@@ -944,6 +947,8 @@ void SplitContainer::applyFromDescriptorRecursively(
                     return;
                 }
                 const auto &splitNode = *inner;
+                StartupProfiler::Phase phase(u"split " %
+                                             splitNode.channelName_);
                 auto *split = new Split(this);
                 split->setFilters(splitNode.filters_);
                 split->setChannel(WindowManager::decodeChannel(splitNode));
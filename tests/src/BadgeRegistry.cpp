@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "util/BadgeRegistry.hpp"
+
+#include "common/Literals.hpp"
+#include "messages/Emote.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "providers/bttv/BttvBadges.hpp"
+#include "Test.hpp"
+
+#include <QJsonObject>
+
+#include <atomic>
+#include <thread>
+
+using namespace chatterino;
+using namespace literals;
+
+TEST(BadgeRegistry, AssignAndClear)
+{
+    mock::BaseApplication app;
+    BttvBadges badges;
+
+    const auto first =
+        badges.registerBadge({{"url", "https://cdn.betterttv.net/a.svg"}});
+    const auto second =
+        badges.registerBadge({{"url", "https://cdn.betterttv.net/b.svg"}});
+    ASSERT_EQ(first, "https://cdn.betterttv.net/a.svg");
+
+    // unknown badges aren't assigned
+    badges.assignBadgeToUser("https://cdn.betterttv.net/c.svg", {"1"});
+    ASSERT_FALSE(badges.getBadge({"1"}).has_value());
+
+    for (int i = 0; i < 100; i++)
+    {
+        badges.assignBadgeToUser(i % 2 == 0 ? first : second,
+                                 {QString::number(i)});
+    }
+    for (int i = 0; i < 100; i++)
+    {
+        auto badge = badges.getBadge({QString::number(i)});
+        ASSERT_TRUE(badge.has_value());
+        ASSERT_EQ((*badge)->id.string, i % 2 == 0 ? first : second);
+    }
+
+    auto before = badges.getBadge({"2"});
+
+    // only clears the badge if it's the assigned one
+    badges.clearBadgeFromUser(second, {"2"});
+    ASSERT_TRUE(badges.getBadge({"2"}).has_value());
+
+    badges.clearBadgeFromUser(first, {"2"});
+    ASSERT_FALSE(badges.getBadge({"2"}).has_value());
+    ASSERT_TRUE(badges.getBadge({"4"}).has_value());
+
+    // badges that were already looked up stay valid
+    ASSERT_TRUE(before.has_value());
+    ASSERT_EQ((*before)->id.string, first);
+}
+
+TEST(BadgeRegistry, Burst)
+{
+    mock::BaseApplication app;
+    BttvBadges badges;
+
+    std::vector<QString> badgeIDs;
+    for (int i = 0; i < 10; i++)
+    {
+        badgeIDs.push_back(badges.registerBadge(
+            {{"url", u"https://cdn.betterttv.net/%1.svg"_s.arg(i)}}));
+    }
+
+    auto badgeFor = [&](int user) {
+        return badgeIDs[static_cast<size_t>(user) % badgeIDs.size()];
+    };
+
+    // Joining a big channel can assign badges to tens of thousands of users
+    // while messages are being built
+    constexpr int USERS = 50000;
+    std::atomic<bool> done = false;
+    std::thread reader([&] {
+        while (!done)
+        {
+            std::ignore = badges.getBadge({"42"});
+        }
+    });
+    for (int i = 0; i < USERS; i++)
+    {
+        badges.assignBadgeToUser(badgeFor(i), {QString::number(i)});
+    }
+    for (int i = 0; i < USERS; i += 2)
+    {
+        badges.clearBadgeFromUser(badgeFor(i), {QString::number(i)});
+    }
+    done = true;
+    reader.join();
+
+    for (int i = 0; i < USERS; i++)
+    {
+        auto badge = badges.getBadge({QString::number(i)});
+        ASSERT_EQ(badge.has_value(), i % 2 == 1);
+        if (badge)
+        {
+            ASSERT_EQ((*badge)->id.string, badgeFor(i));
+        }
+    }
+}
@@ -0,0 +1,308 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "widgets/helper/ChannelView.hpp"
+
+#include "common/Channel.hpp"
+#include "controllers/accounts/AccountController.hpp"
+#include "controllers/commands/CommandController.hpp"
+#include "controllers/hotkeys/HotkeyController.hpp"
+#include "messages/MessageBuilder.hpp"
+#include "messages/MessageElement.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "mocks/EmoteController.hpp"
+#include "singletons/Settings.hpp"
+#include "singletons/WindowManager.hpp"
+#include "Test.hpp"
+
+#include <QApplication>
+#include <QDateTime>
+#include <QImage>
+
+using namespace chatterino;
+
+namespace {
+
+class MockApplication : public mock::BaseApplication
+{
+public:
+    MockApplication()
+        : windowManager(this->args, this->paths_, this->settings, this->theme,
+                        this->fonts)
+        , commands(this->paths_)
+    {
+    }
+
+    HotkeyController *getHotkeys() override
+    {
+        return &this->hotkeys;
+    }
+
+    WindowManager *getWindows() override
+    {
+        return &this->windowManager;
+    }
+
+    AccountController *getAccounts() override
+    {
+        return &this->accounts;
+    }
+
+    CommandController *getCommands() override
+    {
+        return &this->commands;
+    }
+
+    EmoteController *getEmotes() override
+    {
+        return &this->emotes;
+    }
+
+    HotkeyController hotkeys;
+    WindowManager windowManager;
+    AccountController accounts;
+    CommandController commands;
+    mock::EmoteController emotes;
+};
+
+MessagePtr makeMessage(const QString &text)
+{
+    MessageBuilder builder;
+    builder.emplace<TextElement>(text, MessageElementFlag::Text,
+                                 MessageColor::Text);
+    return builder.release();
+}
+
+MessagePtr makeMessage(size_t i)
+{
+    MessageBuilder builder;
+    builder->id = QString::number(i);
+    builder->serverReceivedTime =
+        QDateTime::fromMSecsSinceEpoch(1700000000000 + qint64(i) * 1000);
+    builder->messageText = builder->id;
+    builder.emplace<TextElement>(builder->id, MessageElementFlag::Text,
+                                 MessageColor::Text);
+    return builder.release();
+}
+
+QString firstShownId(ChannelView &view)
+{
+    return view.getMessagesSnapshot().front()->getMessage()->id;
+}
+
+QImage paint(ChannelView &view)
+{
+    QApplication::processEvents();
+    return view.grab().toImage();
+}
+
+}  // namespace
+
+TEST(ChannelView, RepaintsDisabledMessages)
+{
+    MockApplication app;
+
+    auto channel = std::make_shared<Channel>("forsen", Channel::Type::Misc);
+    channel->addMessage(makeMessage("first"), MessageContext::Original);
+
+    ChannelView view(nullptr);
+    view.setChannel(channel);
+    view.resize(400, 300);
+    view.show();
+    paint(view);
+
+    // Appending scrolls the painted backing and only paints the new message
+    channel->addMessage(makeMessage("second"), MessageContext::Original);
+    auto before = paint(view);
+
+    channel->disableAllMessages();
+    auto after = paint(view);
+
+    ASSERT_NE(before, after);
+}
+
+TEST(ChannelView, ScrollsIntoOlderMessages)
+{
+    MockApplication app;
+    app.settings.scrollbackSplitLimit.setValue(100);
+    app.settings.scrollbackColdLimit.setValue(1000);
+
+    // The 200 oldest messages only remain in compressed form
+    auto channel = std::make_shared<Channel>("forsen", Channel::Type::Misc);
+    for (size_t i = 0; i < 300; i++)
+    {
+        channel->addMessage(makeMessage(i), MessageContext::Original);
+    }
+
+    ChannelView view(nullptr, ChannelView::Context::None, 100);
+    view.setChannel(channel);
+    view.resize(400, 300);
+    view.show();
+    paint(view);
+    ASSERT_EQ(firstShownId(view), "200");
+
+    // The window of laid out messages moves by half of the limit
+    view.getScrollBar().scrollToTop();
+    paint(view);
+    ASSERT_EQ(firstShownId(view), "150");
+
+    view.getScrollBar().scrollToTop();
+    paint(view);
+    ASSERT_EQ(firstShownId(view), "100");
+
+    // New messages are only shown once we're back at the newest messages
+    channel->addMessage(makeMessage(300), MessageContext::Original);
+    ASSERT_EQ(firstShownId(view), "100");
+
+    view.getScrollBar().scrollToBottom();
+    paint(view);
+    ASSERT_EQ(firstShownId(view), "150");
+
+    view.getScrollBar().scrollToBottom();
+    paint(view);
+    ASSERT_EQ(firstShownId(view), "200");
+
+    view.getScrollBar().scrollToBottom();
+    paint(view);
+    ASSERT_EQ(firstShownId(view), "201");
+}
+
+TEST(ChannelView, EntersDormancyWhenHidden)
+{
+    MockApplication app;
+
+    auto channel = std::make_shared<Channel>("forsen", Channel::Type::Misc);
+    for (size_t i = 0; i < 10; i++)
+    {
+        channel->addMessage(makeMessage(i), MessageContext::Original);
+    }
+
+    ChannelView view(nullptr);
+    view.setChannel(channel);
+    view.resize(400, 300);
+    view.show();
+    paint(view);
+
+    // Visible views keep their layouts
+    view.enterDormancy();
+    ASSERT_FALSE(view.dormant_);
+    ASSERT_EQ(view.getMessagesSnapshot().size(), 10);
+
+    // The dormancy timer fires while the view is hidden
+    view.hide();
+    view.dormancyTimer_.start(0);
+    QApplication::processEvents();
+    ASSERT_TRUE(view.dormant_);
+    ASSERT_TRUE(view.getMessagesSnapshot().empty());
+
+    view.show();
+    ASSERT_FALSE(view.dormant_);
+    ASSERT_EQ(view.getMessagesSnapshot().size(), 10);
+
+    // Showing the view again before the timer fires keeps the layouts
+    view.hide();
+    view.dormancyTimer_.start(0);
+    view.show();
+    QApplication::processEvents();
+    ASSERT_FALSE(view.dormant_);
+    ASSERT_EQ(view.getMessagesSnapshot().size(), 10);
+}
+
+TEST(ChannelView, TracksMessagesWhileDormant)
+{
+    MockApplication app;
+
+    auto channel = std::make_shared<Channel>("forsen", Channel::Type::Misc);
+    std::vector<MessagePtr> messages;
+    for (size_t i = 0; i < 10; i++)
+    {
+        messages.push_back(makeMessage(i));
+        channel->addMessage(messages.back(), MessageContext::Original);
+    }
+
+    ChannelView view(nullptr);
+    view.setChannel(channel);
+    view.resize(400, 300);
+    view.show();
+    paint(view);
+
+    size_t highlights = 0;
+    std::ignore = view.tabHighlightRequested.connect([&](auto) {
+        highlights++;
+    });
+
+    view.hide();
+    view.enterDormancy();
+    ASSERT_TRUE(view.dormant_);
+
+    // Only the tab highlight is updated, no layouts are created
+    channel->addMessage(makeMessage(10), MessageContext::Original);
+    auto replacement = makeMessage(42);
+    channel->replaceMessage(messages[3], replacement);
+    ASSERT_EQ(highlights, 1);
+    ASSERT_TRUE(view.getMessagesSnapshot().empty());
+
+    view.show();
+    const auto &snapshot = view.getMessagesSnapshot();
+    ASSERT_EQ(snapshot.size(), 11);
+    ASSERT_EQ(snapshot[3]->getMessagePtr(), replacement);
+    ASSERT_EQ(snapshot.back()->getMessage()->id, "10");
+    ASSERT_TRUE(view.getScrollBar().isAtBottom());
+}
+
+TEST(ChannelView, RestoresScrollPositionAfterDormancy)
+{
+    MockApplication app;
+
+    auto channel = std::make_shared<Channel>("forsen", Channel::Type::Misc);
+    std::vector<MessagePtr> messages;
+    for (size_t i = 0; i < 300; i++)
+    {
+        messages.push_back(makeMessage(i));
+        channel->addMessage(messages.back(), MessageContext::Original);
+    }
+
+    ChannelView view(nullptr);
+    view.setChannel(channel);
+    view.resize(400, 300);
+    view.show();
+    paint(view);
+
+    auto shownAtTop = [&] {
+        auto &scrollBar = view.getScrollBar();
+        const auto &snapshot = view.getMessagesSnapshot();
+        return snapshot[size_t(scrollBar.getRelativeCurrentValue())]
+            ->getMessagePtr();
+    };
+
+    view.getScrollBar().setDesiredValue(250);
+    paint(view);
+    ASSERT_EQ(shownAtTop(), messages[250]);
+
+    view.hide();
+    view.enterDormancy();
+    ASSERT_TRUE(view.dormant_);
+
+    // The message we were scrolled to is replaced and a new one arrives
+    auto replacement = makeMessage(250);
+    channel->replaceMessage(messages[250], replacement);
+    channel->addMessage(makeMessage(300), MessageContext::Original);
+
+    // Only the messages from 100 before the anchor are laid out right away
+    view.show();
+    ASSERT_EQ(firstShownId(view), "150");
+    ASSERT_EQ(view.pendingMaterialization_.size(), 150);
+    ASSERT_EQ(shownAtTop(), replacement);
+    ASSERT_FALSE(view.getScrollBar().isAtBottom());
+
+    // The older ones are prepended in chunks without moving the view
+    for (int i = 0; i < 10 && !view.pendingMaterialization_.empty(); i++)
+    {
+        QApplication::processEvents();
+    }
+    ASSERT_TRUE(view.pendingMaterialization_.empty());
+    ASSERT_EQ(firstShownId(view), "0");
+    ASSERT_EQ(view.getMessagesSnapshot().size(), 301);
+    ASSERT_EQ(shownAtTop(), replacement);
+}
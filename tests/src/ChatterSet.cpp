@@ -89,3 +89,43 @@ TEST(ChatterSet, MaxSizeLastUsed)
     EXPECT_TRUE(set.contains("pajlada"));
     EXPECT_TRUE(set.contains("Pajlada"));
 }
+
+TEST(ChatterSet, Prefix)
+{
+    ChatterSet set;
+
+    set.addRecentChatter("pajlada");
+    set.addRecentChatter("Pajbot");
+    set.addRecentChatter("forsen");
+    set.addRecentChatter("PAJAW");
+
+    using Items = std::vector<std::pair<QString, QString>>;
+
+    // Most recent chatters come first
+    EXPECT_EQ(set.allWithPrefix("paj"), (Items{
+                                            {"pajaw", "PAJAW"},
+                                            {"pajbot", "Pajbot"},
+                                            {"pajlada", "pajlada"},
+                                        }));
+    EXPECT_EQ(set.filterByPrefix("PAJB"), std::vector<QString>{"Pajbot"});
+    EXPECT_TRUE(set.filterByPrefix("x").empty());
+    EXPECT_EQ(set.filterByPrefix("").size(), 4);
+
+    set.addRecentChatter("pajlada");
+    EXPECT_EQ(set.filterByPrefix("paj"),
+              (std::vector<QString>{"pajlada", "PAJAW", "Pajbot"}));
+
+    // Evicted chatters are removed from the index
+    for (size_t i = 0; i < ChatterSet::CHATTER_LIMIT - 1; ++i)
+    {
+        set.addRecentChatter(QString("user%1").arg(i));
+    }
+    EXPECT_EQ(set.filterByPrefix("paj"), std::vector<QString>{"pajlada"});
+    EXPECT_EQ(set.filterByPrefix("").size(), ChatterSet::CHATTER_LIMIT);
+
+    set.updateOnlineChatters({"pajlada", "user1", "newuser"});
+    EXPECT_EQ(set.filterByPrefix("paj"), std::vector<QString>{"pajlada"});
+    EXPECT_EQ(set.filterByPrefix("user"), std::vector<QString>{"user1"});
+    EXPECT_EQ(set.filterByPrefix("new"), std::vector<QString>{"newuser"});
+    EXPECT_TRUE(set.filterByPrefix("forsen").empty());
+}
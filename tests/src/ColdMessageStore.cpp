@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/ColdMessageStore.hpp"
+
+#include "messages/Message.hpp"
+#include "messages/MessageBuilder.hpp"
+#include "messages/MessageElement.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "Test.hpp"
+
+#include <QStringBuilder>
+
+using namespace chatterino;
+
+namespace {
+
+const QDateTime START = QDateTime::fromMSecsSinceEpoch(1700000000000);
+
+MessagePtr makeMessage(size_t i, const QByteArray &ircData = {})
+{
+    MessageBuilder builder;
+    builder->flags.set(MessageFlag::Highlighted);
+    builder->serverReceivedTime = START.addSecs(static_cast<qint64>(i));
+    builder->id = QString::number(i);
+    builder->loginName = "forsen";
+    builder->displayName = "Forsen";
+    builder->userID = "22484632";
+    builder->channelName = "pajlada";
+    builder->messageText = u"message " % QString::number(i);
+    builder->searchText = u"forsen: message " % QString::number(i);
+    builder->usernameColor = QColor(255, 0, 0);
+    builder->highlightColor = std::make_shared<QColor>(0, 0, 255, 100);
+    builder->ircData = ircData;
+    return builder.release();
+}
+
+bool all(const MessagePtr & /*message*/)
+{
+    return true;
+}
+
+}  // namespace
+
+TEST(ColdMessageStore, RoundTrip)
+{
+    mock::BaseApplication app;
+
+    ColdMessageStore store(1000);
+    for (size_t i = 0; i < ColdMessageStore::BLOCK_SIZE + 10; i++)
+    {
+        store.push(*makeMessage(i));
+    }
+    ASSERT_EQ(store.size(), ColdMessageStore::BLOCK_SIZE + 10);
+    ASSERT_EQ(store.compressedSize(), ColdMessageStore::BLOCK_SIZE);
+
+    auto rebuilt = store.find(all);
+    ASSERT_EQ(rebuilt.size(), store.size());
+
+    // from the compressed block and from the open one
+    for (size_t i : {size_t{0}, size_t{42}, ColdMessageStore::BLOCK_SIZE + 5})
+    {
+        auto expected = makeMessage(i);
+        const auto &message = rebuilt[i];
+        ASSERT_EQ(message->flags, expected->flags);
+        ASSERT_EQ(message->serverReceivedTime, expected->serverReceivedTime);
+        ASSERT_EQ(message->id, expected->id);
+        ASSERT_EQ(message->loginName, expected->loginName);
+        ASSERT_EQ(message->displayName, expected->displayName);
+        ASSERT_EQ(message->userID, expected->userID);
+        ASSERT_EQ(message->channelName, expected->channelName);
+        ASSERT_EQ(message->messageText, expected->messageText);
+        ASSERT_EQ(message->searchText, expected->searchText);
+        ASSERT_EQ(message->usernameColor, expected->usernameColor);
+        ASSERT_NE(message->highlightColor, nullptr);
+        ASSERT_EQ(*message->highlightColor, *expected->highlightColor);
+        // timestamp, username and text
+        ASSERT_EQ(message->elements.size(), 3);
+    }
+}
+
+TEST(ColdMessageStore, Predicate)
+{
+    mock::BaseApplication app;
+
+    ColdMessageStore store(1000);
+    for (size_t i = 0; i < 300; i++)
+    {
+        store.push(*makeMessage(i));
+    }
+
+    auto found = store.find([](const MessagePtr &message) {
+        return message->messageText.endsWith(u'7');
+    });
+    ASSERT_EQ(found.size(), 30);
+    ASSERT_EQ(found.front()->id, "7");
+    ASSERT_EQ(found.back()->id, "297");
+}
+
+TEST(ColdMessageStore, Limit)
+{
+    mock::BaseApplication app;
+
+    ColdMessageStore store(ColdMessageStore::BLOCK_SIZE * 2);
+    for (size_t i = 0; i < ColdMessageStore::BLOCK_SIZE * 4; i++)
+    {
+        store.push(*makeMessage(i));
+    }
+
+    // the oldest blocks were dropped
+    ASSERT_EQ(store.size(), ColdMessageStore::BLOCK_SIZE * 2);
+    auto rebuilt = store.find(all);
+    ASSERT_EQ(rebuilt.front()->id,
+              QString::number(ColdMessageStore::BLOCK_SIZE * 2));
+
+    store.clear();
+    ASSERT_EQ(store.size(), 0);
+
+    ColdMessageStore disabled(0);
+    disabled.push(*makeMessage(0));
+    ASSERT_EQ(disabled.size(), 0);
+}
+
+TEST(ColdMessageStore, BeforeAndLimit)
+{
+    mock::BaseApplication app;
+
+    ColdMessageStore store(1000);
+    for (size_t i = 0; i < 600; i++)
+    {
+        store.push(*makeMessage(i));
+    }
+
+    size_t checked = 0;
+    auto found = store.find(
+        [&](const MessagePtr &message) {
+            checked++;
+            // only matching messages are rebuilt
+            EXPECT_TRUE(message->elements.empty());
+            return message->messageText.endsWith(u'0');
+        },
+        START.addSecs(500), 5);
+
+    // the newest matches before the time, oldest first
+    ASSERT_EQ(found.size(), 5);
+    ASSERT_EQ(found.front()->id, "450");
+    ASSERT_EQ(found.back()->id, "490");
+    ASSERT_EQ(found.front()->elements.size(), 3);
+
+    // older blocks weren't searched once enough messages were found
+    ASSERT_EQ(checked, 50);
+}
+
+TEST(ColdMessageStore, RebuildFromIrc)
+{
+    mock::BaseApplication app;
+
+    std::vector<QByteArray> rebuilt;
+    auto rebuild = [&](const QByteArray &ircData) -> MessagePtr {
+        rebuilt.push_back(ircData);
+        if (ircData.startsWith("ignored"))
+        {
+            return nullptr;
+        }
+        MessageBuilder builder;
+        builder->messageText = QString::fromUtf8(ircData);
+        builder.emplace<TextElement>(builder->messageText,
+                                     MessageElementFlag::Text);
+        return builder.release();
+    };
+    ColdMessageStore store(1000, rebuild);
+
+    for (size_t i = 0; i < ColdMessageStore::BLOCK_SIZE + 3; i++)
+    {
+        QByteArray ircData;
+        if (i % 2 == 0)
+        {
+            ircData =
+                (i == 4 ? "ignored " : "PRIVMSG ") + QByteArray::number(i);
+        }
+        store.push(*makeMessage(i, ircData));
+    }
+    ASSERT_EQ(store.compressedSize(), ColdMessageStore::BLOCK_SIZE);
+
+    auto found = store.find(all);
+    ASSERT_EQ(found.size(), store.size());
+    ASSERT_EQ(rebuilt.size(), (store.size() + 1) / 2);
+
+    for (size_t i : {size_t{2}, ColdMessageStore::BLOCK_SIZE + 2})
+    {
+        // built by `rebuild`, but the stored flags are kept
+        ASSERT_EQ(found[i]->messageText, "PRIVMSG " + QString::number(i));
+        ASSERT_EQ(found[i]->elements.size(), 1);
+        ASSERT_EQ(found[i]->flags, makeMessage(i)->flags);
+    }
+
+    // without IRC data or if `rebuild` failed, only the stored fields are
+    // shown
+    for (size_t i : {size_t{3}, size_t{4}})
+    {
+        ASSERT_EQ(found[i]->messageText, makeMessage(i)->messageText);
+        ASSERT_EQ(found[i]->elements.size(), 3);
+    }
+}
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "controllers/emotes/EmoteSnapshot.hpp"
+
+#include "messages/Emote.hpp"
+#include "messages/Image.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "Test.hpp"
+
+#include <QString>
+
+using namespace chatterino;
+
+namespace {
+
+EmotePtr makeEmote(const QString &name, const QString &id)
+{
+    auto url = [&](const QString &scale) {
+        return Url{"https://cdn.example.com/emote/" + id + "/" + scale};
+    };
+    return std::make_shared<const Emote>(Emote{
+        .name = {name},
+        .images =
+            ImageSet{
+                Image::fromUrl(url("1x"), 1, {28, 28}),
+                Image::fromUrl(url("2x"), 0.5, {56, 56}),
+                getEmptyImagePtr(),
+            },
+        .tooltip = {name + "<br>Channel Emote"},
+        .homePage = {"https://example.com/emotes/" + id},
+        .id = {id},
+        .author = {"pajlada"},
+    });
+}
+
+EmoteMap makeMap()
+{
+    EmoteMap map;
+    map[{"Kappa"}] = makeEmote("Kappa", "1");
+    map[{"forsenE"}] = makeEmote("forsenE", "2");
+
+    auto zeroWidth = *makeEmote("cvHazmat", "3");
+    zeroWidth.zeroWidth = true;
+    map[{"cvHazmat"}] = std::make_shared<const Emote>(std::move(zeroWidth));
+
+    auto aliased = *makeEmote("Alias", "4");
+    aliased.baseName = EmoteName{"Original"};
+    map[{"Alias"}] = std::make_shared<const Emote>(std::move(aliased));
+    return map;
+}
+
+class EmoteSnapshotTest : public ::testing::Test
+{
+public:
+    mock::BaseApplication mockApplication;
+};
+
+}  // namespace
+
+TEST_F(EmoteSnapshotTest, RoundTrip)
+{
+    auto original = makeMap();
+
+    auto parsed = parseEmoteSnapshot(serializeEmoteSnapshot(original));
+    ASSERT_TRUE(parsed.has_value());
+    ASSERT_EQ(parsed->size(), original.size());
+
+    for (const auto &[name, emote] : original)
+    {
+        auto it = parsed->find(name);
+        ASSERT_NE(it, parsed->end()) << name.string;
+        const auto &restored = *it->second;
+
+        ASSERT_EQ(restored, *emote);
+        ASSERT_EQ(restored.zeroWidth, emote->zeroWidth);
+        ASSERT_EQ(restored.id, emote->id);
+        ASSERT_EQ(restored.author, emote->author);
+        ASSERT_EQ(restored.baseName, emote->baseName);
+        ASSERT_EQ(restored.images.getImage1()->expectedSize(), QSize(28, 28));
+        ASSERT_TRUE(restored.images.getImage3()->isEmpty());
+    }
+}
+
+TEST_F(EmoteSnapshotTest, Invalid)
+{
+    ASSERT_FALSE(parseEmoteSnapshot({}).has_value());
+    ASSERT_FALSE(parseEmoteSnapshot("garbage").has_value());
+
+    auto data = serializeEmoteSnapshot(makeMap());
+    ASSERT_FALSE(parseEmoteSnapshot(data.left(data.size() / 2)).has_value());
+
+    // truncated after decompression
+    auto truncated = qUncompress(data);
+    truncated.chop(10);
+    ASSERT_FALSE(parseEmoteSnapshot(qCompress(truncated)).has_value());
+}
+
+TEST_F(EmoteSnapshotTest, Reconcile)
+{
+    auto current = std::make_shared<const EmoteMap>(makeMap());
+
+    // Same emotes (but different pointers)
+    ASSERT_EQ(reconcileEmoteMap(current, makeMap()), nullptr);
+
+    // One emote was added
+    auto fresh = makeMap();
+    fresh[{"Keepo"}] = makeEmote("Keepo", "5");
+    auto reconciled = reconcileEmoteMap(current, std::move(fresh));
+    ASSERT_NE(reconciled, nullptr);
+    ASSERT_EQ(reconciled->size(), 5);
+    ASSERT_EQ(reconciled->at({"Kappa"}), current->at({"Kappa"}));
+    ASSERT_EQ(reconciled->at({"Keepo"})->id.string, "5");
+
+    // One emote was changed and one was removed
+    fresh = makeMap();
+    fresh.erase({"forsenE"});
+    fresh[{"Kappa"}] = makeEmote("Kappa", "6");
+    reconciled = reconcileEmoteMap(current, std::move(fresh));
+    ASSERT_NE(reconciled, nullptr);
+    ASSERT_EQ(reconciled->size(), 3);
+    ASSERT_NE(reconciled->at({"Kappa"}), current->at({"Kappa"}));
+    ASSERT_EQ(reconciled->at({"cvHazmat"}), current->at({"cvHazmat"}));
+
+    // Nothing loaded yet
+    reconciled = reconcileEmoteMap(nullptr, makeMap());
+    ASSERT_NE(reconciled, nullptr);
+    ASSERT_EQ(reconciled->size(), 4);
+}
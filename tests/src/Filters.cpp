@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: MIT
 
 #include "controllers/accounts/AccountController.hpp"
+#include "controllers/filters/FilterRecord.hpp"
+#include "controllers/filters/FilterVerdictCache.hpp"
 #include "controllers/filters/lang/expressions/UnaryOperation.hpp"
 #include "controllers/filters/lang/Filter.hpp"
 #include "controllers/filters/lang/Types.hpp"
@@ -282,6 +284,34 @@ TEST(Filters, Evaluation)
     }
 }
 
+TEST(Filters, VerdictCache)
+{
+    FilterRecord first("first", "author.subbed");
+    FilterRecord edited("first", "!author.subbed", first.getId());
+    FilterRecord other("other", "message.length > 5");
+
+    EXPECT_NE(first.generation(), edited.generation());
+    EXPECT_FALSE(first.dependsOnChannelState());
+    EXPECT_TRUE(FilterRecord("live", "channel.live").dependsOnChannelState());
+    EXPECT_TRUE(FilterRecord("watching", "!channel.watching")
+                    .dependsOnChannelState());
+
+    FilterVerdictCache cache;
+    EXPECT_EQ(cache.get(first.getId(), first.generation()), std::nullopt);
+
+    cache.set(first.getId(), first.generation(), true);
+    cache.set(other.getId(), other.generation(), false);
+    EXPECT_EQ(cache.get(first.getId(), first.generation()), true);
+    EXPECT_EQ(cache.get(other.getId(), other.generation()), false);
+
+    // An edited filter has to be evaluated again
+    EXPECT_EQ(cache.get(edited.getId(), edited.generation()), std::nullopt);
+    cache.set(edited.getId(), edited.generation(), false);
+    EXPECT_EQ(cache.get(edited.getId(), edited.generation()), false);
+    EXPECT_EQ(cache.get(first.getId(), first.generation()), std::nullopt);
+    EXPECT_EQ(cache.get(other.getId(), other.generation()), false);
+}
+
 TEST_F(FiltersF, TypingContextChecks)
 {
     MockChannel channel("pajlada");
@@ -0,0 +1,266 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "providers/twitch/api/HelixBatcher.hpp"
+
+#include "providers/twitch/api/Helix.hpp"
+#include "Test.hpp"
+#include "util/Twitch.hpp"
+
+#include <QCoreApplication>
+#include <QJsonObject>
+
+#include <chrono>
+#include <thread>
+
+using namespace chatterino;
+using namespace std::chrono_literals;
+
+namespace {
+
+struct FakeApi {
+    std::vector<QStringList> requests;
+    /// Number of requests that fail before requests succeed again
+    int failures = 0;
+
+    HelixBatcher<HelixUser>::Fetch fetch()
+    {
+        return [this](QStringList logins, auto onSuccess, auto onFailure) {
+            this->requests.push_back(logins);
+            if (this->failures > 0)
+            {
+                this->failures--;
+                onFailure();
+                return;
+            }
+            // Like Helix, reject the whole request if any login is malformed
+            for (const auto &login : logins)
+            {
+                if (!twitchUserNameRegexp().match(login).hasMatch())
+                {
+                    onFailure();
+                    return;
+                }
+            }
+
+            std::vector<HelixUser> users;
+            for (const auto &login : logins)
+            {
+                if (login.startsWith("unknown"))
+                {
+                    continue;
+                }
+                users.emplace_back(QJsonObject{
+                    {"id", "id-" + login},
+                    {"login", login},
+                });
+            }
+            onSuccess(users);
+        };
+    }
+};
+
+HelixBatcher<HelixUser>::KeyOf byLogin()
+{
+    return [](const HelixUser &user) {
+        return user.login;
+    };
+}
+
+}  // namespace
+
+TEST(HelixBatcher, Batch)
+{
+    FakeApi api;
+    HelixBatcher<HelixUser> batcher(api.fetch(), byLogin(),
+                                    {.caseInsensitive = true});
+
+    std::vector<QString> found;
+    int failed = 0;
+    auto onSuccess = [&](const HelixUser &user) {
+        found.push_back(user.id);
+    };
+    auto onFailure = [&] {
+        failed++;
+    };
+
+    batcher.get("forsen", onSuccess, onFailure);
+    batcher.get("pajlada", onSuccess, onFailure);
+    batcher.get("Forsen", onSuccess, onFailure);
+    batcher.get("unknown", onSuccess, onFailure);
+    ASSERT_EQ(batcher.pendingCount(), 3);
+    ASSERT_TRUE(api.requests.empty());
+
+    batcher.flush();
+    ASSERT_EQ(api.requests.size(), 1);
+    ASSERT_EQ(api.requests[0],
+              (QStringList{"forsen", "pajlada", "unknown"}));
+    ASSERT_EQ(found, (std::vector<QString>{"id-forsen", "id-forsen",
+                                           "id-pajlada"}));
+    ASSERT_EQ(failed, 1);
+
+    // cached, but still delivered asynchronously
+    batcher.get("FORSEN", onSuccess, onFailure);
+    ASSERT_EQ(batcher.pendingCount(), 0);
+    ASSERT_EQ(found.size(), 3);
+    QCoreApplication::processEvents();
+    ASSERT_EQ(found.size(), 4);
+    ASSERT_EQ(found.back(), "id-forsen");
+
+    batcher.get("", onSuccess, onFailure);
+    ASSERT_EQ(failed, 1);
+    QCoreApplication::processEvents();
+    ASSERT_EQ(failed, 2);
+
+    // not cached
+    batcher.get("unknown", onSuccess, onFailure);
+    ASSERT_EQ(batcher.pendingCount(), 1);
+}
+
+TEST(HelixBatcher, MaxBatchSize)
+{
+    FakeApi api;
+    HelixBatcher<HelixUser> batcher(api.fetch(), byLogin());
+
+    size_t found = 0;
+    for (int i = 0; i < 250; i++)
+    {
+        batcher.get(
+            "user" + QString::number(i),
+            [&](const auto &) {
+                found++;
+            },
+            [] {
+                FAIL();
+            });
+    }
+    batcher.flush();
+
+    ASSERT_EQ(api.requests.size(), 3);
+    ASSERT_EQ(api.requests[0].size(), 100);
+    ASSERT_EQ(api.requests[1].size(), 100);
+    ASSERT_EQ(api.requests[2].size(), 50);
+    ASSERT_EQ(found, 250);
+}
+
+TEST(HelixBatcher, Retry)
+{
+    FakeApi api;
+    HelixBatcher<HelixUser> batcher(api.fetch(), byLogin(),
+                                    {.retryDelay = 10ms});
+
+    int found = 0;
+    int failed = 0;
+    auto onSuccess = [&](const auto &) {
+        found++;
+    };
+    auto onFailure = [&] {
+        failed++;
+    };
+
+    // the batch is retried once as a whole
+    api.failures = 1;
+    for (const auto *login : {"forsen", "unknown", "pajlada"})
+    {
+        batcher.get(login, onSuccess, onFailure);
+    }
+    batcher.flush();
+    ASSERT_EQ(api.requests.size(), 1);
+    ASSERT_EQ(found + failed, 0);
+
+    std::this_thread::sleep_for(20ms);
+    QCoreApplication::processEvents();
+    ASSERT_EQ(api.requests.size(), 2);
+    ASSERT_EQ(api.requests[1].size(), 3);
+    ASSERT_EQ(found, 2);
+    ASSERT_EQ(failed, 1);
+
+    // if the retry fails too, all lookups fail
+    api.requests.clear();
+    found = 0;
+    failed = 0;
+    api.failures = 2;
+    batcher.get("forsen2", onSuccess, onFailure);
+    batcher.get("pajlada2", onSuccess, onFailure);
+    batcher.flush();
+
+    std::this_thread::sleep_for(20ms);
+    QCoreApplication::processEvents();
+    ASSERT_EQ(api.requests.size(), 2);
+    ASSERT_EQ(found, 0);
+    ASSERT_EQ(failed, 2);
+}
+
+TEST(HelixBatcher, MalformedKey)
+{
+    FakeApi api;
+    HelixBatcher<HelixUser> batcher(
+        api.fetch(), byLogin(),
+        {.isValidKey = [](const QString &login) {
+            return twitchUserNameRegexp().match(login).hasMatch();
+        }});
+
+    std::vector<QString> found;
+    std::vector<QString> failed;
+    for (const auto *login : {"forsen", "not a login", "pajlada", "nymn"})
+    {
+        batcher.get(
+            login,
+            [&](const HelixUser &user) {
+                found.push_back(user.login);
+            },
+            [&, login = QString(login)] {
+                failed.push_back(login);
+            });
+    }
+
+    // the malformed key is never sent and fails on its own
+    ASSERT_EQ(batcher.pendingCount(), 3);
+    ASSERT_TRUE(failed.empty());
+    batcher.flush();
+    ASSERT_EQ(api.requests.size(), 1);
+    ASSERT_EQ(api.requests[0], (QStringList{"forsen", "pajlada", "nymn"}));
+    ASSERT_EQ(found, (std::vector<QString>{"forsen", "pajlada", "nymn"}));
+
+    QCoreApplication::processEvents();
+    ASSERT_EQ(failed, (std::vector<QString>{"not a login"}));
+}
+
+TEST(HelixBatcher, Window)
+{
+    FakeApi api;
+    HelixBatcher<HelixUser> batcher(api.fetch(), byLogin(),
+                                    {.window = 10ms});
+
+    int found = 0;
+    batcher.get(
+        "forsen",
+        [&](const auto &) {
+            found++;
+        },
+        [] {
+            FAIL();
+        });
+    ASSERT_EQ(found, 0);
+
+    std::this_thread::sleep_for(20ms);
+    QCoreApplication::processEvents();
+
+    ASSERT_EQ(api.requests.size(), 1);
+    ASSERT_EQ(found, 1);
+}
+
+TEST(HelixBatcher, Expiry)
+{
+    FakeApi api;
+    HelixBatcher<HelixUser> batcher(api.fetch(), byLogin(), {.ttl = 0ms});
+
+    batcher.prime(HelixUser(QJsonObject{
+        {"id", "1"},
+        {"login", "forsen"},
+    }));
+
+    batcher.get("forsen", [](const auto &) {}, [] {});
+    ASSERT_EQ(batcher.pendingCount(), 1);
+}
@@ -5,6 +5,8 @@
 #include "controllers/ignores/IgnoreController.hpp"
 
 #include "controllers/accounts/AccountController.hpp"
+#include "controllers/ignores/IgnorePhrase.hpp"
+#include "controllers/ignores/IgnoreRewriter.hpp"
 #include "mocks/BaseApplication.hpp"
 #include "mocks/EmoteController.hpp"
 #include "providers/twitch/TwitchEmotes.hpp"
@@ -172,6 +174,24 @@ TEST_F(TestIgnoreController, processIgnorePhrases)
             "Kappa",
             {emoteAt(127, "Kappa")},
         },
+        {
+            {regularReplace("foo", "x")},
+            "foo Kappa foo Keepo",
+            {emoteAt(4, "Kappa"), emoteAt(14, "Keepo")},
+            "x Kappa x Keepo",
+            {emoteAt(2, "Kappa"), emoteAt(10, "Keepo")},
+        },
+        {
+            {
+                regularReplace("Foo", "x"),
+                regularReplace("bar", "y", false),
+                regularReplace("unused", "z"),
+            },
+            "foo Foo BAR Kappa",
+            {emoteAt(12, "Kappa")},
+            "foo x y Kappa",
+            {emoteAt(8, "Kappa")},
+        },
     };
 
     for (const auto &test : testCases)
@@ -189,3 +209,44 @@ TEST_F(TestIgnoreController, processIgnorePhrases)
             << "' and output '" << message << "'";
     }
 }
+
+TEST_F(TestIgnoreController, findBlockingPhrase)
+{
+    auto block = [](auto pattern, bool isRegex, bool caseSensitive = true) {
+        return IgnorePhrase(pattern, isRegex, true, {}, caseSensitive);
+    };
+
+    std::vector<IgnorePhrase> phrases{
+        block("spam", false, false),
+        IgnorePhrase("eggs", false, false, "***", true),
+        block("b[aeiou]+d", true),
+        block("Word", false),
+        block("", false),
+        block("(", true),
+    };
+    IgnoreRewriter rewriter(phrases);
+
+    struct TestCase {
+        QString input;
+        const IgnorePhrase *expected;
+    };
+
+    std::vector<TestCase> testCases{
+        {"", nullptr},
+        {"hello", nullptr},
+        {"SPAM and eggs", &phrases[0]},
+        {"eggs", nullptr},
+        {"baaad", &phrases[2]},
+        {"a baaad Word", &phrases[2]},
+        {"a Word", &phrases[3]},
+        {"a word", nullptr},
+        {"a Word with spam", &phrases[0]},
+        {"(", nullptr},
+    };
+
+    for (const auto &test : testCases)
+    {
+        EXPECT_EQ(rewriter.findBlockingPhrase(test.input), test.expected)
+            << "Unexpected blocking phrase for '" << test.input << "'";
+    }
+}
@@ -273,3 +273,76 @@ TEST(LimitedQueue, FirstN)
     SNAPSHOT_EQUALS(empty.firstN(2), {}, "empty");
     SNAPSHOT_EQUALS(empty.firstN(6), {}, "empty");
 }
+
+TEST(LimitedQueue, Visit)
+{
+    LimitedQueue<int> queue(5);
+    for (int i = 1; i <= 7; i++)
+    {
+        queue.pushBack(i);
+    }
+
+    auto all = queue.visit([](const auto &view) {
+        return std::vector<int>(view.begin(), view.end());
+    });
+    SNAPSHOT_EQUALS(all, {3, 4, 5, 6, 7}, "all items");
+
+    auto lastTwo = queue.visitLastN(2, [](const auto &view) {
+        return std::vector<int>(view.begin(), view.end());
+    });
+    SNAPSHOT_EQUALS(lastTwo, {6, 7}, "last two items");
+
+    auto tooMany = queue.visitLastN(12, [](const auto &view) {
+        return view.size();
+    });
+    EXPECT_EQ(tooMany, 5);
+
+    LimitedQueue<int> empty(5);
+    auto nEmpty = empty.visit([](const auto &view) {
+        return view.size();
+    });
+    EXPECT_EQ(nEmpty, 0);
+}
+
+TEST(LimitedQueue, Epoch)
+{
+    LimitedQueue<int> queue(5);
+    auto epoch = queue.epoch();
+
+    queue.getSnapshot();
+    queue.visit([](const auto &) {});
+    EXPECT_EQ(queue.epoch(), epoch) << "reading doesn't change the epoch";
+
+    queue.pushBack(1);
+    EXPECT_NE(queue.epoch(), epoch);
+    epoch = queue.epoch();
+
+    queue.replaceItem(0, 2);
+    EXPECT_NE(queue.epoch(), epoch);
+    epoch = queue.epoch();
+
+    queue.clear();
+    EXPECT_NE(queue.epoch(), epoch);
+}
+
+TEST(LimitedQueue, InsertBeforeIf)
+{
+    LimitedQueue<int> queue(5);
+    queue.pushBack(1);
+    queue.pushBack(3);
+    queue.pushBack(5);
+
+    EXPECT_TRUE(queue.insertBeforeIf(
+        [](int i) {
+            return i > 2;
+        },
+        2));
+    SNAPSHOT_EQUALS(queue.getSnapshot(), {1, 2, 3, 5}, "inserted 2");
+
+    EXPECT_FALSE(queue.insertBeforeIf(
+        [](int i) {
+            return i > 5;
+        },
+        6));
+    SNAPSHOT_EQUALS(queue.getSnapshot(), {1, 2, 3, 5}, "nothing inserted");
+}
@@ -114,6 +114,8 @@ TEST(LinkParser, parseDomainLinks)
         {"", u"köln.de"_s, ""},
         {"", u"ü.com"_s, ""},
         {"", u"─.com"_s, ""},
+        {"", u"example.セール"_s, ""},
+        {"https://", u"пример.ОНЛАЙН"_s, "/foo"},
         // test case-insensitiveness
         {"HtTpS://", "127.0.0.1.CoM"},
         {"HTTP://", "XD.CHATTERINO.COM", "/#?FOO"},
@@ -270,6 +272,12 @@ TEST(LinkParser, doesntParseInvalidLinks)
         "*.com",
         "example.com(foo)",
         "example.com()",
+        "https://chatterino",
+        "chatterino.comx",
+        "a.aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+        ".com",
+        "a.b",
+        "...",
     };
 
     for (const auto &input : inputs)
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "providers/links/LinkResolver.hpp"
+
+#include "mocks/BaseApplication.hpp"
+#include "providers/links/LinkInfo.hpp"
+#include "singletons/Settings.hpp"
+#include "Test.hpp"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace chatterino;
+using namespace std::chrono_literals;
+
+using State = LinkInfo::State;
+
+namespace {
+
+struct FakeApi {
+    std::vector<QString> requests;
+    std::vector<std::function<void(LinkResolution)>> pending;
+
+    LinkResolver::Fetch fetch()
+    {
+        return [this](const QString &url, auto done) {
+            this->requests.push_back(url);
+            this->pending.push_back(std::move(done));
+        };
+    }
+
+    void respond(size_t i, LinkResolution resolution)
+    {
+        this->pending.at(i)(std::move(resolution));
+    }
+};
+
+class LinkResolverTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        this->app = std::make_unique<mock::BaseApplication>();
+        this->app->settings.linkInfoTooltip = true;
+    }
+
+    void TearDown() override
+    {
+        this->app.reset();
+    }
+
+    std::unique_ptr<mock::BaseApplication> app;
+};
+
+}  // namespace
+
+TEST(LinkResolver, normalizeUrl)
+{
+    ASSERT_EQ(LinkResolver::normalizeUrl("https://Chatterino.COM/"),
+              "https://chatterino.com");
+    ASSERT_EQ(LinkResolver::normalizeUrl("HTTPS://chatterino.com/a/#top"),
+              "https://chatterino.com/a");
+    ASSERT_EQ(LinkResolver::normalizeUrl("https://chatterino.com/A?b=C"),
+              "https://chatterino.com/A?b=C");
+    ASSERT_NE(LinkResolver::normalizeUrl("http://chatterino.com"),
+              LinkResolver::normalizeUrl("https://chatterino.com"));
+}
+
+TEST_F(LinkResolverTest, Coalesce)
+{
+    FakeApi api;
+    LinkResolver resolver(api.fetch(), {});
+
+    std::vector<std::unique_ptr<LinkInfo>> infos;
+    for (int i = 0; i < 10; i++)
+    {
+        infos.emplace_back(std::make_unique<LinkInfo>(
+            i % 2 == 0 ? "https://chatterino.com/" : "https://Chatterino.com"));
+        resolver.resolve(infos.back().get());
+        ASSERT_EQ(infos.back()->state(), State::Loading);
+    }
+    ASSERT_EQ(api.requests.size(), 1);
+    ASSERT_EQ(api.requests[0], "https://chatterino.com/");
+
+    // destroyed infos are skipped
+    infos.erase(infos.begin() + 3);
+
+    api.respond(0, {.tooltip = "Chatterino"});
+    for (const auto &info : infos)
+    {
+        ASSERT_EQ(info->state(), State::Resolved);
+        ASSERT_EQ(info->tooltip(), "Chatterino");
+    }
+
+    // cached
+    LinkInfo cached("https://chatterino.com#about");
+    resolver.resolve(&cached);
+    ASSERT_EQ(cached.state(), State::Resolved);
+    ASSERT_EQ(cached.tooltip(), "Chatterino");
+    ASSERT_EQ(api.requests.size(), 1);
+}
+
+TEST_F(LinkResolverTest, Errors)
+{
+    FakeApi api;
+    LinkResolver resolver(api.fetch(), {.negativeTtl = 10ms});
+
+    LinkInfo first("https://chatterino.com/404");
+    resolver.resolve(&first);
+    api.respond(0, {
+                       .tooltip = "No link info found",
+                       .errored = true,
+                       .negative = true,
+                   });
+    ASSERT_EQ(first.state(), State::Errored);
+
+    LinkInfo second("https://chatterino.com/404");
+    resolver.resolve(&second);
+    ASSERT_EQ(second.state(), State::Errored);
+    ASSERT_EQ(api.requests.size(), 1);
+
+    std::this_thread::sleep_for(20ms);
+
+    LinkInfo third("https://chatterino.com/404");
+    resolver.resolve(&third);
+    ASSERT_EQ(third.state(), State::Loading);
+    ASSERT_EQ(api.requests.size(), 2);
+}
+
+TEST_F(LinkResolverTest, Capacity)
+{
+    FakeApi api;
+    LinkResolver resolver(api.fetch(), {.capacity = 2});
+
+    auto resolve = [&](const QString &url) {
+        LinkInfo info(url);
+        resolver.resolve(&info);
+        if (info.isLoading())
+        {
+            api.respond(api.pending.size() - 1, {.tooltip = url});
+        }
+        return info.tooltip();
+    };
+
+    resolve("https://a.com");
+    resolve("https://b.com");
+    resolve("https://a.com");
+    ASSERT_EQ(api.requests.size(), 2);
+
+    // evicts b.com, which was used least recently
+    resolve("https://c.com");
+    resolve("https://a.com");
+    ASSERT_EQ(api.requests.size(), 3);
+    resolve("https://b.com");
+    ASSERT_EQ(api.requests.size(), 4);
+}
+
+TEST_F(LinkResolverTest, Disabled)
+{
+    FakeApi api;
+    LinkResolver resolver(api.fetch(), {});
+    this->app->settings.linkInfoTooltip = false;
+
+    LinkInfo info("https://chatterino.com");
+    resolver.resolve(&info);
+    ASSERT_EQ(info.state(), State::Created);
+    ASSERT_TRUE(api.requests.empty());
+}
+
+TEST_F(LinkResolverTest, ResolverDestroyed)
+{
+    FakeApi api;
+    auto resolver = std::make_unique<LinkResolver>(api.fetch(),
+                                                   LinkResolver::Options{});
+
+    LinkInfo info("https://chatterino.com");
+    resolver->resolve(&info);
+    resolver.reset();
+
+    api.respond(0, {.tooltip = "Chatterino"});
+    ASSERT_EQ(info.state(), State::Loading);
+}
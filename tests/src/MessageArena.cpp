@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/MessageArena.hpp"
+
+#include "messages/MessageElement.hpp"
+#include "Test.hpp"
+#include "util/DebugCount.hpp"
+
+#include <memory>
+#include <vector>
+
+using namespace chatterino;
+
+namespace {
+
+int64_t liveBlocks()
+{
+    return DebugCount::get(DebugObject::MessageArenaBlock);
+}
+
+}  // namespace
+
+TEST(MessageArena, ElementsOutliveArena)
+{
+    auto before = liveBlocks();
+    std::vector<std::unique_ptr<MessageElement>> elements;
+    {
+        MessageArena arena;
+        for (int i = 0; i < 50; i++)
+        {
+            elements.emplace_back(new (arena) TextElement(
+                QString::number(i), MessageElementFlag::Text));
+        }
+        // a heap allocated element in between
+        elements.emplace_back(
+            std::make_unique<TextElement>("heap", MessageElementFlag::Text));
+        ASSERT_GT(liveBlocks(), before);
+    }
+
+    // the blocks are still referenced by the elements
+    ASSERT_GT(liveBlocks(), before);
+    for (int i = 0; i < 50; i++)
+    {
+        auto *text = dynamic_cast<TextElement *>(elements[i].get());
+        ASSERT_NE(text, nullptr);
+        ASSERT_EQ(text->words().front(), QString::number(i));
+    }
+
+    elements.clear();
+    ASSERT_EQ(liveBlocks(), before);
+}
+
+TEST(MessageArena, ResetReusesBlock)
+{
+    auto before = liveBlocks();
+    MessageArena arena;
+
+    std::vector<std::unique_ptr<MessageElement>> elements;
+    elements.emplace_back(
+        new (arena) TextElement("a", MessageElementFlag::Text));
+    ASSERT_EQ(liveBlocks(), before + 1);
+
+    // the element is still alive, so the block can't be rewound
+    arena.reset();
+    elements.emplace_back(
+        new (arena) TextElement("b", MessageElementFlag::Text));
+    ASSERT_EQ(liveBlocks(), before + 1);
+
+    for (int i = 0; i < 100; i++)
+    {
+        elements.clear();
+        arena.reset();
+        elements.emplace_back(
+            new (arena) TextElement("c", MessageElementFlag::Text));
+    }
+    ASSERT_EQ(liveBlocks(), before + 1);
+}
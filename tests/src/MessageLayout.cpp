@@ -95,3 +95,47 @@ TEST(TextElement, BasicCase)
     EXPECT_EQ(wordStart, 0);
     EXPECT_EQ(wordEnd, 3);
 }
+
+TEST(MessageLayout, SharedContainers)
+{
+    MockApplication app;
+
+    MessageBuilder builder;
+    builder.append(
+        std::make_unique<TextElement>("abc", MessageElementFlag::Text));
+    auto message = builder.release();
+
+    MessageColors colors;
+    auto layoutWith = [&](MessageLayout &layout, int width) {
+        layout.layout(
+            {
+                .messageColors = colors,
+                .flags = MessageElementFlag::Text,
+                .width = width,
+                .scale = 1,
+                .imageScale = 1,
+            },
+            false);
+    };
+    auto point = QPoint(WIDTH / 20, 5);
+
+    MessageLayout first(message);
+    MessageLayout second(message);
+    layoutWith(first, WIDTH);
+    layoutWith(second, WIDTH);
+
+    const auto *element = first.getElementAt(point);
+    ASSERT_NE(element, nullptr);
+    ASSERT_EQ(second.getElementAt(point), element);
+
+    // a different width creates a new container, the other view keeps its own
+    layoutWith(first, WIDTH * 2);
+    ASSERT_NE(first.getElementAt(point), nullptr);
+    ASSERT_NE(first.getElementAt(point), element);
+    ASSERT_EQ(second.getElementAt(point), element);
+
+    // other messages don't share containers
+    MessageLayout other(MessageBuilder().release());
+    layoutWith(other, WIDTH);
+    ASSERT_EQ(other.getElementAt(point), nullptr);
+}
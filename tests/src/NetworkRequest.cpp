@@ -6,11 +6,15 @@
 
 #include "common/network/NetworkManager.hpp"
 #include "common/network/NetworkResult.hpp"
+#include "common/network/NetworkScheduler.hpp"
 #include "NetworkHelpers.hpp"
 #include "Test.hpp"
+#include "util/DebugCount.hpp"
 #include "util/QMagicEnum.hpp"
 
 #include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QStringBuilder>
 
 using namespace chatterino;
 
@@ -219,6 +223,62 @@ TEST(NetworkRequest, TimeoutNotTimingOut)
     EXPECT_TRUE(NetworkManager::workerThread->isRunning());
 }
 
+TEST(NetworkRequest, HostLimits)
+{
+    using network::detail::hostLimitsFor;
+
+    // Only the rate limited APIs are limited
+    ASSERT_EQ(hostLimitsFor("api.twitch.tv").maxConcurrent, 6);
+    ASSERT_GT(hostLimitsFor("api.twitch.tv").budget, 0);
+    ASSERT_EQ(hostLimitsFor("static-cdn.jtvnw.net").maxConcurrent, 0);
+    ASSERT_EQ(hostLimitsFor("static-cdn.jtvnw.net").budget, 0);
+}
+
+TEST(NetworkRequest, TimeoutWhileQueued)
+{
+    EXPECT_TRUE(NetworkManager::workerThread->isRunning());
+
+    // Occupy all connections Qt opens to the host (distinct URLs aren't
+    // coalesced)
+    std::vector<std::unique_ptr<RequestWaiter>> running;
+    for (int i = 0; i < 6; i++)
+    {
+        auto &waiter = running.emplace_back(std::make_unique<RequestWaiter>());
+        QString url = getDelayURL(2) % u"?i=" % QString::number(i);
+        NetworkRequest(url)
+            .finally([&waiter] {
+                waiter->requestDone();
+            })
+            .execute();
+    }
+
+    RequestWaiter waiter;
+    QElapsedTimer timer;
+    timer.start();
+    NetworkRequest(getDelayURL(1))
+        .timeout(500)
+        .onSuccess([](const NetworkResult & /*result*/) {
+            // The request must not be sent after its timeout
+            EXPECT_TRUE(false);
+        })
+        .onError([](const NetworkResult &result) {
+            EXPECT_EQ(result.error(),
+                      NetworkResult::NetworkError::TimeoutError);
+        })
+        .finally([&waiter] {
+            waiter.requestDone();
+        })
+        .execute();
+
+    waiter.waitForRequest();
+    EXPECT_LT(timer.elapsed(), 2000);
+
+    for (const auto &runningWaiter : running)
+    {
+        runningWaiter->waitForRequest();
+    }
+}
+
 TEST(NetworkRequest, FinallyCallbackOnTimeout)
 {
     EXPECT_TRUE(NetworkManager::workerThread->isRunning());
@@ -301,6 +361,65 @@ TEST(NetworkRequest, BatchedTimeouts)
 #endif
 }
 
+TEST(NetworkRequest, Coalesced)
+{
+    EXPECT_TRUE(NetworkManager::workerThread->isRunning());
+
+    auto coalescedBefore = DebugCount::get(DebugObject::HTTPRequestCoalesced);
+
+    auto url = getDelayURL(1);
+    RequestWaiter first;
+    RequestWaiter second;
+    bool firstSucceeded = false;
+    bool secondSucceeded = false;
+
+    NetworkRequest(url)
+        .timeout(3000)
+        .onSuccess([&](const NetworkResult &result) {
+            EXPECT_EQ(result.status(), 200);
+            firstSucceeded = true;
+        })
+        .finally([&] {
+            first.requestDone();
+        })
+        .execute();
+    // Same request with a higher priority
+    NetworkRequest(url)
+        .priority(NetworkRequestPriority::VisibleImage)
+        .timeout(3000)
+        .onSuccess([&](const NetworkResult &result) {
+            EXPECT_EQ(result.status(), 200);
+            secondSucceeded = true;
+        })
+        .finally([&] {
+            second.requestDone();
+        })
+        .execute();
+
+    first.waitForRequest();
+    second.waitForRequest();
+
+    EXPECT_TRUE(firstSucceeded);
+    EXPECT_TRUE(secondSucceeded);
+    EXPECT_EQ(DebugCount::get(DebugObject::HTTPRequestCoalesced),
+              coalescedBefore + 1);
+
+    // Requests with a body are never coalesced
+    RequestWaiter post;
+    NetworkRequest(getHttpbinUrl(u"post"), NetworkRequestType::Post)
+        .payload("foo")
+        .finally([&] {
+            post.requestDone();
+        })
+        .execute();
+    NetworkRequest(getHttpbinUrl(u"post"), NetworkRequestType::Post)
+        .payload("foo")
+        .execute();
+    post.waitForRequest();
+    EXPECT_EQ(DebugCount::get(DebugObject::HTTPRequestCoalesced),
+              coalescedBefore + 1);
+}
+
 TEST(NetworkRequest, HttpGetHeaders)
 {
     EXPECT_TRUE(NetworkManager::workerThread->isRunning());
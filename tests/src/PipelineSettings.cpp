@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/PipelineSettings.hpp"
+
+#include "messages/MessageBuilder.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "singletons/Settings.hpp"
+#include "Test.hpp"
+
+using namespace chatterino;
+
+TEST(PipelineSettings, Publish)
+{
+    mock::BaseApplication app;
+
+    auto before = PipelineSettings::current();
+    ASSERT_NE(before, nullptr);
+    ASSERT_EQ(before, PipelineSettings::current());
+    ASSERT_EQ(before->logTimestampFormat, "hh:mm:ss");
+    ASSERT_TRUE(before->enableZeroWidthEmotes);
+
+    MessageParseArgs args;
+    ASSERT_EQ(args.settings, before);
+
+    app.settings.enableZeroWidthEmotes = false;
+    app.settings.logTimestampFormat = "hh:mm";
+
+    auto after = PipelineSettings::current();
+    ASSERT_NE(after, before);
+    ASSERT_FALSE(after->enableZeroWidthEmotes);
+    ASSERT_EQ(after->logTimestampFormat, "hh:mm");
+
+    // snapshots that were already captured don't change
+    ASSERT_TRUE(before->enableZeroWidthEmotes);
+    ASSERT_EQ(before->logTimestampFormat, "hh:mm:ss");
+    ASSERT_EQ(args.settings, before);
+
+    // settings that aren't part of the snapshot don't publish a new one
+    app.settings.showTimestamps.setValue(
+        !app.settings.showTimestamps.getValue());
+    ASSERT_EQ(PipelineSettings::current(), after);
+}
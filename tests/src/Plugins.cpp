@@ -12,6 +12,7 @@
 #    include "controllers/commands/CommandController.hpp"
 #    include "controllers/plugins/api/ChannelRef.hpp"
 #    include "controllers/plugins/api/WebSocket.hpp"
+#    include "controllers/plugins/MessageBatcher.hpp"
 #    include "controllers/plugins/Plugin.hpp"
 #    include "controllers/plugins/PluginController.hpp"
 #    include "controllers/plugins/PluginPermission.hpp"
@@ -29,6 +30,7 @@
 #    include "Test.hpp"
 
 #    include <lauxlib.h>
+#    include <QtCore/qtestsupport_core.h>
 #    include <sol/state_view.hpp>
 #    include <sol/table.hpp>
 
@@ -1556,6 +1558,80 @@ TEST_F(PluginTest, ChannelOnDisplayNameChanged)
     ASSERT_FALSE(gotEvent);
 }
 
+TEST_F(PluginTest, ChannelOnMessages)
+{
+    this->configure();
+
+    auto chan = std::make_shared<MockChannel>("mock");
+    sol::protected_function init = this->lua->script(R"lua(
+        received = 0
+        batches = 0
+        return function(chan)
+            hdl = chan:on_messages(function(messages)
+                batches = batches + 1
+                received = received + #messages
+                assert(messages[1].frozen)
+            end)
+        end
+    )lua");
+    ASSERT_TRUE(init(lua::api::ChannelRef(chan)).valid());
+
+    // a full batch is delivered right away
+    for (size_t i = 0; i < lua::MessageBatcher::MAX_BATCH_SIZE; i++)
+    {
+        chan->addSystemMessage(QString::number(i));
+    }
+    ASSERT_EQ((*this->lua)["batches"].get<int>(), 1);
+    ASSERT_EQ((*this->lua)["received"].get<size_t>(),
+              lua::MessageBatcher::MAX_BATCH_SIZE);
+    ASSERT_EQ(this->rawpl->messageHandlerStats.calls, 1);
+    ASSERT_EQ(this->rawpl->messageHandlerStats.messages,
+              lua::MessageBatcher::MAX_BATCH_SIZE);
+
+    // partial batches are delivered on the next frame
+    chan->addSystemMessage("partial");
+    ASSERT_EQ((*this->lua)["received"].get<size_t>(),
+              lua::MessageBatcher::MAX_BATCH_SIZE);
+    QTest::qWait(lua::MessageBatcher::FLUSH_INTERVAL.count() * 4);
+    ASSERT_EQ((*this->lua)["batches"].get<int>(), 2);
+    ASSERT_EQ((*this->lua)["received"].get<size_t>(),
+              lua::MessageBatcher::MAX_BATCH_SIZE + 1);
+
+    ASSERT_TRUE(this->lua->script("hdl:disconnect()").valid());
+}
+
+TEST_F(PluginTest, ChannelOnMessagesBudget)
+{
+    this->configure();
+
+    auto chan = std::make_shared<MockChannel>("mock");
+    sol::protected_function init = this->lua->script(R"lua(
+        calls = 0
+        return function(chan)
+            chan:on_messages(function()
+                calls = calls + 1
+                while true do end
+            end)
+        end
+    )lua");
+    ASSERT_TRUE(init(lua::api::ChannelRef(chan)).valid());
+
+    for (size_t i = 0; i < lua::MessageBatcher::MAX_BATCH_SIZE; i++)
+    {
+        chan->addSystemMessage(QString::number(i));
+    }
+    ASSERT_EQ((*this->lua)["calls"].get<int>(), 1);
+    ASSERT_EQ(this->rawpl->messageHandlerStats.budgetExceeded, 1);
+
+    // the handler is throttled now
+    for (size_t i = 0; i < lua::MessageBatcher::MAX_BATCH_SIZE; i++)
+    {
+        chan->addSystemMessage(QString::number(i));
+    }
+    ASSERT_EQ((*this->lua)["calls"].get<int>(), 1);
+    ASSERT_EQ(this->rawpl->messageHandlerStats.droppedBatches, 1);
+}
+
 class PluginMessageConstructionTest
     : public PluginTest,
       public ::testing::WithParamInterface<QString>
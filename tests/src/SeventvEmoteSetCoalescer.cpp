@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "providers/seventv/eventapi/EmoteSetCoalescer.hpp"
+
+#include "messages/Emote.hpp"
+#include "messages/Image.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "providers/seventv/eventapi/Dispatch.hpp"
+#include "providers/seventv/SeventvEmotes.hpp"
+#include "Test.hpp"
+
+#include <QJsonObject>
+#include <QString>
+
+using namespace chatterino;
+using namespace chatterino::seventv::eventapi;
+using namespace std::chrono_literals;
+
+namespace {
+
+const QString EMOTE_SET = "60b39e943e203cc169dfc106";
+
+Dispatch makeDispatch()
+{
+    return Dispatch(QJsonObject{
+        {"type", "emote_set.update"},
+        {"body",
+         QJsonObject{
+             {"id", EMOTE_SET},
+             {"actor", QJsonObject{{"display_name", "nerixyz"}}},
+         }},
+    });
+}
+
+QJsonObject activeEmote(const QString &id, const QString &name)
+{
+    return {{"id", id}, {"name", name}};
+}
+
+EmotePtr makeEmote(const QString &name, const QString &id)
+{
+    return std::make_shared<const Emote>(Emote{
+        .name = {name},
+        .images = ImageSet{getEmptyImagePtr()},
+        .tooltip = {name},
+        .homePage = {},
+        .id = {id},
+        .author = {"pajlada"},
+    });
+}
+
+struct Flushed {
+    std::shared_ptr<EmoteSetCoalescer> coalescer;
+    std::vector<EmoteSetUpdate> updates;
+
+    Flushed()
+        : coalescer(std::make_shared<EmoteSetCoalescer>(
+              1h, [this](auto updates) {
+                  this->updates = std::move(updates);
+              }))
+    {
+    }
+
+    void add(const QString &id, const QString &name)
+    {
+        this->coalescer->add(
+            EmoteAddDispatch(makeDispatch(), activeEmote(id, name)),
+            makeEmote(name, id));
+    }
+
+    void rename(const QString &id, const QString &oldName,
+                const QString &newName)
+    {
+        this->coalescer->update(EmoteUpdateDispatch(makeDispatch(),
+                                                    activeEmote(id, oldName),
+                                                    activeEmote(id, newName)));
+    }
+
+    void remove(const QString &id, const QString &name)
+    {
+        this->coalescer->remove(
+            EmoteRemoveDispatch(makeDispatch(), activeEmote(id, name)));
+    }
+};
+
+}  // namespace
+
+TEST(SeventvEmoteSetCoalescer, Merge)
+{
+    mock::BaseApplication app;
+    Flushed f;
+
+    f.add("1", "Added");
+    f.add("2", "AddedAndRemoved");
+    f.remove("2", "AddedAndRemoved");
+    f.add("3", "AddedAndRenamed");
+    f.rename("3", "AddedAndRenamed", "Renamed");
+    f.rename("4", "Old", "Mid");
+    f.rename("4", "Mid", "New");
+    f.rename("5", "RenamedAndRemoved", "Foo");
+    f.remove("5", "Foo");
+
+    f.coalescer->flush();
+    ASSERT_EQ(f.updates.size(), 1);
+    const auto &update = f.updates[0];
+    ASSERT_EQ(update.emoteSetID, EMOTE_SET);
+    ASSERT_EQ(update.changes.size(), 4);
+
+    ASSERT_EQ(update.changes[0].emoteID, "1");
+    ASSERT_TRUE(update.changes[0].oldName.isEmpty());
+    ASSERT_EQ(update.changes[0].newName, "Added");
+    ASSERT_NE(update.changes[0].addedEmote, nullptr);
+    ASSERT_EQ(update.changes[0].actorName, "nerixyz");
+
+    ASSERT_EQ(update.changes[1].emoteID, "3");
+    ASSERT_TRUE(update.changes[1].oldName.isEmpty());
+    ASSERT_EQ(update.changes[1].newName, "Renamed");
+    ASSERT_NE(update.changes[1].addedEmote, nullptr);
+
+    ASSERT_EQ(update.changes[2].emoteID, "4");
+    ASSERT_EQ(update.changes[2].oldName, "Old");
+    ASSERT_EQ(update.changes[2].newName, "New");
+    ASSERT_EQ(update.changes[2].addedEmote, nullptr);
+
+    ASSERT_EQ(update.changes[3].emoteID, "5");
+    ASSERT_EQ(update.changes[3].oldName, "RenamedAndRemoved");
+    ASSERT_TRUE(update.changes[3].newName.isEmpty());
+
+    // nothing left
+    f.updates.clear();
+    f.coalescer->flush();
+    ASSERT_TRUE(f.updates.empty());
+}
+
+TEST(SeventvEmoteSetCoalescer, Apply)
+{
+    mock::BaseApplication app;
+    Flushed f;
+
+    EmoteMap initial;
+    initial[EmoteName{"Kept"}] = makeEmote("Kept", "10");
+    initial[EmoteName{"Old"}] = makeEmote("Old", "4");
+    initial[EmoteName{"Removed"}] = makeEmote("Removed", "5");
+    Atomic<std::shared_ptr<const EmoteMap>> map(
+        std::make_shared<const EmoteMap>(initial));
+    auto before = map.get();
+
+    f.add("3", "AddedAndRenamed");
+    f.rename("3", "AddedAndRenamed", "Renamed");
+    f.rename("4", "Old", "New");
+    f.remove("5", "Removed");
+    f.remove("6", "Unknown");
+    f.coalescer->flush();
+    ASSERT_EQ(f.updates.size(), 1);
+
+    auto applied = SeventvEmotes::applyChanges(map, f.updates[0].changes);
+    ASSERT_EQ(applied.size(), 3);
+
+    auto after = map.get();
+    ASSERT_NE(before, after);
+    ASSERT_EQ(before->size(), 3);
+    ASSERT_EQ(after->size(), 3);
+    ASSERT_TRUE(after->contains(EmoteName{"Kept"}));
+    ASSERT_TRUE(after->contains(EmoteName{"Renamed"}));
+    ASSERT_TRUE(after->contains(EmoteName{"New"}));
+    ASSERT_EQ(after->at(EmoteName{"New"})->id.string, "4");
+    ASSERT_EQ(after->at(EmoteName{"Renamed"})->name.string, "Renamed");
+
+    // unknown emotes don't copy the map
+    auto none = SeventvEmotes::applyChanges(
+        map, {EmoteSetChange{
+                 .emoteID = "7",
+                 .oldName = "Unknown",
+                 .newName = {},
+                 .addedEmote = nullptr,
+                 .actorName = {},
+             }});
+    ASSERT_TRUE(none.empty());
+    ASSERT_EQ(map.get(), after);
+}
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "messages/SharedChatMessageCache.hpp"
+
+#include "messages/Emote.hpp"
+#include "messages/Image.hpp"
+#include "messages/Message.hpp"
+#include "messages/MessageBuilder.hpp"
+#include "messages/MessageElement.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "Test.hpp"
+
+#include <QJsonObject>
+
+using namespace chatterino;
+
+namespace {
+
+MessagePtr makeSource()
+{
+    MessageBuilder builder;
+    builder.emplace<TimestampElement>(QTime(13, 37));
+    builder.emplace<TextElement>("hello there", MessageElementFlag::Text,
+                                 MessageColor::Text);
+    builder
+        .emplace<MentionElement>("@forsen", "forsen", MessageColor::Text,
+                                 MessageColor(QColor(255, 0, 0)))
+        ->setTrailingSpace(false);
+    builder.emplace<EmoteElement>(
+        std::make_shared<const Emote>(Emote{
+            .name = {"Kappa"},
+            .images = ImageSet{getEmptyImagePtr(), getEmptyImagePtr(),
+                               getEmptyImagePtr()},
+            .tooltip = {"Kappa<br>Twitch Emote"},
+        }),
+        MessageElementFlag::Emote, MessageColor::Text);
+    builder.emplace<LinkElement>(
+        LinkElement::Parsed{
+            .lowercase = "chatterino.com",
+            .original = "Chatterino.com",
+        },
+        "http://Chatterino.com", MessageElementFlag::Text, MessageColor::Link);
+    return builder.release();
+}
+
+}  // namespace
+
+TEST(SharedChatMessageCache, CopyElements)
+{
+    mock::BaseApplication app;
+
+    auto source = makeSource();
+    MessageBuilder builder;
+    for (size_t i = 1; i < source->elements.size(); i++)
+    {
+        auto *copy = source->elements[i]->copyInto(builder);
+        ASSERT_NE(copy, nullptr);
+        ASSERT_NE(copy, source->elements[i].get());
+        ASSERT_EQ(copy->toJson(), source->elements[i]->toJson());
+    }
+
+    auto copied = builder.release();
+    ASSERT_EQ(copied->elements.size(), source->elements.size() - 1);
+
+    auto *link = dynamic_cast<LinkElement *>(copied->elements.back().get());
+    ASSERT_NE(link, nullptr);
+    ASSERT_EQ(link->linkInfo()->originalUrl(), "http://Chatterino.com");
+    ASSERT_TRUE(link->linkInfo()->isPending());
+
+    // timestamps aren't part of the text
+    MessageBuilder other;
+    ASSERT_EQ(source->elements[0]->copyInto(other), nullptr);
+}
+
+TEST(SharedChatMessageCache, FindAndInsert)
+{
+    mock::BaseApplication app;
+
+    SharedChatMessageCache cache;
+    ASSERT_FALSE(cache.find("id", "11148817").has_value());
+
+    auto source = makeSource();
+    cache.insert("id", "11148817",
+                 {
+                     .message = source,
+                     .begin = 1,
+                     .end = 3,
+                     .content = "hello there",
+                 });
+    ASSERT_EQ(cache.size(), 1);
+
+    auto entry = cache.find("id", "11148817");
+    ASSERT_TRUE(entry.has_value());
+    ASSERT_EQ(entry->message.lock(), source);
+    ASSERT_EQ(entry->begin, 1);
+    ASSERT_EQ(entry->end, 3);
+    ASSERT_EQ(entry->content, "hello there");
+
+    // the source room is part of the key
+    ASSERT_FALSE(cache.find("id", "117166826").has_value());
+
+    // entries don't keep messages alive
+    source.reset();
+    ASSERT_TRUE(cache.find("id", "11148817")->message.expired());
+}
+
+TEST(SharedChatMessageCache, Capacity)
+{
+    SharedChatMessageCache cache;
+    for (size_t i = 0; i < SharedChatMessageCache::CAPACITY + 10; i++)
+    {
+        cache.insert(QString::number(i), "11148817", {});
+    }
+
+    ASSERT_EQ(cache.size(), SharedChatMessageCache::CAPACITY);
+    ASSERT_FALSE(cache.find("0", "11148817").has_value());
+    ASSERT_TRUE(cache
+                    .find(QString::number(SharedChatMessageCache::CAPACITY),
+                          "11148817")
+                    .has_value());
+}
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "controllers/sound/SoundRateLimiter.hpp"
+
+#include "Test.hpp"
+
+using namespace chatterino;
+using namespace std::chrono_literals;
+
+TEST(SoundRateLimiter, LimitsPlays)
+{
+    SoundRateLimiter limiter(3, 500ms);
+    auto start = SoundRateLimiter::Clock::now();
+
+    ASSERT_TRUE(limiter.tryPlay("ping.wav", start));
+    ASSERT_TRUE(limiter.tryPlay("ping.wav", start + 10ms));
+    ASSERT_TRUE(limiter.tryPlay("ping.wav", start + 20ms));
+    ASSERT_FALSE(limiter.tryPlay("ping.wav", start + 30ms));
+    ASSERT_FALSE(limiter.tryPlay("ping.wav", start + 499ms));
+
+    // the first play left the window
+    ASSERT_TRUE(limiter.tryPlay("ping.wav", start + 500ms));
+    ASSERT_FALSE(limiter.tryPlay("ping.wav", start + 500ms));
+    ASSERT_TRUE(limiter.tryPlay("ping.wav", start + 520ms));
+
+    // dropped plays don't count
+    ASSERT_TRUE(limiter.tryPlay("ping.wav", start + 1100ms));
+    ASSERT_TRUE(limiter.tryPlay("ping.wav", start + 1100ms));
+    ASSERT_TRUE(limiter.tryPlay("ping.wav", start + 1100ms));
+}
+
+TEST(SoundRateLimiter, SeparateSounds)
+{
+    SoundRateLimiter limiter(1, 500ms);
+    auto start = SoundRateLimiter::Clock::now();
+
+    ASSERT_TRUE(limiter.tryPlay("ping.wav", start));
+    ASSERT_FALSE(limiter.tryPlay("ping.wav", start));
+    ASSERT_TRUE(limiter.tryPlay("", start));
+    ASSERT_TRUE(limiter.tryPlay("pong.wav", start));
+    ASSERT_FALSE(limiter.tryPlay("pong.wav", start + 100ms));
+    ASSERT_FALSE(limiter.tryPlay("", start + 100ms));
+}
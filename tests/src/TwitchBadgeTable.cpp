@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "providers/twitch/TwitchBadgeTable.hpp"
+
+#include "messages/Emote.hpp"
+#include "Test.hpp"
+
+#include <memory>
+
+using namespace chatterino;
+
+namespace {
+
+EmotePtr makeBadge(const QString &tooltip)
+{
+    return std::make_shared<const Emote>(Emote{
+        .tooltip = {tooltip},
+    });
+}
+
+}  // namespace
+
+TEST(TwitchBadgeTable, Find)
+{
+    TwitchBadgeTable table;
+    ASSERT_FALSE(table.find(u"subscriber", u"0").has_value());
+    ASSERT_FALSE(table.findAny("subscriber").has_value());
+
+    auto sub0 = makeBadge("Subscriber");
+    auto sub3 = makeBadge("3-Month Subscriber");
+    auto bits = makeBadge("cheer 100");
+    table.insert("subscriber", "0", sub0);
+    table.insert("subscriber", "3", sub3);
+    table.insert("bits", "100", bits);
+    ASSERT_EQ(table.size(), 3);
+
+    ASSERT_EQ(table.find(u"subscriber", u"0"), sub0);
+    ASSERT_EQ(table.find(u"subscriber", u"3"), sub3);
+    ASSERT_EQ(table.find(u"bits", u"100"), bits);
+    ASSERT_FALSE(table.find(u"subscriber", u"6").has_value());
+    ASSERT_FALSE(table.find(u"bits", u"0").has_value());
+    // the set and version are separate
+    ASSERT_FALSE(table.find(u"subscriber0", u"").has_value());
+
+    ASSERT_EQ(table.findAny("subscriber"), sub0);
+    ASSERT_EQ(table.findAny("bits"), bits);
+    ASSERT_FALSE(table.findAny("moderator").has_value());
+
+    // lookups work with views into other strings
+    QString tag = "subscriber/3";
+    ASSERT_EQ(table.find(QStringView(tag).left(10), QStringView(tag).mid(11)),
+              sub3);
+}
+
+TEST(TwitchBadgeTable, Replace)
+{
+    TwitchBadgeTable table;
+    auto before = makeBadge("before");
+    auto after = makeBadge("after");
+    table.insert("subscriber", "0", before);
+
+    TwitchBadgeTable copy(table);
+    copy.insert("subscriber", "0", after);
+
+    ASSERT_EQ(table.find(u"subscriber", u"0"), before);
+    ASSERT_EQ(copy.find(u"subscriber", u"0"), after);
+    ASSERT_EQ(copy.size(), 1);
+}
@@ -0,0 +1,199 @@
+// SPDX-FileCopyrightText: 2026 Contributors to Chatterino <https://chatterino.com>
+//
+// SPDX-License-Identifier: MIT
+
+#include "controllers/userdata/UserDataController.hpp"
+
+#include "singletons/Paths.hpp"
+#include "Test.hpp"
+#include "util/CombinePath.hpp"
+
+#include <QColor>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QTemporaryDir>
+
+#include <chrono>
+#include <functional>
+#include <thread>
+
+using namespace chatterino;
+using namespace std::chrono_literals;
+
+namespace {
+
+class UserDataControllerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(this->dir.isValid());
+        this->paths.settingsDirectory = this->dir.path();
+        this->file = combinePath(this->dir.path(), "user-data.json");
+    }
+
+    /// Processes events until `done` returns true or `timeout` passed
+    static bool waitFor(const std::function<bool()> &done,
+                        std::chrono::milliseconds timeout)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        while (!done())
+        {
+            if (timer.elapsed() > timeout.count())
+            {
+                return false;
+            }
+            QCoreApplication::processEvents();
+            std::this_thread::sleep_for(10ms);
+        }
+        return true;
+    }
+
+    QTemporaryDir dir;
+    Paths paths;
+    QString file;
+};
+
+}  // namespace
+
+TEST_F(UserDataControllerTest, UpdatesAcrossShards)
+{
+    UserDataController controller(this->paths);
+
+    // Enough users to end up in every shard
+    constexpr int USERS = 1000;
+    for (int i = 0; i < USERS; i++)
+    {
+        controller.setUserNotes(QString::number(i),
+                                "notes " + QString::number(i));
+    }
+    for (int i = 0; i < USERS; i++)
+    {
+        auto user = controller.getUser(QString::number(i));
+        ASSERT_TRUE(user.has_value());
+        ASSERT_EQ(user->notes, "notes " + QString::number(i));
+        ASSERT_FALSE(user->color.has_value());
+    }
+
+    // A copy from before an update doesn't change
+    auto before = controller.getUser("500");
+
+    controller.setUserColor("500", "#00ff00");
+    auto after = controller.getUser("500");
+    ASSERT_EQ(after->color, QColor("#00ff00"));
+    ASSERT_EQ(after->notes, "notes 500");
+    ASSERT_EQ(controller.getUserColor("500"), QColor("#00ff00"));
+    ASSERT_FALSE(before->color.has_value());
+
+    // Other users (in the same or another shard) keep their data
+    for (int i = 0; i < USERS; i++)
+    {
+        if (i == 500)
+        {
+            continue;
+        }
+        auto user = controller.getUser(QString::number(i));
+        ASSERT_TRUE(user.has_value());
+        ASSERT_EQ(user->notes, "notes " + QString::number(i));
+        ASSERT_FALSE(controller.getUserColor(QString::number(i)).has_value());
+    }
+
+    // Users without any data are removed
+    controller.setUserColor("500", "");
+    controller.setUserNotes("500", "");
+    ASSERT_FALSE(controller.getUser("500").has_value());
+    ASSERT_TRUE(controller.getUser("501").has_value());
+}
+
+TEST_F(UserDataControllerTest, CoalescesSaves)
+{
+    UserDataController controller(this->paths);
+
+    QElapsedTimer timer;
+    timer.start();
+    controller.setUserColor("1", "#ff0000");
+    controller.setUserNotes("1", "first");
+    controller.setUserNotes("2", "second");
+
+    // Nothing is written until the changes settled
+    QCoreApplication::processEvents();
+    ASSERT_FALSE(QFile::exists(this->file));
+
+    ASSERT_TRUE(waitFor(
+        [&] {
+            return QFile::exists(this->file);
+        },
+        5s));
+    ASSERT_GE(timer.elapsed(), 1900);
+    controller.save();
+
+    // The one save contained all changes
+    {
+        UserDataController reloaded(this->paths);
+        ASSERT_EQ(reloaded.getUserColor("1"), QColor("#ff0000"));
+        ASSERT_EQ(reloaded.getUser("1")->notes, "first");
+        ASSERT_EQ(reloaded.getUser("2")->notes, "second");
+    }
+
+    // No other save follows
+    ASSERT_TRUE(QFile::remove(this->file));
+    ASSERT_FALSE(waitFor(
+        [&] {
+            return QFile::exists(this->file);
+        },
+        3s));
+}
+
+TEST_F(UserDataControllerTest, SavesOnDestruction)
+{
+    {
+        UserDataController controller(this->paths);
+        controller.setUserNotes("1", "notes");
+        QCoreApplication::processEvents();
+        ASSERT_FALSE(QFile::exists(this->file));
+    }
+
+    // The pending save was written right away
+    ASSERT_TRUE(QFile::exists(this->file));
+
+    UserDataController reloaded(this->paths);
+    auto user = reloaded.getUser("1");
+    ASSERT_TRUE(user.has_value());
+    ASSERT_EQ(user->notes, "notes");
+}
+
+TEST_F(UserDataControllerTest, LatestSaveWins)
+{
+    UserDataController controller(this->paths);
+
+    for (int i = 0; i < 3; i++)
+    {
+        // Let the debounced save start in the background...
+        controller.setUserNotes("1", "debounced " + QString::number(i));
+        ASSERT_TRUE(waitFor(
+            [&] {
+                return QFile::exists(this->file);
+            },
+            5s));
+        ASSERT_TRUE(QFile::remove(this->file));
+
+        // ...and save a newer edit right away while it might still run
+        controller.setUserNotes("1", "saved " + QString::number(i));
+        controller.save();
+
+        UserDataController reloaded(this->paths);
+        ASSERT_EQ(reloaded.getUser("1")->notes, "saved " + QString::number(i));
+    }
+
+    // Edits after an explicit save are still written by the debounce
+    controller.setUserNotes("1", "last");
+    ASSERT_TRUE(waitFor(
+        [&] {
+            UserDataController reloaded(this->paths);
+            auto user = reloaded.getUser("1");
+            return user && user->notes == "last";
+        },
+        5s));
+}
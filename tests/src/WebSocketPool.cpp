@@ -8,6 +8,8 @@
 #include "Test.hpp"
 #include "util/OnceFlag.hpp"
 
+#include <array>
+
 using namespace chatterino;
 using namespace std::chrono_literals;
 
@@ -182,3 +184,64 @@ TEST(WebSocketPool, tlsEcho)
     ASSERT_EQ(messages[10].first, true);
     ASSERT_EQ(messages[10].second, "/echo");
 }
+
+TEST(WebSocketPool, shardedEcho)
+{
+    mock::BaseApplication app;
+    WebSocketPool pool({}, 3);
+    ASSERT_TRUE(pool.stats().empty());
+
+    struct Connection {
+        std::vector<std::pair<bool, QByteArray>> messages;
+        OnceFlag messageFlag;
+        OnceFlag closeFlag;
+        OnceFlag openFlag;
+        WebSocketHandle handle;
+    };
+    std::array<Connection, 4> connections;
+
+    for (auto &conn : connections)
+    {
+        conn.handle = pool.createSocket(
+            {
+                .url = QUrl("ws://127.0.0.1:9052/echo"),
+                .headers = {},
+            },
+            std::make_unique<Listener>(conn.messages, conn.messageFlag,
+                                       conn.closeFlag, conn.openFlag));
+    }
+
+    // connections are spread over the shards
+    auto stats = pool.stats();
+    ASSERT_EQ(stats.size(), 3);
+    ASSERT_EQ(stats[0].connections, 2);
+    ASSERT_EQ(stats[1].connections, 1);
+    ASSERT_EQ(stats[2].connections, 1);
+
+    for (auto &conn : connections)
+    {
+        conn.handle.sendText("message");
+    }
+    for (auto &conn : connections)
+    {
+        ASSERT_TRUE(conn.messageFlag.waitFor(1s));
+        conn.handle.sendText("/CLOSE");
+    }
+    for (auto &conn : connections)
+    {
+        ASSERT_TRUE(conn.closeFlag.waitFor(1s));
+        ASSERT_EQ(conn.messages.size(), 1);
+        ASSERT_EQ(conn.messages[0].second, "message");
+    }
+
+    stats = pool.stats();
+    uint64_t frames = 0;
+    uint64_t bytes = 0;
+    for (const auto &shard : stats)
+    {
+        frames += shard.framesReceived;
+        bytes += shard.bytesReceived;
+    }
+    ASSERT_EQ(frames, 4);
+    ASSERT_EQ(bytes, 4 * 7);
+}